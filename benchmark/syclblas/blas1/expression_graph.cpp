@@ -0,0 +1,205 @@
+/**************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename expression_graph.cpp
+ *
+ **************************************************************************/
+
+#include "../utils.hpp"
+#include "sycl_blas.hpp"
+
+using namespace blas;
+
+/* Measures the submission overhead saved by recording the trees of an
+ * axpy, scal, dot sequence and submitting them with end_capture, compared to
+ * executing them one by one */
+enum class submission_t : int { eager = 0, captured = 1 };
+
+std::string get_submission_name(submission_t submission) {
+  return submission == submission_t::captured ? "captured" : "eager";
+}
+
+template <typename scalar_t>
+std::string get_name(submission_t submission, int size) {
+  std::ostringstream str{};
+  str << "BM_ExpressionGraph<"
+      << blas_benchmark::utils::get_type_name<scalar_t>() << ">/"
+      << get_submission_name(submission) << "/" << size;
+  return str.str();
+}
+
+template <submission_t submission, typename executor_t, typename scalar_t,
+          typename input_t, typename output_t>
+std::vector<cl::sycl::event> launch_sequence(executor_t& ex, scalar_t alpha,
+                                             scalar_t beta, input_t inx,
+                                             input_t iny, output_t out,
+                                             index_t size) {
+  auto vx = make_vector_view(ex, inx, 1, size);
+  auto vy = make_vector_view(ex, iny, 1, size);
+  auto rs = make_vector_view(ex, out, 1, 1);
+
+  // y = alpha * x + y
+  auto axpyScalOp = make_op<ScalarOp, ProductOperator>(alpha, vx);
+  auto axpyAddOp = make_op<BinaryOp, AddOperator>(vy, axpyScalOp);
+  auto axpyOp = make_op<Assign>(vy, axpyAddOp);
+  // y = beta * y
+  auto scalScalOp = make_op<ScalarOp, ProductOperator>(beta, vy);
+  auto scalOp = make_op<Assign>(vy, scalScalOp);
+  // r = x . y
+  auto prdOp = make_op<BinaryOp, ProductOperator>(vx, vy);
+  const index_t localSize = ex.get_policy_handler().get_work_group_size();
+  auto dotOp = make_AssignReduction<AddOperator>(rs, prdOp, localSize,
+                                                 localSize * 2 * localSize);
+
+  if (submission == submission_t::captured) {
+    auto graph =
+        ex.begin_capture().record(axpyOp).record(scalOp).record(dotOp);
+    return ex.end_capture(graph);
+  }
+  auto event = ex.execute(axpyOp);
+  event = concatenate_vectors(event, ex.execute(scalOp));
+  return concatenate_vectors(event, ex.execute(dotOp));
+}
+
+template <typename scalar_t, submission_t submission>
+void run(benchmark::State& state, ExecutorType* executorPtr, index_t size,
+         bool* success) {
+  // Google-benchmark counters are double.
+  double size_d = static_cast<double>(size);
+  state.counters["size"] = size_d;
+  state.counters["n_fl_ops"] = 5.0 * size_d;
+  state.counters["bytes_processed"] =
+      (submission == submission_t::captured ? 5.0 : 7.0) * size_d *
+      sizeof(scalar_t);
+
+  ExecutorType& ex = *executorPtr;
+
+  using data_t = utils::data_storage_t<scalar_t>;
+
+  // Create data
+  std::vector<data_t> v1 = blas_benchmark::utils::random_data<data_t>(size);
+  std::vector<data_t> v2 = blas_benchmark::utils::random_data<data_t>(size);
+  // Keep y bounded over the repetitions
+  scalar_t alpha = 0.5;
+  scalar_t beta = 0.5;
+
+  data_t vr;
+
+  auto inx = utils::make_quantized_buffer<scalar_t>(ex, v1);
+  auto iny = utils::make_quantized_buffer<scalar_t>(ex, v2);
+  auto inr = utils::make_quantized_buffer<scalar_t>(ex, vr);
+
+#ifdef BLAS_VERIFY_BENCHMARK
+  // Run a first time with a verification of the results
+  std::vector<data_t> y_ref = v2;
+  reference_blas::axpy(size, static_cast<data_t>(alpha), v1.data(), 1,
+                       y_ref.data(), 1);
+  reference_blas::scal(size, static_cast<data_t>(beta), y_ref.data(), 1);
+  data_t vr_ref = reference_blas::dot(size, v1.data(), 1, y_ref.data(), 1);
+  data_t vr_temp = 0;
+  {
+    auto y_temp_gpu = utils::make_quantized_buffer<scalar_t>(ex, v2);
+    auto vr_temp_gpu = utils::make_quantized_buffer<scalar_t>(ex, vr_temp);
+    launch_sequence<submission>(ex, alpha, beta, inx, y_temp_gpu, vr_temp_gpu,
+                                size);
+    auto event =
+        utils::quantized_copy_to_host<scalar_t>(ex, vr_temp_gpu, vr_temp);
+    ex.get_policy_handler().wait(event);
+  }
+
+  if (!utils::almost_equal<data_t>(vr_temp, vr_ref)) {
+    std::ostringstream err_stream;
+    err_stream << "Value mismatch: " << vr_temp << "; expected " << vr_ref;
+    const std::string& err_str = err_stream.str();
+    state.SkipWithError(err_str.c_str());
+    *success = false;
+  };
+#endif
+
+  auto blas_method_def = [&]() -> std::vector<cl::sycl::event> {
+    auto event =
+        launch_sequence<submission>(ex, alpha, beta, inx, iny, inr, size);
+    ex.get_policy_handler().wait(event);
+    return event;
+  };
+
+  // Warmup
+  blas_benchmark::utils::warmup(blas_method_def);
+  ex.get_policy_handler().wait();
+
+  // Number of kernels launched by one sequence
+  state.counters["n_kernels"] =
+      static_cast<double>(blas_method_def().size());
+
+  blas_benchmark::utils::init_counters(state);
+
+  // Measure
+  for (auto _ : state) {
+    // Run
+    std::tuple<double, double> times =
+        blas_benchmark::utils::timef(blas_method_def);
+
+    // Report
+    blas_benchmark::utils::update_counters(state, times);
+  }
+
+  blas_benchmark::utils::calc_avg_counters(state);
+}
+
+template <typename scalar_t, submission_t submission>
+void register_submission(std::vector<blas1_param_t>& params,
+                         ExecutorType* exPtr, bool* success) {
+  for (auto size : params) {
+    auto BM_lambda = [&](benchmark::State& st, ExecutorType* exPtr,
+                         index_t size, bool* success) {
+      run<scalar_t, submission>(st, exPtr, size, success);
+    };
+    benchmark::RegisterBenchmark(get_name<scalar_t>(submission, size).c_str(),
+                                 BM_lambda, exPtr, size, success);
+  }
+}
+
+template <typename scalar_t>
+void register_benchmark(blas_benchmark::Args& args, ExecutorType* exPtr,
+                        bool* success) {
+  // The default sizes are short vectors, for which the submission overhead
+  // dominates
+  std::vector<blas1_param_t> graph_params;
+  if (args.csv_param.empty()) {
+    for (index_t size = 64; size <= 65536; size *= 4) {
+      graph_params.push_back(size);
+    }
+  } else {
+    graph_params = blas_benchmark::utils::get_blas1_params(args);
+  }
+
+  register_submission<scalar_t, submission_t::eager>(graph_params, exPtr,
+                                                     success);
+  register_submission<scalar_t, submission_t::captured>(graph_params, exPtr,
+                                                        success);
+}
+
+namespace blas_benchmark {
+void create_benchmark(blas_benchmark::Args& args, ExecutorType* exPtr,
+                      bool* success) {
+  BLAS_REGISTER_BENCHMARK(args, exPtr, success);
+}
+}  // namespace blas_benchmark
@@ -0,0 +1,178 @@
+/**************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename reduction.cpp
+ *
+ **************************************************************************/
+
+#include "../utils.hpp"
+#include "sycl_blas.hpp"
+
+using namespace blas;
+
+/* Compares the single pass and multi pass reduction algorithms on the
+ * reduction used by asum */
+template <reduction_algorithm_t algorithm>
+struct AbsoluteAddWith : public AbsoluteAddOperator {
+  static constexpr reduction_algorithm_t reduction_algorithm = algorithm;
+};
+
+std::string get_algorithm_name(reduction_algorithm_t algorithm) {
+  return algorithm == reduction_algorithm_t::single_pass ? "single_pass"
+                                                         : "multi_pass";
+}
+
+template <typename scalar_t>
+std::string get_name(reduction_algorithm_t algorithm, int size) {
+  std::ostringstream str{};
+  str << "BM_Reduction<" << blas_benchmark::utils::get_type_name<scalar_t>()
+      << ">/" << get_algorithm_name(algorithm) << "/" << size;
+  return str.str();
+}
+
+template <reduction_algorithm_t algorithm, typename executor_t,
+          typename input_t, typename output_t>
+std::vector<cl::sycl::event> launch_reduction(executor_t& ex, input_t in,
+                                              output_t out, index_t size) {
+  auto vx = make_vector_view(ex, in, 1, size);
+  auto rs = make_vector_view(ex, out, 1, 1);
+  const index_t localSize = ex.get_policy_handler().get_work_group_size();
+  const index_t nWG = 2 * localSize;
+  auto assignOp = make_AssignReduction<AbsoluteAddWith<algorithm>>(
+      rs, vx, localSize, localSize * nWG);
+  return ex.execute(assignOp);
+}
+
+template <typename scalar_t, reduction_algorithm_t algorithm>
+void run(benchmark::State& state, ExecutorType* executorPtr, index_t size,
+         bool* success) {
+  // Google-benchmark counters are double.
+  double size_d = static_cast<double>(size);
+  state.counters["size"] = size_d;
+  state.counters["n_fl_ops"] = 2.0 * size_d;
+  state.counters["bytes_processed"] = size_d * sizeof(scalar_t);
+
+  ExecutorType& ex = *executorPtr;
+
+  using data_t = utils::data_storage_t<scalar_t>;
+
+  // Create data
+  std::vector<data_t> v1 = blas_benchmark::utils::random_data<data_t>(size);
+
+  // We need to guarantee that cl::sycl::half can hold the sum
+  // of x_v without overflow by making sum(x_v) to be 1.0
+  std::transform(std::begin(v1), std::end(v1), std::begin(v1),
+                 [=](data_t x) { return x / v1.size(); });
+
+  data_t vr;
+
+  auto inx = utils::make_quantized_buffer<scalar_t>(ex, v1);
+  auto inr = utils::make_quantized_buffer<scalar_t>(ex, vr);
+
+#ifdef BLAS_VERIFY_BENCHMARK
+  // Run a first time with a verification of the results
+  data_t vr_ref = reference_blas::asum(size, v1.data(), 1);
+  data_t vr_temp = 0;
+  {
+    auto vr_temp_gpu = utils::make_quantized_buffer<scalar_t>(ex, vr_temp);
+    launch_reduction<algorithm>(ex, inx, vr_temp_gpu, size);
+    auto event =
+        utils::quantized_copy_to_host<scalar_t>(ex, vr_temp_gpu, vr_temp);
+    ex.get_policy_handler().wait(event);
+  }
+
+  if (!utils::almost_equal<data_t>(vr_temp, vr_ref)) {
+    std::ostringstream err_stream;
+    err_stream << "Value mismatch: " << vr_temp << "; expected " << vr_ref;
+    const std::string& err_str = err_stream.str();
+    state.SkipWithError(err_str.c_str());
+    *success = false;
+  };
+#endif
+
+  auto blas_method_def = [&]() -> std::vector<cl::sycl::event> {
+    auto event = launch_reduction<algorithm>(ex, inx, inr, size);
+    ex.get_policy_handler().wait(event);
+    return event;
+  };
+
+  // Warmup
+  blas_benchmark::utils::warmup(blas_method_def);
+  ex.get_policy_handler().wait();
+
+  // Number of kernels launched by one reduction
+  state.counters["n_kernels"] =
+      static_cast<double>(blas_method_def().size());
+
+  blas_benchmark::utils::init_counters(state);
+
+  // Measure
+  for (auto _ : state) {
+    // Run
+    std::tuple<double, double> times =
+        blas_benchmark::utils::timef(blas_method_def);
+
+    // Report
+    blas_benchmark::utils::update_counters(state, times);
+  }
+
+  blas_benchmark::utils::calc_avg_counters(state);
+}
+
+template <typename scalar_t, reduction_algorithm_t algorithm>
+void register_algorithm(std::vector<blas1_param_t>& params,
+                        ExecutorType* exPtr, bool* success) {
+  for (auto size : params) {
+    auto BM_lambda = [&](benchmark::State& st, ExecutorType* exPtr,
+                         index_t size, bool* success) {
+      run<scalar_t, algorithm>(st, exPtr, size, success);
+    };
+    benchmark::RegisterBenchmark(get_name<scalar_t>(algorithm, size).c_str(),
+                                 BM_lambda, exPtr, size, success);
+  }
+}
+
+template <typename scalar_t>
+void register_benchmark(blas_benchmark::Args& args, ExecutorType* exPtr,
+                        bool* success) {
+  // The default sizes cover the range where the launch overhead dominates
+  // as well as the one where the memory bandwidth does
+  std::vector<blas1_param_t> red_params;
+  if (args.csv_param.empty()) {
+    for (index_t size = 1024; size <= 268435456; size *= 4) {
+      red_params.push_back(size);
+    }
+  } else {
+    red_params = blas_benchmark::utils::get_blas1_params(args);
+  }
+
+  register_algorithm<scalar_t, reduction_algorithm_t::multi_pass>(
+      red_params, exPtr, success);
+  register_algorithm<scalar_t, reduction_algorithm_t::single_pass>(
+      red_params, exPtr, success);
+}
+
+namespace blas_benchmark {
+void create_benchmark(blas_benchmark::Args& args, ExecutorType* exPtr,
+                      bool* success) {
+  BLAS_REGISTER_BENCHMARK(args, exPtr, success);
+}
+}  // namespace blas_benchmark
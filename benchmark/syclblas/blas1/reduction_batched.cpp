@@ -0,0 +1,268 @@
+/**************************************************************************
+ *
+ *  @license
+ *  Copyright (C) 2016 Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename reduction_batched.cpp
+ *
+ **************************************************************************/
+
+#include "../utils.hpp"
+
+using namespace blas;
+
+/* Compares the strided-batched reductions, which reduce the whole batch in a
+ * single kernel, with a loop launching the single-vector reduction on each
+ * vector of the batch */
+enum class operation_t : int { dot = 0, asum = 1, nrm2 = 2, iamax = 3 };
+enum class path_t : int { looped = 0, batched = 1 };
+
+// Number of vectors reduced by each run
+constexpr index_t batch_size = 64;
+
+std::string get_operation_name(operation_t op) {
+  switch (op) {
+    case operation_t::dot:
+      return "dot";
+    case operation_t::asum:
+      return "asum";
+    case operation_t::nrm2:
+      return "nrm2";
+    default:
+      return "iamax";
+  }
+}
+
+std::string get_path_name(path_t path) {
+  return path == path_t::batched ? "batched" : "looped";
+}
+
+template <typename scalar_t>
+std::string get_name(operation_t op, path_t path, int size) {
+  std::ostringstream str{};
+  str << "BM_ReductionBatched<"
+      << blas_benchmark::utils::get_type_name<scalar_t>() << ">/"
+      << get_operation_name(op) << "/" << get_path_name(path) << "/" << size
+      << "/" << batch_size;
+  return str.str();
+}
+
+template <operation_t op, path_t path, typename executor_t, typename input_t,
+          typename output_t, typename tuple_output_t>
+std::vector<cl::sycl::event> launch_reduction(executor_t& ex, input_t inx,
+                                              input_t iny, output_t out,
+                                              tuple_output_t outI,
+                                              index_t size) {
+  if (path == path_t::batched) {
+    switch (op) {
+      case operation_t::dot:
+        return _dot_batched(ex, size, inx, 1, size, iny, 1, size, out,
+                            batch_size);
+      case operation_t::asum:
+        return _asum_batched(ex, size, inx, 1, size, out, batch_size);
+      case operation_t::nrm2:
+        return _nrm2_batched(ex, size, inx, 1, size, out, batch_size);
+      default:
+        return _iamax_batched(ex, size, inx, 1, size, outI, batch_size);
+    }
+  }
+  std::vector<cl::sycl::event> events;
+  for (index_t b = 0; b < batch_size; b++) {
+    switch (op) {
+      case operation_t::dot:
+        events = concatenate_vectors(
+            events, _dot(ex, size, inx + b * size, 1, iny + b * size, 1,
+                         out + b));
+        break;
+      case operation_t::asum:
+        events = concatenate_vectors(
+            events, _asum(ex, size, inx + b * size, 1, out + b));
+        break;
+      case operation_t::nrm2:
+        events = concatenate_vectors(
+            events, _nrm2(ex, size, inx + b * size, 1, out + b));
+        break;
+      default:
+        events = concatenate_vectors(
+            events, _iamax(ex, size, inx + b * size, 1, outI + b));
+        break;
+    }
+  }
+  return events;
+}
+
+template <typename scalar_t, operation_t op, path_t path>
+void run(benchmark::State& state, ExecutorType* executorPtr, index_t size,
+         bool* success) {
+  // Google-benchmark counters are double.
+  double size_d = static_cast<double>(size);
+  double batch_size_d = static_cast<double>(batch_size);
+  double n_inputs = (op == operation_t::dot) ? 2.0 : 1.0;
+  state.counters["size"] = size_d;
+  state.counters["batch_size"] = batch_size_d;
+  state.counters["n_fl_ops"] = 2 * size_d * batch_size_d;
+  state.counters["bytes_processed"] =
+      n_inputs * size_d * batch_size_d * sizeof(scalar_t);
+
+  ExecutorType& ex = *executorPtr;
+
+  using data_t = utils::data_storage_t<scalar_t>;
+  using tuple_scalar_t = blas::IndexValueTuple<index_t, scalar_t>;
+
+  // Create data, the vectors of the batch are contiguous
+  std::vector<data_t> v1 =
+      blas_benchmark::utils::random_data<data_t>(size * batch_size);
+  std::vector<data_t> v2 =
+      blas_benchmark::utils::random_data<data_t>(size * batch_size);
+
+  // Make sure cl::sycl::half can hold the results of the reductions
+  std::transform(std::begin(v1), std::end(v1), std::begin(v1),
+                 [=](data_t x) { return x / size; });
+
+  std::vector<data_t> vr(batch_size);
+
+  auto inx = utils::make_quantized_buffer<scalar_t>(ex, v1);
+  auto iny = utils::make_quantized_buffer<scalar_t>(ex, v2);
+  auto inr = utils::make_quantized_buffer<scalar_t>(ex, vr);
+  auto inrI = blas::make_sycl_iterator_buffer<tuple_scalar_t>(batch_size);
+
+#ifdef BLAS_VERIFY_BENCHMARK
+  // Run a first time with a verification of the results
+  std::vector<tuple_scalar_t> vrI(batch_size, tuple_scalar_t{-1, 0});
+  {
+    auto vr_temp_gpu = utils::make_quantized_buffer<scalar_t>(ex, vr);
+    auto vrI_temp_gpu =
+        blas::make_sycl_iterator_buffer<tuple_scalar_t>(batch_size);
+    auto event = launch_reduction<op, path>(ex, inx, iny, vr_temp_gpu,
+                                            vrI_temp_gpu, size);
+    ex.get_policy_handler().wait(event);
+    event = utils::quantized_copy_to_host<scalar_t>(ex, vr_temp_gpu, vr);
+    ex.get_policy_handler().wait(event);
+    event = ex.get_policy_handler().copy_to_host(vrI_temp_gpu, vrI.data(),
+                                                 batch_size);
+    ex.get_policy_handler().wait(event);
+  }
+
+  for (index_t b = 0; b < batch_size; b++) {
+    const data_t* x_b = v1.data() + b * size;
+    const data_t* y_b = v2.data() + b * size;
+    bool match;
+    data_t vr_ref = 0;
+    if (op == operation_t::iamax) {
+      index_t ref = reference_blas::iamax(size, x_b, 1);
+      match = (ref == vrI[b].ind);
+      vr_ref = static_cast<data_t>(ref);
+    } else {
+      vr_ref = (op == operation_t::dot)
+                   ? reference_blas::dot(size, x_b, 1, y_b, 1)
+                   : (op == operation_t::asum)
+                         ? reference_blas::asum(size, x_b, 1)
+                         : reference_blas::nrm2(size, x_b, 1);
+      match = utils::almost_equal<data_t, scalar_t>(vr[b], vr_ref);
+    }
+    if (!match) {
+      std::ostringstream err_stream;
+      err_stream << "Value mismatch for vector " << b << ": expected "
+                 << vr_ref;
+      const std::string& err_str = err_stream.str();
+      state.SkipWithError(err_str.c_str());
+      *success = false;
+      break;
+    }
+  }
+#endif
+
+  auto blas_method_def = [&]() -> std::vector<cl::sycl::event> {
+    auto event = launch_reduction<op, path>(ex, inx, iny, inr, inrI, size);
+    ex.get_policy_handler().wait(event);
+    return event;
+  };
+
+  // Warmup
+  blas_benchmark::utils::warmup(blas_method_def);
+  ex.get_policy_handler().wait();
+
+  // Number of kernels launched by one run
+  state.counters["n_kernels"] = static_cast<double>(blas_method_def().size());
+
+  blas_benchmark::utils::init_counters(state);
+
+  // Measure
+  for (auto _ : state) {
+    // Run
+    std::tuple<double, double> times =
+        blas_benchmark::utils::timef(blas_method_def);
+
+    // Report
+    blas_benchmark::utils::update_counters(state, times);
+  }
+
+  blas_benchmark::utils::calc_avg_counters(state);
+}
+
+template <typename scalar_t, operation_t op, path_t path>
+void register_reduction(std::vector<blas1_param_t>& params,
+                        ExecutorType* exPtr, bool* success) {
+  for (auto size : params) {
+    auto BM_lambda = [&](benchmark::State& st, ExecutorType* exPtr,
+                         index_t size, bool* success) {
+      run<scalar_t, op, path>(st, exPtr, size, success);
+    };
+    benchmark::RegisterBenchmark(get_name<scalar_t>(op, path, size).c_str(),
+                                 BM_lambda, exPtr, size, success);
+  }
+}
+
+template <typename scalar_t, operation_t op>
+void register_operation(std::vector<blas1_param_t>& params,
+                        ExecutorType* exPtr, bool* success) {
+  register_reduction<scalar_t, op, path_t::looped>(params, exPtr, success);
+  register_reduction<scalar_t, op, path_t::batched>(params, exPtr, success);
+}
+
+template <typename scalar_t>
+void register_benchmark(blas_benchmark::Args& args, ExecutorType* exPtr,
+                        bool* success) {
+  // The default sizes are short vectors, for which launching one kernel per
+  // vector leaves the device mostly idle
+  std::vector<blas1_param_t> batched_params;
+  if (args.csv_param.empty()) {
+    for (index_t size = 64; size <= 65536; size *= 4) {
+      batched_params.push_back(size);
+    }
+  } else {
+    batched_params = blas_benchmark::utils::get_blas1_params(args);
+  }
+
+  register_operation<scalar_t, operation_t::dot>(batched_params, exPtr,
+                                                 success);
+  register_operation<scalar_t, operation_t::asum>(batched_params, exPtr,
+                                                  success);
+  register_operation<scalar_t, operation_t::nrm2>(batched_params, exPtr,
+                                                  success);
+  register_operation<scalar_t, operation_t::iamax>(batched_params, exPtr,
+                                                   success);
+}
+
+namespace blas_benchmark {
+void create_benchmark(blas_benchmark::Args& args, ExecutorType* exPtr,
+                      bool* success) {
+  BLAS_REGISTER_BENCHMARK(args, exPtr, success);
+}
+}  // namespace blas_benchmark
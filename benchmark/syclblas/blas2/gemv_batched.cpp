@@ -0,0 +1,271 @@
+/**************************************************************************
+ *
+ *  @license
+ *  Copyright (C) 2016 Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename gemv_batched.cpp
+ *
+ **************************************************************************/
+
+#include "../utils.hpp"
+
+using namespace blas;
+
+/* Compares the batched GEMV, which computes the whole batch in a single
+ * kernel, with a loop launching the GEMV on each matrix of the batch */
+enum class path_t : int { looped = 0, strided = 1, interleaved = 2 };
+
+// Number of matrix vector products computed by each run
+constexpr index_t batch_size = 64;
+
+std::string get_path_name(path_t path) {
+  switch (path) {
+    case path_t::looped:
+      return "looped";
+    case path_t::strided:
+      return "strided";
+    default:
+      return "interleaved";
+  }
+}
+
+template <typename scalar_t>
+std::string get_name(std::string t, int m, int n, path_t path) {
+  std::ostringstream str{};
+  str << "BM_GemvBatched<" << blas_benchmark::utils::get_type_name<scalar_t>()
+      << ">/" << t << "/" << m << "/" << n << "/" << batch_size << "/"
+      << get_path_name(path);
+  return str.str();
+}
+
+// Convert a batch of items of item_size elements stored one after the other to
+// the interleaved layout, in which the batch is the fastest dimension
+template <typename data_t>
+std::vector<data_t> strided_to_interleaved(const std::vector<data_t>& input,
+                                           index_t item_size) {
+  std::vector<data_t> output(input.size());
+  for (index_t b = 0; b < batch_size; ++b) {
+    for (index_t k = 0; k < item_size; ++k) {
+      output[k * batch_size + b] = input[b * item_size + k];
+    }
+  }
+  return output;
+}
+
+template <path_t path, typename executor_t, typename scalar_t,
+          typename input_t, typename output_t>
+std::vector<cl::sycl::event> launch_gemv(executor_t& ex, char t, index_t m,
+                                         index_t n, scalar_t alpha,
+                                         input_t m_a, input_t v_x,
+                                         scalar_t beta, output_t v_y) {
+  const index_t xlen = t == 'n' ? n : m;
+  const index_t ylen = t == 'n' ? m : n;
+  switch (path) {
+    case path_t::strided:
+      return _gemv_batched(ex, t, m, n, alpha, m_a, m, v_x, 1, beta, v_y, 1,
+                           batch_size, gemm_batch_type_t::strided);
+    case path_t::interleaved:
+      return _gemv_batched(ex, t, m, n, alpha, m_a, m, v_x, 1, beta, v_y, 1,
+                           batch_size, gemm_batch_type_t::interleaved);
+    default:
+      break;
+  }
+  std::vector<cl::sycl::event> events;
+  for (index_t b = 0; b < batch_size; b++) {
+    events = concatenate_vectors(
+        events, _gemv(ex, t, m, n, alpha, m_a + b * m * n, m, v_x + b * xlen, 1,
+                      beta, v_y + b * ylen, 1));
+  }
+  return events;
+}
+
+template <typename scalar_t, path_t path>
+void run(benchmark::State& state, ExecutorType* executorPtr, int ti, index_t m,
+         index_t n, scalar_t alpha, scalar_t beta, bool* success) {
+  // Standard test setup.
+  std::string ts = blas_benchmark::utils::from_transpose_enum(
+      static_cast<blas_benchmark::utils::Transposition>(ti));
+  const char* t_str = ts.c_str();
+
+  index_t xlen = t_str[0] == 'n' ? n : m;
+  index_t ylen = t_str[0] == 'n' ? m : n;
+
+  // The counters are double. We convert m, n and batch_size to double to avoid
+  // integer overflows for n_fl_ops and bytes_processed
+  double m_d = static_cast<double>(m);
+  double n_d = static_cast<double>(n);
+  double batch_size_d = static_cast<double>(batch_size);
+
+  state.counters["m"] = m_d;
+  state.counters["n"] = n_d;
+  state.counters["batch_size"] = batch_size_d;
+
+  {
+    double nflops_AtimesX = 2.0 * m_d * n_d;
+    double nflops_timesAlpha = ylen;
+    double nflops_addBetaY = (beta != scalar_t{0}) ? 2 * ylen : 0;
+    state.counters["n_fl_ops"] =
+        (nflops_AtimesX + nflops_timesAlpha + nflops_addBetaY) * batch_size_d;
+  }
+  {
+    double mem_readA = m_d * n_d;
+    double mem_readX = xlen;
+    double mem_writeY = ylen;
+    double mem_readY = (beta != scalar_t{0}) ? ylen : 0;
+    state.counters["bytes_processed"] =
+        (mem_readA + mem_readX + mem_writeY + mem_readY) * batch_size_d *
+        sizeof(scalar_t);
+  }
+
+  ExecutorType& ex = *executorPtr;
+
+  using data_t = utils::data_storage_t<scalar_t>;
+
+  // Input matrices/vectors, output vectors, stored one after the other
+  std::vector<data_t> m_a =
+      blas_benchmark::utils::random_data<data_t>(m * n * batch_size);
+  std::vector<data_t> v_x =
+      blas_benchmark::utils::random_data<data_t>(xlen * batch_size);
+  std::vector<data_t> v_y =
+      blas_benchmark::utils::random_data<data_t>(ylen * batch_size);
+
+#ifdef BLAS_VERIFY_BENCHMARK
+  std::vector<data_t> v_y_ref = v_y;
+  for (index_t b = 0; b < batch_size; b++) {
+    reference_blas::gemv(t_str, m, n, static_cast<data_t>(alpha),
+                         m_a.data() + b * m * n, m, v_x.data() + b * xlen, 1,
+                         static_cast<data_t>(beta), v_y_ref.data() + b * ylen,
+                         1);
+  }
+#endif
+
+  if (path == path_t::interleaved) {
+    m_a = strided_to_interleaved(m_a, m * n);
+    v_x = strided_to_interleaved(v_x, xlen);
+    v_y = strided_to_interleaved(v_y, ylen);
+#ifdef BLAS_VERIFY_BENCHMARK
+    v_y_ref = strided_to_interleaved(v_y_ref, ylen);
+#endif
+  }
+
+  auto m_a_gpu = utils::make_quantized_buffer<scalar_t>(ex, m_a);
+  auto v_x_gpu = utils::make_quantized_buffer<scalar_t>(ex, v_x);
+  auto v_y_gpu = utils::make_quantized_buffer<scalar_t>(ex, v_y);
+
+#ifdef BLAS_VERIFY_BENCHMARK
+  // Run a first time with a verification of the results
+  std::vector<data_t> v_y_temp = v_y;
+  {
+    auto v_y_temp_gpu = utils::make_quantized_buffer<scalar_t>(ex, v_y_temp);
+    auto event = launch_gemv<path>(ex, *t_str, m, n, alpha, m_a_gpu, v_x_gpu,
+                                   beta, v_y_temp_gpu);
+    ex.get_policy_handler().wait(event);
+    event = utils::quantized_copy_to_host<scalar_t>(ex, v_y_temp_gpu, v_y_temp);
+    ex.get_policy_handler().wait(event);
+  }
+
+  std::ostringstream err_stream;
+  if (!utils::compare_vectors<data_t, scalar_t>(v_y_temp, v_y_ref, err_stream,
+                                                "")) {
+    const std::string& err_str = err_stream.str();
+    state.SkipWithError(err_str.c_str());
+    *success = false;
+  };
+#endif
+
+  auto blas_method_def = [&]() -> std::vector<cl::sycl::event> {
+    auto event = launch_gemv<path>(ex, *t_str, m, n, alpha, m_a_gpu, v_x_gpu,
+                                   beta, v_y_gpu);
+    ex.get_policy_handler().wait(event);
+    return event;
+  };
+
+  // Warmup
+  blas_benchmark::utils::warmup(blas_method_def);
+  ex.get_policy_handler().wait();
+
+  // Number of kernels launched by one run
+  state.counters["n_kernels"] = static_cast<double>(blas_method_def().size());
+
+  blas_benchmark::utils::init_counters(state);
+
+  // Measure
+  for (auto _ : state) {
+    // Run
+    std::tuple<double, double> times =
+        blas_benchmark::utils::timef(blas_method_def);
+
+    // Report
+    blas_benchmark::utils::update_counters(state, times);
+  }
+
+  blas_benchmark::utils::calc_avg_counters(state);
+}
+
+template <typename scalar_t, path_t path>
+void register_path(std::vector<blas2_param_t<scalar_t>>& params,
+                   ExecutorType* exPtr, bool* success) {
+  for (auto p : params) {
+    std::string ts;
+    index_t m, n;
+    scalar_t alpha, beta;
+    std::tie(ts, m, n, alpha, beta) = p;
+    int t = static_cast<int>(blas_benchmark::utils::to_transpose_enum(ts));
+
+    auto BM_lambda = [&](benchmark::State& st, ExecutorType* exPtr, int t,
+                         index_t m, index_t n, scalar_t alpha, scalar_t beta,
+                         bool* success) {
+      run<scalar_t, path>(st, exPtr, t, m, n, alpha, beta, success);
+    };
+    benchmark::RegisterBenchmark(get_name<scalar_t>(ts, m, n, path).c_str(),
+                                 BM_lambda, exPtr, t, m, n, alpha, beta,
+                                 success);
+  }
+}
+
+template <typename scalar_t>
+void register_benchmark(blas_benchmark::Args& args, ExecutorType* exPtr,
+                        bool* success) {
+  // The default sizes are small matrices, for which launching one GEMV per
+  // matrix leaves the device mostly idle
+  std::vector<blas2_param_t<scalar_t>> batched_params;
+  if (args.csv_param.empty()) {
+    for (std::string t : {"n", "t"}) {
+      for (index_t m = 16; m <= 256; m *= 4) {
+        for (index_t n = 16; n <= 256; n *= 4) {
+          batched_params.push_back(
+              std::make_tuple(t, m, n, scalar_t{1}, scalar_t{0}));
+        }
+      }
+    }
+  } else {
+    batched_params = blas_benchmark::utils::get_blas2_params<scalar_t>(args);
+  }
+
+  register_path<scalar_t, path_t::looped>(batched_params, exPtr, success);
+  register_path<scalar_t, path_t::strided>(batched_params, exPtr, success);
+  register_path<scalar_t, path_t::interleaved>(batched_params, exPtr, success);
+}
+
+namespace blas_benchmark {
+void create_benchmark(blas_benchmark::Args& args, ExecutorType* exPtr,
+                      bool* success) {
+  BLAS_REGISTER_BENCHMARK(args, exPtr, success);
+}
+}  // namespace blas_benchmark
@@ -26,6 +26,9 @@
 set(executor_list "PolicyHandler<codeplay_policy>")
 #represent the list of supported index/increment type
 set(index_list "int" )
+if(BLAS_ENABLE_64BIT_INDEX)
+  list(APPEND index_list "int64_t")
+endif()
 
 # BLAS_DATA_TYPES was provided by the user
 #Each data type in a data list determines the container types.
@@ -41,6 +44,20 @@ function(cpp_type output data)
   set(${output} "${data}" PARENT_SCOPE)
 endfunction()
 
+# Pairs of storage and accumulation types of the mixed precision operations,
+# each written as storage:accumulator
+set(mixed_precision_list "")
+if("half" IN_LIST data_list)
+  list(APPEND mixed_precision_list "half:float")
+endif()
+if("double" IN_LIST data_list)
+  list(APPEND mixed_precision_list "float:double")
+endif()
+
+# Output types of the int8 GEMM, whose inputs are always int8 and whose
+# accumulators are int32
+set(int8_gemm_output_list "int32_t" "int8_t" "uint8_t")
+
 ## represent the list of bolean options
 set(boolean_list "true" "false")
 
@@ -80,11 +97,25 @@ function(set_target_compile_def in_target)
     message(STATUS "Tall and skinny Gemm support enabled for target ${in_target}")
     target_compile_definitions(${in_target} PUBLIC GEMM_TALL_SKINNY_SUPPORT=1)
   endif()
+  #setting the tuned gemm dispatch table
+  if(BLAS_GEMM_TUNING_RESULTS)
+    target_compile_definitions(${in_target} PUBLIC SYCL_BLAS_GEMM_TUNED_TABLE=1)
+    target_include_directories(${in_target} PUBLIC ${SYCLBLAS_GENERATED_SRC}/include)
+  endif()
   #setting vectorization support
   if(${GEMM_VECTORIZATION_SUPPORT})
     message(STATUS "Gemm vectorization support enabled for target ${in_target}")
     target_compile_definitions(${in_target} PUBLIC GEMM_VECTORIZATION_SUPPORT=1)
   endif()
+  #setting split-K support
+  if(${GEMM_SPLIT_K_SUPPORT})
+    message(STATUS "Split-K Gemm support enabled for target ${in_target}")
+    target_compile_definitions(${in_target} PUBLIC GEMM_SPLIT_K_SUPPORT=1)
+  endif()
+  #setting the single pass reductions
+  if(${BLAS_ENABLE_SINGLE_PASS_REDUCTION})
+    target_compile_definitions(${in_target} PUBLIC SINGLE_PASS_REDUCTION_SUPPORT=1)
+  endif()
   #Set optimized model configs
   if(${BLAS_MODEL_OPTIMIZATION} STREQUAL "RESNET_50")
     target_compile_definitions(${in_target} PUBLIC MODEL_RESNET_50=1)
@@ -103,7 +134,7 @@ foreach(executor ${executor_list})
     set(container_list "BufferIterator<${cpp_data},codeplay_policy>")
     foreach(index ${index_list})
       foreach(container0 ${container_list})
-        foreach(increment ${index_list})
+        foreach(increment ${index})
           sanitize_file_name(file_name
             "${func}_${executor}_${data}_${index}_${container0}_${increment}.cpp")
           add_custom_command(OUTPUT "${LOCATION}/${file_name}"
@@ -150,7 +181,7 @@ foreach(executor ${executor_list})
       foreach(container0 ${container_list})
         foreach(container1 ${container_list})
           set(container_names "${container0}_${container1}")
-          foreach(increment ${index_list})
+          foreach(increment ${index})
             sanitize_file_name(file_name
               "${func}_${executor}_${data}_${index}_${container_names}_${increment}.cpp")
             add_custom_command(OUTPUT "${LOCATION}/${file_name}"
@@ -202,7 +233,7 @@ foreach(executor ${executor_list})
       foreach(container0 ${container_list_in})
         foreach(container1 ${container_list_out})
           set(container_names "${container0}_${container1}")
-          foreach(increment ${index_list})
+          foreach(increment ${index})
             sanitize_file_name(file_name
               "${func}_${executor}_${data}_${index}_${container_names}_${increment}.cpp")
             add_custom_command(OUTPUT "${LOCATION}/${file_name}"
@@ -254,7 +285,7 @@ foreach(executor ${executor_list})
           foreach(container2 ${container_list})
             set(container_names
               "${container0}_${container1}_${container2}")
-            foreach(increment ${index_list})
+            foreach(increment ${index})
               sanitize_file_name(file_name
                 "${func}_${executor}_${data}_${index}_${container_names}_${increment}.cpp")
               add_custom_command(OUTPUT "${LOCATION}/${file_name}"
@@ -294,6 +325,112 @@ add_sycl_to_target(TARGET ${func} SOURCES ${FUNC_SRC})
 endfunction(generate_blas_ternary_objects)
 
 
+# blas function for generating source code of the mixed precision operations
+# (reductions and GEMM), with the inputs stored in one type and the results
+# accumulated in a wider one. Nothing is generated when no pair of enabled
+# types allows it.
+function(generate_blas_mixed_precision_objects blas_level func)
+if(NOT mixed_precision_list)
+  return()
+endif()
+set(LOCATION "${SYCLBLAS_GENERATED_SRC}/${blas_level}/${func}/")
+foreach(executor ${executor_list})
+  foreach(pair ${mixed_precision_list})
+    string(REPLACE ":" ";" pair_types ${pair})
+    list(GET pair_types 0 data)
+    list(GET pair_types 1 acc_data)
+    cpp_type(cpp_data ${data})
+    cpp_type(cpp_acc_data ${acc_data})
+    set(container0 "BufferIterator<${cpp_data},codeplay_policy>")
+    set(container1 "BufferIterator<${cpp_data},codeplay_policy>")
+    set(container2 "BufferIterator<${cpp_acc_data},codeplay_policy>")
+    set(container_names "${container0}_${container1}_${container2}")
+    foreach(index ${index_list})
+      foreach(increment ${index})
+        sanitize_file_name(file_name
+          "${func}_${executor}_${data}_${acc_data}_${index}_${container_names}_${increment}.cpp")
+        add_custom_command(OUTPUT "${LOCATION}/${file_name}"
+          COMMAND ${PYTHON_EXECUTABLE} ${SYCLBLAS_SRC_GENERATOR}/py_gen_blas_ternary.py
+            ${PROJECT_SOURCE_DIR}/external/
+            ${SYCLBLAS_SRC_GENERATOR}/gen
+            ${blas_level}
+            ${func}
+            ${SYCLBLAS_SRC}/interface/${blas_level}/${func}.cpp.in
+            ${executor}
+            ${cpp_data}
+            ${index}
+            ${increment}
+            ${container0}
+            ${container1}
+            ${container2}
+            ${file_name}
+          MAIN_DEPENDENCY ${SYCLBLAS_SRC}/interface/${blas_level}/${func}.cpp.in
+          DEPENDS ${SYCLBLAS_SRC_GENERATOR}/py_gen_blas_ternary.py
+          WORKING_DIRECTORY ${PROJECT_BINARY_DIR}
+          VERBATIM
+        )
+        list(APPEND FUNC_SRC "${LOCATION}/${file_name}")
+      endforeach(increment)
+    endforeach(index)
+  endforeach(pair)
+endforeach(executor)
+add_library(${func} OBJECT ${FUNC_SRC})
+set_target_compile_def(${func})
+target_include_directories(${func} PRIVATE ${SYCLBLAS_SRC} ${SYCLBLAS_INCLUDE}
+                           ${SYCLBLAS_COMMON_INCLUDE_DIR} ${THIRD_PARTIES_INCLUDE})
+message(STATUS "Adding SYCL to target ${func}")
+add_sycl_to_target(TARGET ${func} SOURCES ${FUNC_SRC})
+endfunction(generate_blas_mixed_precision_objects)
+
+
+# blas function for generating source code of the int8 GEMM, with A and B
+# stored in int8 and C in each type of int8_gemm_output_list
+function(generate_blas_int8_gemm_objects blas_level func)
+set(LOCATION "${SYCLBLAS_GENERATED_SRC}/${blas_level}/${func}/")
+foreach(executor ${executor_list})
+  foreach(out_data ${int8_gemm_output_list})
+    set(container0 "BufferIterator<int8_t,codeplay_policy>")
+    set(container1 "BufferIterator<int8_t,codeplay_policy>")
+    set(container2 "BufferIterator<${out_data},codeplay_policy>")
+    set(container_names "${container0}_${container1}_${container2}")
+    foreach(index ${index_list})
+      foreach(increment ${index})
+        sanitize_file_name(file_name
+          "${func}_${executor}_int8_t_${out_data}_${index}_${container_names}_${increment}.cpp")
+        add_custom_command(OUTPUT "${LOCATION}/${file_name}"
+          COMMAND ${PYTHON_EXECUTABLE} ${SYCLBLAS_SRC_GENERATOR}/py_gen_blas_ternary.py
+            ${PROJECT_SOURCE_DIR}/external/
+            ${SYCLBLAS_SRC_GENERATOR}/gen
+            ${blas_level}
+            ${func}
+            ${SYCLBLAS_SRC}/interface/${blas_level}/${func}.cpp.in
+            ${executor}
+            int8_t
+            ${index}
+            ${increment}
+            ${container0}
+            ${container1}
+            ${container2}
+            ${file_name}
+          MAIN_DEPENDENCY ${SYCLBLAS_SRC}/interface/${blas_level}/${func}.cpp.in
+          DEPENDS ${SYCLBLAS_SRC_GENERATOR}/py_gen_blas_ternary.py
+          WORKING_DIRECTORY ${PROJECT_BINARY_DIR}
+          VERBATIM
+        )
+        list(APPEND FUNC_SRC "${LOCATION}/${file_name}")
+      endforeach(increment)
+    endforeach(index)
+  endforeach(out_data)
+endforeach(executor)
+add_library(${func} OBJECT ${FUNC_SRC})
+set_target_compile_def(${func})
+target_include_directories(${func} PRIVATE ${SYCLBLAS_SRC} ${SYCLBLAS_INCLUDE}
+                           ${SYCLBLAS_COMMON_INCLUDE_DIR} ${THIRD_PARTIES_INCLUDE})
+message(STATUS "Adding SYCL to target ${func}")
+add_sycl_to_target(TARGET ${func} SOURCES ${FUNC_SRC})
+endfunction(generate_blas_int8_gemm_objects)
+
+
 # blas gemm function for generating source code
 function(generate_blas_gemm_objects blas_level func)
 set(LOCATION "${SYCLBLAS_GENERATED_SRC}/${blas_level}/${func}/")
@@ -349,6 +486,10 @@ function(add_gemm_configuration
                             "${item_batch}_${wg_batch}_"
                             "${wg_size}_${cache_line_size}.cpp")
               sanitize_file_name(file_name "${file_name}")
+              if("${LOCATION}/${file_name}" IN_LIST gemm_sources)
+                # Already added, e.g. by the tuned dispatch table
+                continue()
+              endif()
               add_custom_command(OUTPUT "${LOCATION}/${file_name}"
                 COMMAND ${PYTHON_EXECUTABLE} ${SYCLBLAS_SRC_GENERATOR}/py_gen_blas_gemm_launcher.py
                   ${PROJECT_SOURCE_DIR}/external/
@@ -396,6 +537,24 @@ function(add_gemm_configuration
     endforeach(trans_b)
   endforeach(trans_a)
 endfunction()
+if(BLAS_GEMM_TUNING_RESULTS)
+  # The dispatch table header and the configurations it uses are generated
+  # from the auto-tuner results at configure time
+  set(tuned_cmake "${SYCLBLAS_GENERATED_SRC}/gemm_tuned_configurations.cmake")
+  file(MAKE_DIRECTORY "${SYCLBLAS_GENERATED_SRC}/include")
+  execute_process(
+    COMMAND ${PYTHON_EXECUTABLE}
+      ${PROJECT_SOURCE_DIR}/tools/auto_tuner/gen/generate_dispatch_table.py
+      ${BLAS_GEMM_TUNING_RESULTS}
+      ${SYCLBLAS_GENERATED_SRC}/include/gemm_tuned_table.hpp
+      ${tuned_cmake}
+    RESULT_VARIABLE tuned_exitcode
+  )
+  if(NOT ${tuned_exitcode} EQUAL 0)
+    message(FATAL_ERROR "Failed to generate the tuned GEMM dispatch table")
+  endif()
+  include(${tuned_cmake})
+endif()
 if(${TARGET} STREQUAL "INTEL_GPU")
   set(supported_types
     "float"
@@ -712,32 +871,55 @@ endfunction(generate_quantize)
 
 
 function (build_library LIB_NAME)
+# The mixed precision objects only exist when a wider type is enabled
+set(mixed_precision_objects "")
+if(TARGET mixed_precision)
+  list(APPEND mixed_precision_objects $<TARGET_OBJECTS:mixed_precision>)
+endif()
+if(TARGET gemm_mixed_precision)
+  list(APPEND mixed_precision_objects $<TARGET_OBJECTS:gemm_mixed_precision>)
+endif()
 add_library(${LIB_NAME}
                              $<TARGET_OBJECTS:sycl_policy>
                              $<TARGET_OBJECTS:quantize>
                              $<TARGET_OBJECTS:axpy>
                              $<TARGET_OBJECTS:asum>
                              $<TARGET_OBJECTS:asum_return>
+                             $<TARGET_OBJECTS:asum_batched>
                              $<TARGET_OBJECTS:copy>
                              $<TARGET_OBJECTS:dot>
                              $<TARGET_OBJECTS:dot_return>
+                             $<TARGET_OBJECTS:dot_nrm2_asum>
+                             $<TARGET_OBJECTS:dot_batched>
+                             $<TARGET_OBJECTS:sdsdot>
                              $<TARGET_OBJECTS:iamax>
                              $<TARGET_OBJECTS:iamax_return>
+                             $<TARGET_OBJECTS:iamax_batched>
                              $<TARGET_OBJECTS:iamin>
                              $<TARGET_OBJECTS:iamin_return>
                              $<TARGET_OBJECTS:nrm2>
                              $<TARGET_OBJECTS:nrm2_return>
+                             $<TARGET_OBJECTS:nrm2_batched>
                              $<TARGET_OBJECTS:rot>
                              $<TARGET_OBJECTS:scal>
                              $<TARGET_OBJECTS:swap>
+                             $<TARGET_OBJECTS:gbmv>
                              $<TARGET_OBJECTS:gemv>
                              $<TARGET_OBJECTS:ger>
+                             $<TARGET_OBJECTS:sbmv>
+                             $<TARGET_OBJECTS:spmv>
                              $<TARGET_OBJECTS:symv>
                              $<TARGET_OBJECTS:syr>
                              $<TARGET_OBJECTS:syr2>
+                             $<TARGET_OBJECTS:tbmv>
+                             $<TARGET_OBJECTS:tbsv>
+                             $<TARGET_OBJECTS:tpmv>
                              $<TARGET_OBJECTS:trmv>
+                             $<TARGET_OBJECTS:trsv>
                              $<TARGET_OBJECTS:gemm_launcher>
                              $<TARGET_OBJECTS:gemm>
+                             $<TARGET_OBJECTS:gemm_int8>
                              $<TARGET_OBJECTS:trsm>
+                             ${mixed_precision_objects}
                             )
 endfunction(build_library)
@@ -234,6 +234,14 @@ void trmv(const char *uplo, const char *trans, const char *diag, const int n,
        x, incX);
 }
 
+template <typename scalar_t>
+void trsv(const char *uplo, const char *trans, const char *diag, const int n,
+          const scalar_t *a, const int lda, scalar_t *x, const int incX) {
+  auto func = blas_system_function<scalar_t>(&cblas_strsv, &cblas_dtrsv);
+  func(CblasColMajor, c_uplo(*uplo), c_trans(*trans), c_diag(*diag), n, a, lda,
+       x, incX);
+}
+
 template <typename scalar_t>
 void syr(const char *uplo, const int n, const scalar_t alpha, const scalar_t *x,
          const int incX, scalar_t *a, const int lda) {
@@ -257,6 +265,58 @@ void symv(const char *uplo, const int n, const scalar_t alpha,
   func(CblasColMajor, c_uplo(*uplo), n, alpha, a, lda, x, incX, beta, y, incY);
 }
 
+template <typename scalar_t>
+void gbmv(const char *trans, int m, int n, int kl, int ku, scalar_t alpha,
+          const scalar_t a[], int lda, const scalar_t x[], int incX,
+          scalar_t beta, scalar_t y[], int incY) {
+  auto func = blas_system_function<scalar_t>(&cblas_sgbmv, &cblas_dgbmv);
+  func(CblasColMajor, c_trans(*trans), m, n, kl, ku, alpha, a, lda, x, incX,
+       beta, y, incY);
+}
+
+template <typename scalar_t>
+void sbmv(const char *uplo, const int n, const int k, const scalar_t alpha,
+          const scalar_t *a, const int lda, const scalar_t *x, const int incX,
+          const scalar_t beta, scalar_t *y, const int incY) {
+  auto func = blas_system_function<scalar_t>(&cblas_ssbmv, &cblas_dsbmv);
+  func(CblasColMajor, c_uplo(*uplo), n, k, alpha, a, lda, x, incX, beta, y,
+       incY);
+}
+
+template <typename scalar_t>
+void spmv(const char *uplo, const int n, const scalar_t alpha,
+          const scalar_t *ap, const scalar_t *x, const int incX,
+          const scalar_t beta, scalar_t *y, const int incY) {
+  auto func = blas_system_function<scalar_t>(&cblas_sspmv, &cblas_dspmv);
+  func(CblasColMajor, c_uplo(*uplo), n, alpha, ap, x, incX, beta, y, incY);
+}
+
+template <typename scalar_t>
+void tbmv(const char *uplo, const char *trans, const char *diag, const int n,
+          const int k, const scalar_t *a, const int lda, scalar_t *x,
+          const int incX) {
+  auto func = blas_system_function<scalar_t>(&cblas_stbmv, &cblas_dtbmv);
+  func(CblasColMajor, c_uplo(*uplo), c_trans(*trans), c_diag(*diag), n, k, a,
+       lda, x, incX);
+}
+
+template <typename scalar_t>
+void tpmv(const char *uplo, const char *trans, const char *diag, const int n,
+          const scalar_t *ap, scalar_t *x, const int incX) {
+  auto func = blas_system_function<scalar_t>(&cblas_stpmv, &cblas_dtpmv);
+  func(CblasColMajor, c_uplo(*uplo), c_trans(*trans), c_diag(*diag), n, ap, x,
+       incX);
+}
+
+template <typename scalar_t>
+void tbsv(const char *uplo, const char *trans, const char *diag, const int n,
+          const int k, const scalar_t *a, const int lda, scalar_t *x,
+          const int incX) {
+  auto func = blas_system_function<scalar_t>(&cblas_stbsv, &cblas_dtbsv);
+  func(CblasColMajor, c_uplo(*uplo), c_trans(*trans), c_diag(*diag), n, k, a,
+       lda, x, incX);
+}
+
 // =======
 // Level 3
 // =======
@@ -26,6 +26,8 @@
 #ifndef SYCL_BLAS_META_H
 #define SYCL_BLAS_META_H
 
+#include <cstdint>
+#include <limits>
 #include <type_traits>
 #include <utility>
 
@@ -103,6 +105,36 @@ inline bool is_power_of_2(index_t ind) {
   return ind > 0 && !(ind & (ind - 1));
 }
 
+/*!
+ * @brief Whether all the given extents (sizes, or sizes times strides) of an
+ * operation can be represented by an int.
+ *
+ * The operations instantiated for a 64-bit index dispatch the problems that
+ * pass this check to their int instantiation, as the index arithmetic of the
+ * kernels is cheaper in 32 bits.
+ */
+template <typename index_t>
+inline bool fits_in_int(index_t extent) {
+  return static_cast<int64_t>(extent) <=
+             static_cast<int64_t>(std::numeric_limits<int>::max()) &&
+         static_cast<int64_t>(extent) >=
+             static_cast<int64_t>(std::numeric_limits<int>::min());
+}
+
+template <typename index_t, typename... extents_t>
+inline bool fits_in_int(index_t extent, extents_t... extents) {
+  return fits_in_int(extent) && fits_in_int(extents...);
+}
+
+/*!
+ * @brief Whether an operation with the given index type and extents should
+ * run its int instantiation instead.
+ */
+template <typename index_t, typename... extents_t>
+inline bool use_int_index(extents_t... extents) {
+  return sizeof(index_t) > sizeof(int) && fits_in_int(extents...);
+}
+
 // This function returns the nearest power of 2
 // if roundup is true returns result>=wgsize
 // else it return result <= wgsize
@@ -0,0 +1,142 @@
+/***************************************************************************
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename scalar_future.h
+ *
+ **************************************************************************/
+
+#ifndef SYCL_BLAS_SCALAR_FUTURE_H
+#define SYCL_BLAS_SCALAR_FUTURE_H
+
+#include "blas_meta.h"
+#include "operations/blas_constants.h"
+#include "policy/sycl_policy.h"
+#include <CL/sycl.hpp>
+#include <memory>
+
+namespace blas {
+
+/*!
+ * @brief Result of a BLAS-1 reduction that is still being computed.
+ *
+ * The scalar returning operations (dot, asum, nrm2, iamax, iamin) enqueue the
+ * reduction and the copy of its result to a host slot owned by the future, and
+ * return straight away. The host only blocks when the value is read, so more
+ * work can be enqueued in the meantime.
+ *
+ * Copies of a scalar_future share the same host slot and events. The last
+ * copy to be destroyed waits for the pending events, so that the copy to the
+ * host never writes to a slot that has been freed, even when the future is
+ * discarded without being read.
+ *
+ * @tparam value_t Type of the value returned to the user
+ * @tparam stored_t Type of the value computed on the device. For iamax and
+ * iamin this is an IndexValueTuple of which only the index is returned.
+ */
+template <typename value_t, typename stored_t = value_t>
+class scalar_future {
+ public:
+  using event_t = typename codeplay_policy::event_t;
+
+  /*!
+   * @brief Creates a future with its host slot holding init_val.
+   */
+  explicit scalar_future(const stored_t &init_val)
+      : state_(std::make_shared<state_t>(init_val)) {}
+
+  /*!
+   * @brief Pointer to the host slot the result is copied to.
+   */
+  inline stored_t *data() { return &state_->value; }
+
+  /*!
+   * @brief Adds events that must complete before the value can be read.
+   */
+  inline void add_events(const event_t &events) {
+    state_->events.insert(state_->events.end(), events.begin(),
+                          events.end());
+  }
+
+  /*!
+   * @brief Returns the events the value depends on.
+   */
+  inline event_t get_events() const { return state_->events; }
+
+  /*!
+   * @brief Returns whether the value can be read without blocking.
+   */
+  inline bool is_ready() const {
+    for (auto &event : state_->events) {
+      if (event.template get_info<
+              cl::sycl::info::event::command_execution_status>() !=
+          cl::sycl::info::event_command_status::complete) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  /*!
+   * @brief Blocks until the value has been copied to the host.
+   */
+  inline void wait() {
+    state_->wait();
+  }
+
+  /*!
+   * @brief Blocks until the value has been copied to the host and returns it.
+   */
+  inline value_t get() {
+    wait();
+    return extract(state_->value);
+  }
+
+ private:
+  /*!
+   * @brief Host slot and events shared by the copies of a future.
+   */
+  struct state_t {
+    explicit state_t(const stored_t &init_val) : value(init_val), events{} {}
+
+    ~state_t() { wait(); }
+
+    inline void wait() {
+      cl::sycl::event::wait(events);
+      events.clear();
+    }
+
+    stored_t value;
+    event_t events;
+  };
+
+  static inline value_t extract(const value_t &val) { return val; }
+
+  template <typename index_t, typename element_t>
+  static inline index_t extract(
+      const IndexValueTuple<index_t, element_t> &tuple) {
+    return tuple.get_index();
+  }
+
+  std::shared_ptr<state_t> state_;
+};
+
+}  // namespace blas
+
+#endif  // SYCL_BLAS_SCALAR_FUTURE_H
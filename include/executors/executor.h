@@ -26,6 +26,7 @@
 #ifndef SYCL_BLAS_EXECUTOR_H
 #define SYCL_BLAS_EXECUTOR_H
 #include "blas_meta.h"
+#include "executors/expression_graph.h"
 #include "operations/blas1_trees.h"
 #include "operations/blas2_trees.h"
 #include "operations/blas3_trees.h"
@@ -71,15 +72,20 @@ class Executor {
   typename policy_t::event_t execute(
       AssignReduction<operator_t, lhs_t, rhs_t> t, local_memory_t scr);
 
+  template <typename lhs_t, typename operands_t, typename reductions_t>
+  typename policy_t::event_t execute(
+      MultiAssignReduction<lhs_t, operands_t, reductions_t> t);
+
   template <typename input_t, typename output_t, bool DoubleBuffer, bool NbcA,
             bool NbcB, int ClSize, typename tile_type, bool TransA, bool TransB,
             typename element_t, bool is_beta_zero, int GemmMemoryType,
             int GemmAlgorithm, int GemmVectorization, int VectorSize,
-            int BatchType>
+            int BatchType, typename epilogue_t>
   typename policy_t::event_t execute(
       Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type,
            TransA, TransB, element_t, is_beta_zero, GemmMemoryType,
-           GemmAlgorithm, GemmVectorization, VectorSize, BatchType>
+           GemmAlgorithm, GemmVectorization, VectorSize, BatchType,
+           epilogue_t>
           gemm_tree);
 
   // Tall and skinny Gemm specialization
@@ -105,6 +111,29 @@ class Executor {
                   GemmMemoryType>
           gemm_partial);
 
+  // GemmGrouped specialization
+  template <typename input_t, typename output_t, typename schedule_t,
+            typename tile_type, bool TransA, bool TransB, typename element_t,
+            bool is_beta_zero>
+  typename policy_t::event_t execute(
+      GemmGrouped<input_t, output_t, schedule_t, tile_type, TransA, TransB,
+                  element_t, is_beta_zero>
+          gemm_grouped);
+
+  /*!
+   * @brief Starts recording trees instead of executing them, see
+   * ExpressionGraph.
+   */
+  inline ExpressionGraph<> begin_capture() const { return ExpressionGraph<>(); }
+
+  /*!
+   * @brief Submits the trees recorded in graph with as few kernels as
+   * possible.
+   */
+  template <typename... expression_tree_t>
+  typename policy_t::event_t end_capture(
+      ExpressionGraph<expression_tree_t...> graph);
+
   // Reduction specialization (partial rows)
   template <typename operator_t, typename input_t, typename output_t,
             int ClSize, int WgSize, typename element_t>
@@ -0,0 +1,238 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename expression_graph.h
+ *
+ **************************************************************************/
+
+#ifndef SYCL_BLAS_EXPRESSION_GRAPH_H
+#define SYCL_BLAS_EXPRESSION_GRAPH_H
+
+#include "operations/blas1_trees.h"
+#include "views/view.h"
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+namespace blas {
+
+/*!
+ * @brief Whether evaluating the operand at an index only reads the elements
+ * at that index. Views, and scalar, unary and binary operations of such
+ * operands, are the only ones that do; any other node (a device scalar, a
+ * strided batch, a reduction, ...) may read elements written by another work
+ * item of a joined kernel.
+ */
+template <typename operand_t>
+struct reads_own_index : std::false_type {};
+
+template <typename value_t, typename container_t, typename index_t,
+          typename increment_t>
+struct reads_own_index<VectorView<value_t, container_t, index_t, increment_t>>
+    : std::true_type {};
+
+template <typename value_t, typename container_t, typename index_t,
+          typename layout_t>
+struct reads_own_index<MatrixView<value_t, container_t, index_t, layout_t>>
+    : std::true_type {};
+
+template <typename operator_t, typename scalar_t, typename rhs_t>
+struct reads_own_index<ScalarOp<operator_t, scalar_t, rhs_t>>
+    : reads_own_index<rhs_t> {};
+
+template <typename operator_t, typename view_t, typename rhs_t>
+struct reads_own_index<ScalarOp<operator_t, DeviceScalar<view_t>, rhs_t>>
+    : std::false_type {};
+
+template <typename operator_t, typename rhs_t>
+struct reads_own_index<UnaryOp<operator_t, rhs_t>> : reads_own_index<rhs_t> {};
+
+template <typename operator_t, typename lhs_t, typename rhs_t>
+struct reads_own_index<BinaryOp<operator_t, lhs_t, rhs_t>>
+    : std::integral_constant<bool, reads_own_index<lhs_t>::value &&
+                                       reads_own_index<rhs_t>::value> {};
+
+/*!
+ * @brief Whether every work item of the tree only accesses the elements at
+ * its own index, so that it can be joined with other such trees of the same
+ * size in a single kernel.
+ */
+template <typename expression_tree_t>
+struct is_elementwise : std::false_type {};
+
+template <typename lhs_t, typename rhs_t>
+struct is_elementwise<Assign<lhs_t, rhs_t>>
+    : std::integral_constant<bool, reads_own_index<lhs_t>::value &&
+                                       reads_own_index<rhs_t>::value> {};
+
+template <typename lhs_1_t, typename lhs_2_t, typename rhs_1_t,
+          typename rhs_2_t>
+struct is_elementwise<DoubleAssign<lhs_1_t, lhs_2_t, rhs_1_t, rhs_2_t>>
+    : std::integral_constant<bool, reads_own_index<lhs_1_t>::value &&
+                                       reads_own_index<lhs_2_t>::value &&
+                                       reads_own_index<rhs_1_t>::value &&
+                                       reads_own_index<rhs_2_t>::value> {};
+
+template <typename lhs_t, typename rhs_t>
+struct is_elementwise<Join<lhs_t, rhs_t>>
+    : std::integral_constant<bool, is_elementwise<lhs_t>::value &&
+                                       is_elementwise<rhs_t>::value> {};
+
+/*!
+ * @brief How a view of an element-wise tree maps the index i of the tree to
+ * an element of its buffer: disp + i * stride for a vector, and for a matrix
+ * of rows rows and leading dimension ld, disp + (i % rows) + (i / rows) * ld
+ * if it is column major, disp + (i % rows) * ld + (i / rows) otherwise. A
+ * contiguous column major matrix maps its indices like a vector of stride 1.
+ */
+struct view_mapping_t {
+  std::ptrdiff_t disp;
+  std::ptrdiff_t stride;  // 0 for a matrix
+  std::ptrdiff_t rows;    // 0 for a vector
+  std::ptrdiff_t ld;      // 0 for a vector
+  bool col_major;
+
+  inline bool operator==(const view_mapping_t &other) const {
+    return disp == other.disp && stride == other.stride &&
+           rows == other.rows && ld == other.ld &&
+           col_major == other.col_major;
+  }
+};
+
+/*!
+ * @brief Appends the mappings of the views used by an element-wise tree, see
+ * view_mapping_t.
+ */
+template <typename value_t, typename container_t, typename index_t,
+          typename increment_t>
+inline void append_view_mappings(
+    VectorView<value_t, container_t, index_t, increment_t> &view,
+    std::vector<view_mapping_t> &mappings) {
+  mappings.push_back({static_cast<std::ptrdiff_t>(
+                          view.get_access_displacement()),
+                      static_cast<std::ptrdiff_t>(view.get_stride()), 0, 0,
+                      false});
+}
+
+template <typename value_t, typename container_t, typename index_t,
+          typename layout_t>
+inline void append_view_mappings(
+    MatrixView<value_t, container_t, index_t, layout_t> &view,
+    std::vector<view_mapping_t> &mappings) {
+  const auto disp = static_cast<std::ptrdiff_t>(view.get_access_displacement());
+  const auto rows = static_cast<std::ptrdiff_t>(view.get_size_row());
+  const auto ld = static_cast<std::ptrdiff_t>(view.getSizeL());
+  if (layout_t::is_col_major() && ld == rows) {
+    mappings.push_back({disp, 1, 0, 0, false});
+  } else {
+    mappings.push_back({disp, 0, rows, ld, layout_t::is_col_major()});
+  }
+}
+
+template <typename operator_t, typename scalar_t, typename rhs_t>
+inline void append_view_mappings(ScalarOp<operator_t, scalar_t, rhs_t> &tree,
+                                 std::vector<view_mapping_t> &mappings) {
+  append_view_mappings(tree.rhs_, mappings);
+}
+
+template <typename operator_t, typename rhs_t>
+inline void append_view_mappings(UnaryOp<operator_t, rhs_t> &tree,
+                                 std::vector<view_mapping_t> &mappings) {
+  append_view_mappings(tree.rhs_, mappings);
+}
+
+template <typename operator_t, typename lhs_t, typename rhs_t>
+inline void append_view_mappings(BinaryOp<operator_t, lhs_t, rhs_t> &tree,
+                                 std::vector<view_mapping_t> &mappings) {
+  append_view_mappings(tree.lhs_, mappings);
+  append_view_mappings(tree.rhs_, mappings);
+}
+
+template <typename lhs_t, typename rhs_t>
+inline void append_view_mappings(Assign<lhs_t, rhs_t> &tree,
+                                 std::vector<view_mapping_t> &mappings) {
+  append_view_mappings(tree.lhs_, mappings);
+  append_view_mappings(tree.rhs_, mappings);
+}
+
+template <typename lhs_1_t, typename lhs_2_t, typename rhs_1_t,
+          typename rhs_2_t>
+inline void append_view_mappings(
+    DoubleAssign<lhs_1_t, lhs_2_t, rhs_1_t, rhs_2_t> &tree,
+    std::vector<view_mapping_t> &mappings) {
+  append_view_mappings(tree.lhs_1_, mappings);
+  append_view_mappings(tree.lhs_2_, mappings);
+  append_view_mappings(tree.rhs_1_, mappings);
+  append_view_mappings(tree.rhs_2_, mappings);
+}
+
+template <typename lhs_t, typename rhs_t>
+inline void append_view_mappings(Join<lhs_t, rhs_t> &tree,
+                                 std::vector<view_mapping_t> &mappings) {
+  append_view_mappings(tree.lhs_, mappings);
+  append_view_mappings(tree.rhs_, mappings);
+}
+
+/*! ExpressionGraph.
+ * @brief Sequence of expression trees recorded between
+ * Executor::begin_capture and Executor::end_capture.
+ *
+ * Recording a tree does not submit anything. When the capture ends,
+ * consecutive element-wise trees of the same size are joined in a single
+ * kernel and the other trees are executed as usual, in the recorded order.
+ * Joined trees would race if two views of a same buffer mapped an index to
+ * different elements. The placeholder accessors of the views do not tell
+ * which buffer they access, so consecutive trees are only joined when all
+ * their views map the indices alike (see view_mapping_t), and are executed
+ * one by one otherwise.
+ *
+ * @tparam expression_tree_t Types of the recorded trees, in recording order
+ */
+template <typename... expression_tree_t>
+class ExpressionGraph {
+ public:
+  using trees_t = std::tuple<expression_tree_t...>;
+  static constexpr size_t num_trees = sizeof...(expression_tree_t);
+
+  ExpressionGraph() = default;
+
+  explicit ExpressionGraph(const trees_t &trees) : trees_(trees) {}
+
+  /*!
+   * @brief Returns a graph with the trees of this one followed by tree.
+   */
+  template <typename new_tree_t>
+  inline ExpressionGraph<expression_tree_t..., new_tree_t> record(
+      new_tree_t tree) const {
+    return ExpressionGraph<expression_tree_t..., new_tree_t>(
+        std::tuple_cat(trees_, std::make_tuple(tree)));
+  }
+
+  inline trees_t &get_trees() { return trees_; }
+
+ private:
+  trees_t trees_;
+};
+
+}  // namespace blas
+
+#endif  // SYCL_BLAS_EXPRESSION_GRAPH_H
@@ -25,6 +25,9 @@
 #ifndef SYCL_BLAS_BLAS1_INTERFACE_H
 #define SYCL_BLAS_BLAS1_INTERFACE_H
 #include "blas_meta.h"
+#include "container/blas_iterator.h"
+#include "container/scalar_future.h"
+#include <cstdlib>
 
 namespace blas {
 namespace internal {
@@ -45,6 +48,27 @@ typename executor_t::policy_t::event_t _axpy(
     executor_t &ex, index_t _N, element_t _alpha, container_0_t _vx,
     increment_t _incx, container_1_t _vy, increment_t _incy);
 
+/**
+ * \brief AXPY with alpha stored in device memory.
+ *
+ * Alpha is read inside the kernel, so it can be the result of a previous
+ * operation (e.g. a dot) without any copy to the host.
+ *
+ * @param ex Executor
+ * @param _alpha BufferIterator to a single element
+ * @param _vx BufferIterator
+ * @param _incx Increment for the vector X
+ * @param _vy BufferIterator
+ * @param _incy Increment for the vector Y
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename element_t, typename index_t, typename increment_t>
+typename executor_t::policy_t::event_t _axpy(
+    executor_t &ex, index_t _N,
+    BufferIterator<element_t, typename executor_t::policy_t> _alpha,
+    container_0_t _vx, increment_t _incx, container_1_t _vy,
+    increment_t _incy);
+
 /**
  * \brief COPY copies a vector, x, to a vector, y.
  *
@@ -76,6 +100,42 @@ template <typename executor_t, typename container_0_t, typename container_1_t,
 typename executor_t::policy_t::event_t _dot(
     executor_t &ex, index_t _N, container_0_t _vx, increment_t _incx,
     container_1_t _vy, increment_t _incy, container_2_t _rs);
+
+/**
+ * \brief Adds _sb to the inner product of two vectors, computed in the
+ * accumulation type of their element type (see AccumulatorType), and writes
+ * the result rounded to the element type in _rs.
+ * @param ex Executor
+ * @param _sb Scalar added to the inner product
+ * @param _vx BufferIterator
+ * @param _incx Increment for the vector X
+ * @param _vy BufferIterator
+ * @param _incy Increment for the vector Y
+ * @param _rs BufferIterator receiving the result
+ */
+template <typename executor_t, typename element_t, typename container_0_t,
+          typename container_1_t, typename container_2_t, typename index_t,
+          typename increment_t>
+typename executor_t::policy_t::event_t _sdsdot(
+    executor_t &ex, index_t _N, element_t _sb, container_0_t _vx,
+    increment_t _incx, container_1_t _vy, increment_t _incy,
+    container_2_t _rs);
+
+/**
+ * \brief Computes the inner product of X and Y, the Euclidean norm of X and
+ * the sum of the absolute values of X in a single pass over the vectors.
+ * @param ex Executor
+ * @param _vx BufferIterator
+ * @param _incx Increment for the vector X
+ * @param _vy BufferIterator
+ * @param _incy Increment for the vector Y
+ * @param _rs BufferIterator receiving dot, nrm2 and asum, in this order
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename index_t, typename increment_t>
+typename executor_t::policy_t::event_t _dot_nrm2_asum(
+    executor_t &ex, index_t _N, container_0_t _vx, increment_t _incx,
+    container_1_t _vy, increment_t _incy, container_2_t _rs);
 /**
  * \brief ASUM Takes the sum of the absolute values
  * @param ex Executor
@@ -141,6 +201,20 @@ typename executor_t::policy_t::event_t _scal(executor_t &ex, index_t _N,
                                              container_0_t _vx,
                                              increment_t _incx);
 
+/**
+ * \brief SCALAR operation on a vector with alpha stored in device memory
+ * @param executor_t ex
+ * @param _alpha BufferIterator to a single element
+ * @param _vx BufferIterator
+ * @param _incx Increment for the vector X
+ */
+template <typename executor_t, typename element_t, typename container_0_t,
+          typename index_t, typename increment_t>
+typename executor_t::policy_t::event_t _scal(
+    executor_t &ex, index_t _N,
+    BufferIterator<element_t, typename executor_t::policy_t> _alpha,
+    container_0_t _vx, increment_t _incx);
+
 /**
  * \brief NRM2 Returns the euclidian norm of a vector
  * @param ex Executor
@@ -154,6 +228,72 @@ typename executor_t::policy_t::event_t _nrm2(executor_t &ex, index_t _N,
                                              increment_t _incx,
                                              container_1_t _rs);
 
+/**
+ * \brief Computes the inner products of a batch of pairs of vectors, the b-th
+ * pair starting at b * _stridex in X and b * _stridey in Y.
+ * @param ex Executor
+ * @param _vx BufferIterator
+ * @param _incx Increment for the vectors X
+ * @param _stridex Distance between two consecutive vectors X
+ * @param _vy BufferIterator
+ * @param _incy Increment for the vectors Y
+ * @param _stridey Distance between two consecutive vectors Y
+ * @param _rs BufferIterator receiving one result per pair
+ * @param _batch_size Number of pairs of vectors
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename index_t, typename increment_t>
+typename executor_t::policy_t::event_t _dot_batched(
+    executor_t &ex, index_t _N, container_0_t _vx, increment_t _incx,
+    index_t _stridex, container_1_t _vy, increment_t _incy, index_t _stridey,
+    container_2_t _rs, index_t _batch_size);
+
+/**
+ * \brief Takes the sum of the absolute values of each vector of a batch
+ * @param ex Executor
+ * @param _vx BufferIterator
+ * @param _incx Increment for the vectors X
+ * @param _stridex Distance between two consecutive vectors X
+ * @param _rs BufferIterator receiving one result per vector
+ * @param _batch_size Number of vectors
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename index_t, typename increment_t>
+typename executor_t::policy_t::event_t _asum_batched(
+    executor_t &ex, index_t _N, container_0_t _vx, increment_t _incx,
+    index_t _stridex, container_1_t _rs, index_t _batch_size);
+
+/**
+ * \brief Returns the euclidian norm of each vector of a batch
+ * @param ex Executor
+ * @param _vx BufferIterator
+ * @param _incx Increment for the vectors X
+ * @param _stridex Distance between two consecutive vectors X
+ * @param _rs BufferIterator receiving one result per vector
+ * @param _batch_size Number of vectors
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename index_t, typename increment_t>
+typename executor_t::policy_t::event_t _nrm2_batched(
+    executor_t &ex, index_t _N, container_0_t _vx, increment_t _incx,
+    index_t _stridex, container_1_t _rs, index_t _batch_size);
+
+/**
+ * \brief Finds the index of the first element having maximum absolute value
+ * in each vector of a batch. The indices are relative to the vector.
+ * @param ex Executor
+ * @param _vx BufferIterator
+ * @param _incx Increment for the vectors X
+ * @param _stridex Distance between two consecutive vectors X
+ * @param _rs BufferIterator receiving one index-value tuple per vector
+ * @param _batch_size Number of vectors
+ */
+template <typename executor_t, typename container_t, typename ContainerI,
+          typename index_t, typename increment_t>
+typename executor_t::policy_t::event_t _iamax_batched(
+    executor_t &ex, index_t _N, container_t _vx, increment_t _incx,
+    index_t _stridex, ContainerI _rs, index_t _batch_size);
+
 /**
  * @brief _rot constructor given plane rotation
  * @param ex Executor
@@ -229,6 +369,75 @@ template <typename executor_t, typename container_t, typename index_t,
           typename increment_t>
 typename ValueType<container_t>::type _nrm2(executor_t &ex, index_t _N,
                                             container_t _vx, increment_t _incx);
+
+/**
+ * \brief Compute the inner product of two vectors without blocking the host.
+ *
+ * @param ex Executor
+ * @param _vx BufferIterator
+ * @param _incx Increment for the vector X
+ * @param _vx BufferIterator
+ * @param _incy Increment for the vector Y
+ * @return Future holding the result
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename index_t, typename increment_t>
+scalar_future<typename ValueType<container_0_t>::type> _dot_async(
+    executor_t &ex, index_t _N, container_0_t _vx, increment_t _incx,
+    container_1_t _vy, increment_t _incy);
+
+/**
+ * \brief ICAMAX finds the index of the first element having maximum without
+ * blocking the host.
+ * @param _vx BufferIterator
+ * @param _incx Increment for the vector X
+ * @return Future holding the index
+ */
+template <typename executor_t, typename container_t, typename index_t,
+          typename increment_t>
+scalar_future<index_t,
+              IndexValueTuple<index_t, typename ValueType<container_t>::type>>
+_iamax_async(executor_t &ex, index_t _N, container_t _vx, increment_t _incx);
+
+/**
+ * \brief ICAMIN finds the index of the first element having minimum without
+ * blocking the host.
+ * @param _vx BufferIterator
+ * @param _incx Increment for the vector X
+ * @return Future holding the index
+ */
+template <typename executor_t, typename container_t, typename index_t,
+          typename increment_t>
+scalar_future<index_t,
+              IndexValueTuple<index_t, typename ValueType<container_t>::type>>
+_iamin_async(executor_t &ex, index_t _N, container_t _vx, increment_t _incx);
+
+/**
+ * \brief ASUM Takes the sum of the absolute values without blocking the host.
+ *
+ * @param ex Executor
+ * @param _vx BufferIterator
+ * @param _incx Increment for the vector X
+ * @return Future holding the result
+ */
+template <typename executor_t, typename container_t, typename index_t,
+          typename increment_t>
+scalar_future<typename ValueType<container_t>::type> _asum_async(
+    executor_t &ex, index_t _N, container_t _vx, increment_t _incx);
+
+/**
+ * \brief NRM2 Returns the euclidian norm of a vector without blocking the
+ * host.
+ *
+ * @param ex Executor
+ * @param _vx BufferIterator
+ * @param _incx Increment for the vector X
+ * @return Future holding the result
+ */
+template <typename executor_t, typename container_t, typename index_t,
+          typename increment_t>
+scalar_future<typename ValueType<container_t>::type> _nrm2_async(
+    executor_t &ex, index_t _N, container_t _vx, increment_t _incx);
 }  // namespace internal
 
 template <typename executor_t, typename container_0_t, typename container_1_t,
@@ -236,6 +445,14 @@ template <typename executor_t, typename container_0_t, typename container_1_t,
 typename executor_t::policy_t::event_t _axpy(
     executor_t &ex, index_t _N, element_t _alpha, container_0_t _vx,
     increment_t _incx, container_1_t _vy, increment_t _incy) {
+  if (use_int_index<index_t>(static_cast<int64_t>(_N) * std::abs(_incx),
+                             static_cast<int64_t>(_N) * std::abs(_incy))) {
+    return internal::_axpy(ex, static_cast<int>(_N), _alpha,
+                           ex.get_policy_handler().get_buffer(_vx),
+                           static_cast<int>(_incx),
+                           ex.get_policy_handler().get_buffer(_vy),
+                           static_cast<int>(_incy));
+  }
   return internal::_axpy(ex, _N, _alpha,
                          ex.get_policy_handler().get_buffer(_vx), _incx,
                          ex.get_policy_handler().get_buffer(_vy), _incy);
@@ -257,6 +474,14 @@ typename executor_t::policy_t::event_t _copy(executor_t &ex, index_t _N,
                                              increment_t _incx,
                                              container_1_t _vy,
                                              increment_t _incy) {
+  if (use_int_index<index_t>(static_cast<int64_t>(_N) * std::abs(_incx),
+                             static_cast<int64_t>(_N) * std::abs(_incy))) {
+    return internal::_copy(ex, static_cast<int>(_N),
+                           ex.get_policy_handler().get_buffer(_vx),
+                           static_cast<int>(_incx),
+                           ex.get_policy_handler().get_buffer(_vy),
+                           static_cast<int>(_incy));
+  }
   return internal::_copy(ex, _N, ex.get_policy_handler().get_buffer(_vx), _incx,
                          ex.get_policy_handler().get_buffer(_vy), _incy);
 }
@@ -275,11 +500,103 @@ template <typename executor_t, typename container_0_t, typename container_1_t,
 typename executor_t::policy_t::event_t _dot(
     executor_t &ex, index_t _N, container_0_t _vx, increment_t _incx,
     container_1_t _vy, increment_t _incy, container_2_t _rs) {
+  if (use_int_index<index_t>(static_cast<int64_t>(_N) * std::abs(_incx),
+                             static_cast<int64_t>(_N) * std::abs(_incy))) {
+    return internal::_dot(ex, static_cast<int>(_N),
+                          ex.get_policy_handler().get_buffer(_vx),
+                          static_cast<int>(_incx),
+                          ex.get_policy_handler().get_buffer(_vy),
+                          static_cast<int>(_incy),
+                          ex.get_policy_handler().get_buffer(_rs));
+  }
   return internal::_dot(ex, _N, ex.get_policy_handler().get_buffer(_vx), _incx,
                         ex.get_policy_handler().get_buffer(_vy), _incy,
                         ex.get_policy_handler().get_buffer(_rs));
 }
 
+/**
+ * \brief Computes the inner product of two vectors, accumulated in and
+ * written to the element type of _rs. The vectors can be stored in a narrower
+ * type, e.g. float vectors with a double result as in BLAS dsdot, or half
+ * vectors with a float result.
+ * @param ex Executor
+ * @param _vx BufferIterator
+ * @param _incx Increment for the vector X
+ * @param _vy BufferIterator
+ * @param _incy Increment for the vector Y
+ * @param _rs BufferIterator receiving the result
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename index_t, typename increment_t>
+typename executor_t::policy_t::event_t _dsdot(
+    executor_t &ex, index_t _N, container_0_t _vx, increment_t _incx,
+    container_1_t _vy, increment_t _incy, container_2_t _rs) {
+  return _dot(ex, _N, _vx, _incx, _vy, _incy, _rs);
+}
+
+/**
+ * \brief Adds _sb to the inner product of two vectors, computed in the
+ * accumulation type of their element type (see AccumulatorType), and writes
+ * the result rounded to the element type in _rs.
+ * @param ex Executor
+ * @param _sb Scalar added to the inner product
+ * @param _vx BufferIterator
+ * @param _incx Increment for the vector X
+ * @param _vy BufferIterator
+ * @param _incy Increment for the vector Y
+ * @param _rs BufferIterator receiving the result
+ */
+template <typename executor_t, typename element_t, typename container_0_t,
+          typename container_1_t, typename container_2_t, typename index_t,
+          typename increment_t>
+typename executor_t::policy_t::event_t _sdsdot(
+    executor_t &ex, index_t _N, element_t _sb, container_0_t _vx,
+    increment_t _incx, container_1_t _vy, increment_t _incy,
+    container_2_t _rs) {
+  if (use_int_index<index_t>(static_cast<int64_t>(_N) * std::abs(_incx),
+                             static_cast<int64_t>(_N) * std::abs(_incy))) {
+    return internal::_sdsdot(ex, static_cast<int>(_N), _sb,
+                             ex.get_policy_handler().get_buffer(_vx),
+                             static_cast<int>(_incx),
+                             ex.get_policy_handler().get_buffer(_vy),
+                             static_cast<int>(_incy),
+                             ex.get_policy_handler().get_buffer(_rs));
+  }
+  return internal::_sdsdot(ex, _N, _sb, ex.get_policy_handler().get_buffer(_vx),
+                           _incx, ex.get_policy_handler().get_buffer(_vy),
+                           _incy, ex.get_policy_handler().get_buffer(_rs));
+}
+
+/**
+ * \brief Computes the inner product of X and Y, the Euclidean norm of X and
+ * the sum of the absolute values of X in a single pass over the vectors.
+ * @param ex Executor
+ * @param _vx BufferIterator
+ * @param _incx Increment for the vector X
+ * @param _vy BufferIterator
+ * @param _incy Increment for the vector Y
+ * @param _rs BufferIterator receiving dot, nrm2 and asum, in this order
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename index_t, typename increment_t>
+typename executor_t::policy_t::event_t _dot_nrm2_asum(
+    executor_t &ex, index_t _N, container_0_t _vx, increment_t _incx,
+    container_1_t _vy, increment_t _incy, container_2_t _rs) {
+  if (use_int_index<index_t>(static_cast<int64_t>(_N) * std::abs(_incx),
+                             static_cast<int64_t>(_N) * std::abs(_incy))) {
+    return internal::_dot_nrm2_asum(ex, static_cast<int>(_N),
+                                    ex.get_policy_handler().get_buffer(_vx),
+                                    static_cast<int>(_incx),
+                                    ex.get_policy_handler().get_buffer(_vy),
+                                    static_cast<int>(_incy),
+                                    ex.get_policy_handler().get_buffer(_rs));
+  }
+  return internal::_dot_nrm2_asum(
+      ex, _N, ex.get_policy_handler().get_buffer(_vx), _incx,
+      ex.get_policy_handler().get_buffer(_vy), _incy,
+      ex.get_policy_handler().get_buffer(_rs));
+}
+
 /**
  * \brief ASUM Takes the sum of the absolute values
  * @param ex Executor
@@ -292,6 +609,12 @@ typename executor_t::policy_t::event_t _asum(executor_t &ex, index_t _N,
                                              container_0_t _vx,
                                              increment_t _incx,
                                              container_1_t _rs) {
+  if (use_int_index<index_t>(static_cast<int64_t>(_N) * std::abs(_incx))) {
+    return internal::_asum(ex, static_cast<int>(_N),
+                           ex.get_policy_handler().get_buffer(_vx),
+                           static_cast<int>(_incx),
+                           ex.get_policy_handler().get_buffer(_rs));
+  }
   return internal::_asum(ex, _N, ex.get_policy_handler().get_buffer(_vx), _incx,
                          ex.get_policy_handler().get_buffer(_rs));
 }
@@ -342,6 +665,14 @@ typename executor_t::policy_t::event_t _swap(executor_t &ex, index_t _N,
                                              increment_t _incx,
                                              container_1_t _vy,
                                              increment_t _incy) {
+  if (use_int_index<index_t>(static_cast<int64_t>(_N) * std::abs(_incx),
+                             static_cast<int64_t>(_N) * std::abs(_incy))) {
+    return internal::_swap(ex, static_cast<int>(_N),
+                           ex.get_policy_handler().get_buffer(_vx),
+                           static_cast<int>(_incx),
+                           ex.get_policy_handler().get_buffer(_vy),
+                           static_cast<int>(_incy));
+  }
   return internal::_swap(ex, _N, ex.get_policy_handler().get_buffer(_vx), _incx,
                          ex.get_policy_handler().get_buffer(_vy), _incy);
 }
@@ -358,6 +689,11 @@ typename executor_t::policy_t::event_t _scal(executor_t &ex, index_t _N,
                                              element_t _alpha,
                                              container_0_t _vx,
                                              increment_t _incx) {
+  if (use_int_index<index_t>(static_cast<int64_t>(_N) * std::abs(_incx))) {
+    return internal::_scal(ex, static_cast<int>(_N), _alpha,
+                           ex.get_policy_handler().get_buffer(_vx),
+                           static_cast<int>(_incx));
+  }
   return internal::_scal(ex, _N, _alpha,
                          ex.get_policy_handler().get_buffer(_vx), _incx);
 }
@@ -374,10 +710,131 @@ typename executor_t::policy_t::event_t _nrm2(executor_t &ex, index_t _N,
                                              container_0_t _vx,
                                              increment_t _incx,
                                              container_1_t _rs) {
+  if (use_int_index<index_t>(static_cast<int64_t>(_N) * std::abs(_incx))) {
+    return internal::_nrm2(ex, static_cast<int>(_N),
+                           ex.get_policy_handler().get_buffer(_vx),
+                           static_cast<int>(_incx),
+                           ex.get_policy_handler().get_buffer(_rs));
+  }
   return internal::_nrm2(ex, _N, ex.get_policy_handler().get_buffer(_vx), _incx,
                          ex.get_policy_handler().get_buffer(_rs));
 }
 
+/**
+ * \brief Computes the inner products of a batch of pairs of vectors, the b-th
+ * pair starting at b * _stridex in X and b * _stridey in Y. The whole batch is
+ * reduced by a single kernel.
+ * @param ex Executor
+ * @param _vx BufferIterator
+ * @param _incx Increment for the vectors X
+ * @param _stridex Distance between two consecutive vectors X
+ * @param _vy BufferIterator
+ * @param _incy Increment for the vectors Y
+ * @param _stridey Distance between two consecutive vectors Y
+ * @param _rs BufferIterator receiving one result per pair
+ * @param _batch_size Number of pairs of vectors
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename index_t, typename increment_t>
+typename executor_t::policy_t::event_t _dot_batched(
+    executor_t &ex, index_t _N, container_0_t _vx, increment_t _incx,
+    index_t _stridex, container_1_t _vy, increment_t _incy, index_t _stridey,
+    container_2_t _rs, index_t _batch_size) {
+  if (use_int_index<index_t>(
+          static_cast<int64_t>(_stridex) * _batch_size +
+              static_cast<int64_t>(_N) * std::abs(_incx),
+          static_cast<int64_t>(_stridey) * _batch_size +
+              static_cast<int64_t>(_N) * std::abs(_incy))) {
+    return internal::_dot_batched(
+        ex, static_cast<int>(_N), ex.get_policy_handler().get_buffer(_vx),
+        static_cast<int>(_incx), static_cast<int>(_stridex),
+        ex.get_policy_handler().get_buffer(_vy), static_cast<int>(_incy),
+        static_cast<int>(_stridey), ex.get_policy_handler().get_buffer(_rs),
+        static_cast<int>(_batch_size));
+  }
+  return internal::_dot_batched(
+      ex, _N, ex.get_policy_handler().get_buffer(_vx), _incx, _stridex,
+      ex.get_policy_handler().get_buffer(_vy), _incy, _stridey,
+      ex.get_policy_handler().get_buffer(_rs), _batch_size);
+}
+
+/**
+ * \brief Takes the sum of the absolute values of each vector of a batch, in a
+ * single kernel.
+ * @param ex Executor
+ * @param _vx BufferIterator
+ * @param _incx Increment for the vectors X
+ * @param _stridex Distance between two consecutive vectors X
+ * @param _rs BufferIterator receiving one result per vector
+ * @param _batch_size Number of vectors
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename index_t, typename increment_t>
+typename executor_t::policy_t::event_t _asum_batched(
+    executor_t &ex, index_t _N, container_0_t _vx, increment_t _incx,
+    index_t _stridex, container_1_t _rs, index_t _batch_size) {
+  if (use_int_index<index_t>(
+          static_cast<int64_t>(_stridex) * _batch_size +
+              static_cast<int64_t>(_N) * std::abs(_incx))) {
+    return internal::_asum_batched(
+        ex, static_cast<int>(_N), ex.get_policy_handler().get_buffer(_vx),
+        static_cast<int>(_incx), static_cast<int>(_stridex),
+        ex.get_policy_handler().get_buffer(_rs), static_cast<int>(_batch_size));
+  }
+  return internal::_asum_batched(
+      ex, _N, ex.get_policy_handler().get_buffer(_vx), _incx, _stridex,
+      ex.get_policy_handler().get_buffer(_rs), _batch_size);
+}
+
+/**
+ * \brief Returns the euclidian norm of each vector of a batch, in a single
+ * kernel.
+ * @param ex Executor
+ * @param _vx BufferIterator
+ * @param _incx Increment for the vectors X
+ * @param _stridex Distance between two consecutive vectors X
+ * @param _rs BufferIterator receiving one result per vector
+ * @param _batch_size Number of vectors
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename index_t, typename increment_t>
+typename executor_t::policy_t::event_t _nrm2_batched(
+    executor_t &ex, index_t _N, container_0_t _vx, increment_t _incx,
+    index_t _stridex, container_1_t _rs, index_t _batch_size) {
+  if (use_int_index<index_t>(
+          static_cast<int64_t>(_stridex) * _batch_size +
+              static_cast<int64_t>(_N) * std::abs(_incx))) {
+    return internal::_nrm2_batched(
+        ex, static_cast<int>(_N), ex.get_policy_handler().get_buffer(_vx),
+        static_cast<int>(_incx), static_cast<int>(_stridex),
+        ex.get_policy_handler().get_buffer(_rs), static_cast<int>(_batch_size));
+  }
+  return internal::_nrm2_batched(
+      ex, _N, ex.get_policy_handler().get_buffer(_vx), _incx, _stridex,
+      ex.get_policy_handler().get_buffer(_rs), _batch_size);
+}
+
+/**
+ * \brief Finds the index of the first element having maximum absolute value
+ * in each vector of a batch, in a single kernel. The indices are relative to
+ * the vector.
+ * @param ex Executor
+ * @param _vx BufferIterator
+ * @param _incx Increment for the vectors X
+ * @param _stridex Distance between two consecutive vectors X
+ * @param _rs BufferIterator receiving one index-value tuple per vector
+ * @param _batch_size Number of vectors
+ */
+template <typename executor_t, typename container_t, typename ContainerI,
+          typename index_t, typename increment_t>
+typename executor_t::policy_t::event_t _iamax_batched(
+    executor_t &ex, index_t _N, container_t _vx, increment_t _incx,
+    index_t _stridex, ContainerI _rs, index_t _batch_size) {
+  return internal::_iamax_batched(
+      ex, _N, ex.get_policy_handler().get_buffer(_vx), _incx, _stridex,
+      ex.get_policy_handler().get_buffer(_rs), _batch_size);
+}
+
 /**
  * .
  * @brief _rot constructor given plane rotation
@@ -397,6 +854,14 @@ template <typename executor_t, typename container_0_t, typename container_1_t,
 typename executor_t::policy_t::event_t _rot(
     executor_t &ex, index_t _N, container_0_t _vx, increment_t _incx,
     container_1_t _vy, increment_t _incy, element_t _cos, element_t _sin) {
+  if (use_int_index<index_t>(static_cast<int64_t>(_N) * std::abs(_incx),
+                             static_cast<int64_t>(_N) * std::abs(_incy))) {
+    return internal::_rot(ex, static_cast<int>(_N),
+                          ex.get_policy_handler().get_buffer(_vx),
+                          static_cast<int>(_incx),
+                          ex.get_policy_handler().get_buffer(_vy),
+                          static_cast<int>(_incy), _cos, _sin);
+  }
   return internal::_rot(ex, _N, ex.get_policy_handler().get_buffer(_vx), _incx,
                         ex.get_policy_handler().get_buffer(_vy), _incy, _cos,
                         _sin);
@@ -419,6 +884,14 @@ typename ValueType<container_0_t>::type _dot(executor_t &ex, index_t _N,
                                              increment_t _incx,
                                              container_1_t _vy,
                                              increment_t _incy) {
+  if (use_int_index<index_t>(static_cast<int64_t>(_N) * std::abs(_incx),
+                             static_cast<int64_t>(_N) * std::abs(_incy))) {
+    return internal::_dot(ex, static_cast<int>(_N),
+                          ex.get_policy_handler().get_buffer(_vx),
+                          static_cast<int>(_incx),
+                          ex.get_policy_handler().get_buffer(_vy),
+                          static_cast<int>(_incy));
+  }
   return internal::_dot(ex, _N, ex.get_policy_handler().get_buffer(_vx), _incx,
                         ex.get_policy_handler().get_buffer(_vy), _incy);
 }
@@ -459,6 +932,11 @@ template <typename executor_t, typename container_t, typename index_t,
 typename ValueType<container_t>::type _asum(executor_t &ex, index_t _N,
                                             container_t _vx,
                                             increment_t _incx) {
+  if (use_int_index<index_t>(static_cast<int64_t>(_N) * std::abs(_incx))) {
+    return internal::_asum(ex, static_cast<int>(_N),
+                           ex.get_policy_handler().get_buffer(_vx),
+                           static_cast<int>(_incx));
+  }
   return internal::_asum(ex, _N, ex.get_policy_handler().get_buffer(_vx),
                          _incx);
 }
@@ -475,9 +953,117 @@ template <typename executor_t, typename container_t, typename index_t,
 typename ValueType<container_t>::type _nrm2(executor_t &ex, index_t _N,
                                             container_t _vx,
                                             increment_t _incx) {
+  if (use_int_index<index_t>(static_cast<int64_t>(_N) * std::abs(_incx))) {
+    return internal::_nrm2(ex, static_cast<int>(_N),
+                           ex.get_policy_handler().get_buffer(_vx),
+                           static_cast<int>(_incx));
+  }
   return internal::_nrm2(ex, _N, ex.get_policy_handler().get_buffer(_vx),
                          _incx);
 }
 
+/**
+ * \brief Compute the inner product of two vectors without blocking the host.
+ *
+ * @param ex Executor
+ * @param _vx BufferIterator
+ * @param _incx Increment for the vector X
+ * @param _vx BufferIterator
+ * @param _incy Increment for the vector Y
+ * @return Future holding the result
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename index_t, typename increment_t>
+scalar_future<typename ValueType<container_0_t>::type> _dot_async(
+    executor_t &ex, index_t _N, container_0_t _vx, increment_t _incx,
+    container_1_t _vy, increment_t _incy) {
+  if (use_int_index<index_t>(static_cast<int64_t>(_N) * std::abs(_incx),
+                             static_cast<int64_t>(_N) * std::abs(_incy))) {
+    return internal::_dot_async(ex, static_cast<int>(_N),
+                                ex.get_policy_handler().get_buffer(_vx),
+                                static_cast<int>(_incx),
+                                ex.get_policy_handler().get_buffer(_vy),
+                                static_cast<int>(_incy));
+  }
+  return internal::_dot_async(ex, _N, ex.get_policy_handler().get_buffer(_vx),
+                              _incx, ex.get_policy_handler().get_buffer(_vy),
+                              _incy);
+}
+
+/**
+ * \brief ICAMAX finds the index of the first element having maximum without
+ * blocking the host.
+ * @param _vx BufferIterator
+ * @param _incx Increment for the vector X
+ * @return Future holding the index
+ */
+template <typename executor_t, typename container_t, typename index_t,
+          typename increment_t>
+scalar_future<index_t,
+              IndexValueTuple<index_t, typename ValueType<container_t>::type>>
+_iamax_async(executor_t &ex, index_t _N, container_t _vx, increment_t _incx) {
+  return internal::_iamax_async(
+      ex, _N, ex.get_policy_handler().get_buffer(_vx), _incx);
+}
+
+/**
+ * \brief ICAMIN finds the index of the first element having minimum without
+ * blocking the host.
+ * @param _vx BufferIterator
+ * @param _incx Increment for the vector X
+ * @return Future holding the index
+ */
+template <typename executor_t, typename container_t, typename index_t,
+          typename increment_t>
+scalar_future<index_t,
+              IndexValueTuple<index_t, typename ValueType<container_t>::type>>
+_iamin_async(executor_t &ex, index_t _N, container_t _vx, increment_t _incx) {
+  return internal::_iamin_async(
+      ex, _N, ex.get_policy_handler().get_buffer(_vx), _incx);
+}
+
+/**
+ * \brief ASUM Takes the sum of the absolute values without blocking the host.
+ *
+ * @param ex Executor
+ * @param _vx BufferIterator
+ * @param _incx Increment for the vector X
+ * @return Future holding the result
+ */
+template <typename executor_t, typename container_t, typename index_t,
+          typename increment_t>
+scalar_future<typename ValueType<container_t>::type> _asum_async(
+    executor_t &ex, index_t _N, container_t _vx, increment_t _incx) {
+  if (use_int_index<index_t>(static_cast<int64_t>(_N) * std::abs(_incx))) {
+    return internal::_asum_async(ex, static_cast<int>(_N),
+                                 ex.get_policy_handler().get_buffer(_vx),
+                                 static_cast<int>(_incx));
+  }
+  return internal::_asum_async(
+      ex, _N, ex.get_policy_handler().get_buffer(_vx), _incx);
+}
+
+/**
+ * \brief NRM2 Returns the euclidian norm of a vector without blocking the
+ * host.
+ *
+ * @param ex Executor
+ * @param _vx BufferIterator
+ * @param _incx Increment for the vector X
+ * @return Future holding the result
+ */
+template <typename executor_t, typename container_t, typename index_t,
+          typename increment_t>
+scalar_future<typename ValueType<container_t>::type> _nrm2_async(
+    executor_t &ex, index_t _N, container_t _vx, increment_t _incx) {
+  if (use_int_index<index_t>(static_cast<int64_t>(_N) * std::abs(_incx))) {
+    return internal::_nrm2_async(ex, static_cast<int>(_N),
+                                 ex.get_policy_handler().get_buffer(_vx),
+                                 static_cast<int>(_incx));
+  }
+  return internal::_nrm2_async(
+      ex, _N, ex.get_policy_handler().get_buffer(_vx), _incx);
+}
+
 }  // end namespace blas
 #endif  // SYCL_BLAS_BLAS1_INTERFACE
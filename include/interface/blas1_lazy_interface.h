@@ -0,0 +1,204 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename blas1_lazy_interface.h
+ *
+ **************************************************************************/
+#ifndef SYCL_BLAS_BLAS1_LAZY_INTERFACE_H
+#define SYCL_BLAS_BLAS1_LAZY_INTERFACE_H
+#include "blas_meta.h"
+#include "operations/blas1_trees.h"
+#include "operations/blas_operators.h"
+#include "views/view.h"
+#include <type_traits>
+#include <utility>
+
+namespace blas {
+
+/*! LazyVector.
+ * @brief Vector whose value is a pending expression, which is only computed
+ * and stored in the vector's memory when the vector is materialized.
+ *
+ * The lazy _axpy, _scal, _copy and _swap return a new LazyVector whose
+ * expression applies the operation to the expressions of their arguments, so
+ * a chain of element-wise updates is computed by a single kernel that reads
+ * every input once and writes every output once.
+ *
+ * A pending expression reads the memory of the vectors it was built from, so
+ * vectors whose expressions read each other's memory (e.g. after _swap) must
+ * be materialized together. wait() materializes the vectors it is given
+ * before waiting; otherwise a vector must be materialized before it is read
+ * on the host or used by a non element-wise operation.
+ *
+ * The lazy API is header-only: its types depend on the expressions built by
+ * the caller, so it is not instantiated in the library and is only available
+ * by including sycl_blas.hpp.
+ *
+ * @tparam view_t Type of the view the vector is stored in
+ * @tparam expr_t Type of the pending expression, view_t if there is none
+ */
+template <typename view_t, typename expr_t>
+class LazyVector {
+ public:
+  using index_t = typename view_t::index_t;
+  static constexpr bool is_pending = !std::is_same<view_t, expr_t>::value;
+
+  LazyVector(view_t view, expr_t expr);
+
+  view_t &get_view();
+  expr_t &get_expression();
+
+ private:
+  view_t view_;
+  expr_t expr_;
+};
+
+/**
+ * \brief Creates a LazyVector without a pending expression over a buffer.
+ * @param ex Executor
+ * @param _vx BufferIterator
+ * @param _incx Increment for the vector X
+ */
+template <typename executor_t, typename container_t, typename index_t,
+          typename increment_t>
+auto make_lazy_vector(executor_t &ex, container_t _vx, increment_t _incx,
+                      index_t _N)
+    -> LazyVector<decltype(make_vector_view(ex, _vx, _incx, _N)),
+                  decltype(make_vector_view(ex, _vx, _incx, _N))>;
+
+/**
+ * \brief Lazy AXPY, the result is the pending expression alpha * x + y
+ * stored in the memory of y.
+ * @param _alpha Scalar
+ * @param _vx LazyVector
+ * @param _vy LazyVector
+ */
+template <typename element_t, typename x_view_t, typename x_expr_t,
+          typename y_view_t, typename y_expr_t>
+LazyVector<y_view_t,
+           BinaryOp<AddOperator, y_expr_t,
+                    ScalarOp<ProductOperator, element_t, x_expr_t>>>
+_axpy(element_t _alpha, LazyVector<x_view_t, x_expr_t> _vx,
+      LazyVector<y_view_t, y_expr_t> _vy);
+
+/**
+ * \brief Lazy SCAL, the result is the pending expression alpha * x stored in
+ * the memory of x.
+ * @param _alpha Scalar
+ * @param _vx LazyVector
+ */
+template <typename element_t, typename x_view_t, typename x_expr_t>
+LazyVector<x_view_t, ScalarOp<ProductOperator, element_t, x_expr_t>> _scal(
+    element_t _alpha, LazyVector<x_view_t, x_expr_t> _vx);
+
+/**
+ * \brief Lazy COPY, the result is the pending expression of x stored in the
+ * memory of y.
+ * @param _vx LazyVector
+ * @param _vy LazyVector
+ */
+template <typename x_view_t, typename x_expr_t, typename y_view_t,
+          typename y_expr_t>
+LazyVector<y_view_t, x_expr_t> _copy(LazyVector<x_view_t, x_expr_t> _vx,
+                                     LazyVector<y_view_t, y_expr_t> _vy);
+
+/**
+ * \brief Lazy SWAP, the results are the pending expression of y stored in the
+ * memory of x and the one of x stored in the memory of y. They read each
+ * other's memory, so they must be materialized together.
+ * @param _vx LazyVector
+ * @param _vy LazyVector
+ */
+template <typename x_view_t, typename x_expr_t, typename y_view_t,
+          typename y_expr_t>
+std::pair<LazyVector<x_view_t, y_expr_t>, LazyVector<y_view_t, x_expr_t>>
+_swap(LazyVector<x_view_t, x_expr_t> _vx, LazyVector<y_view_t, y_expr_t> _vy);
+
+/**
+ * \brief Computes the pending expression of x and stores it in its memory.
+ * Nothing is submitted if x has no pending expression.
+ * @param ex Executor
+ * @param _vx LazyVector
+ */
+template <typename executor_t, typename x_view_t, typename x_expr_t>
+typename executor_t::policy_t::event_t materialize(
+    executor_t &ex, LazyVector<x_view_t, x_expr_t> _vx);
+
+/**
+ * \brief Computes the pending expressions of x and y in a single kernel and
+ * stores them in their memory. All the expressions are evaluated before
+ * either vector is written.
+ * @param ex Executor
+ * @param _vx LazyVector
+ * @param _vy LazyVector
+ */
+template <typename executor_t, typename x_view_t, typename x_expr_t,
+          typename y_view_t, typename y_expr_t>
+typename executor_t::policy_t::event_t materialize(
+    executor_t &ex, LazyVector<x_view_t, x_expr_t> _vx,
+    LazyVector<y_view_t, y_expr_t> _vy);
+
+/**
+ * \brief Materializes both results of a lazy SWAP.
+ * @param ex Executor
+ * @param _vxy Pair of LazyVector returned by _swap
+ */
+template <typename executor_t, typename x_view_t, typename x_expr_t,
+          typename y_view_t, typename y_expr_t>
+typename executor_t::policy_t::event_t materialize(
+    executor_t &ex, std::pair<LazyVector<x_view_t, x_expr_t>,
+                              LazyVector<y_view_t, y_expr_t>>
+                        _vxy);
+
+/**
+ * \brief Materializes x and waits for it to be stored in its memory.
+ * @param ex Executor
+ * @param _vx LazyVector
+ */
+template <typename executor_t, typename x_view_t, typename x_expr_t>
+void wait(executor_t &ex, LazyVector<x_view_t, x_expr_t> _vx);
+
+/**
+ * \brief Materializes x and y together and waits for them to be stored in
+ * their memory.
+ * @param ex Executor
+ * @param _vx LazyVector
+ * @param _vy LazyVector
+ */
+template <typename executor_t, typename x_view_t, typename x_expr_t,
+          typename y_view_t, typename y_expr_t>
+void wait(executor_t &ex, LazyVector<x_view_t, x_expr_t> _vx,
+          LazyVector<y_view_t, y_expr_t> _vy);
+
+/**
+ * \brief Materializes both results of a lazy SWAP and waits for them.
+ * @param ex Executor
+ * @param _vxy Pair of LazyVector returned by _swap
+ */
+template <typename executor_t, typename x_view_t, typename x_expr_t,
+          typename y_view_t, typename y_expr_t>
+void wait(executor_t &ex, std::pair<LazyVector<x_view_t, x_expr_t>,
+                                    LazyVector<y_view_t, y_expr_t>>
+                              _vxy);
+
+}  // namespace blas
+
+#endif  // SYCL_BLAS_BLAS1_LAZY_INTERFACE_H
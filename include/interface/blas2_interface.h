@@ -25,6 +25,13 @@
 
 #ifndef SYCL_BLAS_BLAS2_INTERFACE_H
 #define SYCL_BLAS_BLAS2_INTERFACE_H
+
+#include "blas_meta.h"
+#include "container/blas_iterator.h"
+#include "operations/blas3_trees.h"
+#include <algorithm>
+#include <cstdlib>
+
 namespace blas {
 namespace internal {
 /*!
@@ -63,6 +70,72 @@ typename executor_t::policy_t::event_t _gemv(
     increment_t _incy  // The increment for elements in y (nonzero).
 );
 
+/*!
+ @brief Generalised matrix vector product with alpha and beta stored in device
+ memory, so that they can be the result of a previous operation without being
+ copied to the host. See the overload above for the other parameters.
+ */
+template <typename executor_t, typename index_t, typename element_t,
+          typename container_0_t, typename container_1_t, typename increment_t,
+          typename container_2_t>
+typename executor_t::policy_t::event_t _gemv(
+    executor_t& ex, char _trans, index_t _M, index_t _N,
+    BufferIterator<element_t, typename executor_t::policy_t> _alpha,
+    container_0_t _mA, index_t _lda, container_1_t _vx, increment_t _incx,
+    BufferIterator<element_t, typename executor_t::policy_t> _beta,
+    container_2_t _vy, increment_t _incy);
+
+/*!
+ @brief Generalised matrix vector product applied to several vectors at once,
+ computing
+
+ Y = alpha*op(A)*X + beta*Y
+
+ where the n_rhs columns of X and Y are the input and output vectors. Up to
+ eight vectors are computed by a single pass over A, larger counts are split
+ in groups of eight. See the overloads above for the other parameters.
+ */
+template <typename executor_t, typename index_t, typename element_t,
+          typename container_0_t, typename container_1_t,
+          typename container_2_t>
+typename executor_t::policy_t::event_t _gemv_multi_rhs(
+    executor_t& ex,     // executor_t (sycl, parallel, serial, etc)
+    char _trans,        // The transposition of the matrix ('n', 't', 'c')
+    index_t _M,         // The size of dimension M of the matrix (rows)
+    index_t _N,         // The size of dimension N of the matrix (columns)
+    element_t _alpha,   // Scalar parameter Alpha
+    container_0_t _mA,  // An array (LDA,N), with the first m*n elements
+    index_t _lda,       // Specifies the first dimension of a, max(1, m)
+    container_1_t _mX,  // An array (LDX,n_rhs) whose columns are the vectors x
+    index_t _ldx,       // The first dimension of X, at least the size of x
+    element_t _beta,    // Scalar parameter Beta
+    container_2_t _mY,  // An array (LDY,n_rhs) whose columns are the vectors y
+    index_t _ldy,       // The first dimension of Y, at least the size of y
+    index_t _n_rhs      // The number of vectors
+);
+
+/*!
+ @brief Batched generalised matrix vector product, computing
+
+ y_b = alpha*op(A_b)*x_b + beta*y_b
+
+ for every item b of the batch in a single kernel. The matrices, the x vectors
+ and the y vectors of the batch are laid out as described by batch_type:
+  - strided: the items are stored one after the other, i.e. A_b starts at
+    b*lda*N, x_b at b*len(x)*abs(incx) and y_b at b*len(y)*abs(incy).
+  - interleaved: the batch is the fastest dimension, i.e. the element found
+    at offset k of an item in the strided layout is at k*batch_size + b.
+ See the overloads above for the other parameters.
+ */
+template <typename executor_t, typename index_t, typename element_t,
+          typename container_0_t, typename container_1_t, typename increment_t,
+          typename container_2_t>
+typename executor_t::policy_t::event_t _gemv_batched(
+    executor_t& ex, char _trans, index_t _M, index_t _N, element_t _alpha,
+    container_0_t _mA, index_t _lda, container_1_t _vx, increment_t _incx,
+    element_t _beta, container_2_t _vy, increment_t _incy, index_t batch_size,
+    gemm_batch_type_t batch_type = gemm_batch_type_t::strided);
+
 /*!
  * @brief Prototype for the internal implementation of the GEMV operation. See
  * documentation in the blas2_interface.hpp file for details.
@@ -76,6 +149,32 @@ typename Executor::policy_t::event_t _gemv_impl(
     index_t _lda, container_t1 _vx, increment_t _incx, element_t _beta,
     container_t2 _vy, increment_t _incy);
 
+/*!
+ * @brief Prototype for the single kernel implementation of the GEMV operation.
+ * See documentation in the blas2_interface.hpp file for details.
+ */
+template <uint32_t local_range, uint32_t c_lanes, transpose_type trn,
+          typename Executor, typename index_t, typename element_t,
+          typename container_t0, typename container_t1, typename increment_t,
+          typename container_t2>
+typename Executor::policy_t::event_t _gemv_single_kernel_impl(
+    Executor& ex, index_t _M, index_t _N, element_t _alpha, container_t0 _mA,
+    index_t _lda, container_t1 _vx, increment_t _incx, element_t _beta,
+    container_t2 _vy, increment_t _incy);
+
+/*!
+ * @brief Prototype for the multi vector implementation of the GEMV operation.
+ * See documentation in the blas2_interface.hpp file for details.
+ */
+template <uint32_t local_range, uint32_t c_lanes, uint32_t n_rhs,
+          transpose_type trn, typename Executor, typename index_t,
+          typename element_t, typename container_t0, typename container_t1,
+          typename container_t2>
+typename Executor::policy_t::event_t _gemv_multi_rhs_impl(
+    Executor& ex, index_t _M, index_t _N, element_t _alpha, container_t0 _mA,
+    index_t _lda, container_t1 _mX, index_t _ldx, element_t _beta,
+    container_t2 _mY, index_t _ldy);
+
 /*!
  @brief Generalised matrix vector product with a triangular symmetric matrix.
 
@@ -102,6 +201,33 @@ typename executor_t::policy_t::event_t _trmv(
     increment_t _incx   // !=0 The increment for the elements of X
 );
 
+/*!
+ @brief Solution of a triangular system of equations with a single right hand
+ side.
+
+ Solution of a system of equations with a triangular matrix, i.e. computing the
+ mathematical operation:
+
+ x = inv(op(A))*x
+
+ See the netlib blas interface documentation for more details of the high level
+ interface: http://www.netlib.org/lapack/explore-html/d0/d2a/strsv_8f.html
+
+ */
+template <typename executor_t, typename index_t, typename container_0_t,
+          typename container_1_t, typename increment_t>
+typename executor_t::policy_t::event_t _trsv(
+    executor_t& ex,     // executor_t (sycl, parallel, serial, etc)
+    char _Uplo,         // Whether the matrix is upper/lower ('u', 'l')
+    char _trans,        // Whether the matrix is transposed ('n', 't', 'c')
+    char _Diag,         // Whether the matrix is unit triangular ('u', 'n')
+    index_t _N,         // >0 The order of matrix A
+    container_0_t _mA,  // (_lda, _N) The input matrix
+    index_t _lda,       // >max(1, _N) The first dimension of _mA
+    container_1_t _vx,  // (1 + (_N-1)*abs(_incx)), in/out vector X
+    increment_t _incx   // !=0 The increment for the elements of X
+);
+
 /*!
  @brief Generalised matrix vector product with a square symmetric matrix,
  followed by a vector sum.
@@ -213,6 +339,182 @@ typename executor_t::policy_t::event_t _syr2(
     container_2_t _mA,  // (_lda, _N) The output matrix
     index_t _lda        // >max(1, _N) The first dimension of _mA
 );
+
+/*!
+ @brief Generalised matrix vector product with a general band matrix, followed
+ by a vector sum.
+
+ Generalised matrix vector product with a band matrix of _KL sub-diagonals and
+ _KU super-diagonals stored in band format, followed by a vector sum, i.e.
+ computing the mathematical operation:
+
+ y = alpha*op(A)*x + beta*y
+
+ See the netlib blas interface documentation for more details of the high level
+ interface: http://www.netlib.org/lapack/explore-html/d6/d46/sgbmv_8f.html
+
+ */
+template <typename executor_t, typename index_t, typename element_t,
+          typename container_0_t, typename container_1_t, typename increment_t,
+          typename container_2_t>
+typename executor_t::policy_t::event_t _gbmv(
+    executor_t& ex,     // executor_t (sycl, parallel, serial, etc)
+    char _trans,        // Whether the matrix is transposed ('n', 't', 'c')
+    index_t _M,         // The rows in matrix A
+    index_t _N,         // The cols of matrix A
+    index_t _KL,        // The number of sub-diagonals of A
+    index_t _KU,        // The number of super-diagonals of A
+    element_t _alpha,   // Scalar parameter alpha
+    container_0_t _mA,  // (_lda, _N) The band storage of A
+    index_t _lda,       // >=(_KL + _KU + 1) The first dimension of _mA
+    container_1_t _vx,  // (1 + (_N-1)*abs(_incx)), input vector X
+    increment_t _incx,  // !=0 The increment for the elements of X
+    element_t _beta,    // Scalar parameter beta
+    container_2_t _vy,  // (1 + (_M-1)*abs(_incy)), output vector Y
+    increment_t _incy   // !=0 The increment for the elements of Y
+);
+
+/*!
+ @brief Generalised matrix vector product with a symmetric band matrix,
+ followed by a vector sum.
+
+ Generalised matrix vector product with a symmetric band matrix of _K
+ super-diagonals, of which only one triangle is stored in band format, followed
+ by a vector sum, i.e. computing the mathematical operation:
+
+ y = alpha*A*x + beta*y
+
+ See the netlib blas interface documentation for more details of the high level
+ interface: http://www.netlib.org/lapack/explore-html/d3/da1/ssbmv_8f.html
+
+ */
+template <typename executor_t, typename index_t, typename element_t,
+          typename container_0_t, typename container_1_t, typename increment_t,
+          typename container_2_t>
+typename executor_t::policy_t::event_t _sbmv(
+    executor_t& ex,     // executor_t (sycl, parallel, serial, etc)
+    char _Uplo,         // Whether the matrix is upper/lower ('u', 'l')
+    index_t _N,         // >0 The order of matrix A
+    index_t _K,         // The number of super-diagonals of A
+    element_t _alpha,   // Scalar parameter alpha
+    container_0_t _mA,  // (_lda, _N) The band storage of A
+    index_t _lda,       // >=(_K + 1) The first dimension of _mA
+    container_1_t _vx,  // (1 + (_N-1)*abs(_incx)), input vector X
+    increment_t _incx,  // !=0 The increment for the elements of X
+    element_t _beta,    // Scalar parameter beta
+    container_2_t _vy,  // (1 + (_N-1)*abs(_incy)), output vector Y
+    increment_t _incy   // !=0 The increment for the elements of Y
+);
+
+/*!
+ @brief Generalised matrix vector product with a symmetric packed matrix,
+ followed by a vector sum.
+
+ Generalised matrix vector product with a symmetric matrix, of which only one
+ triangle is stored in packed format, followed by a vector sum, i.e. computing
+ the mathematical operation:
+
+ y = alpha*A*x + beta*y
+
+ See the netlib blas interface documentation for more details of the high level
+ interface: http://www.netlib.org/lapack/explore-html/d8/d68/sspmv_8f.html
+
+ */
+template <typename executor_t, typename index_t, typename element_t,
+          typename container_0_t, typename container_1_t, typename increment_t,
+          typename container_2_t>
+typename executor_t::policy_t::event_t _spmv(
+    executor_t& ex,      // executor_t (sycl, parallel, serial, etc)
+    char _Uplo,          // Whether the matrix is upper/lower ('u', 'l')
+    index_t _N,          // >0 The order of matrix A
+    element_t _alpha,    // Scalar parameter alpha
+    container_0_t _mAP,  // (_N*(_N+1)/2) The packed matrix A
+    container_1_t _vx,   // (1 + (_N-1)*abs(_incx)), input vector X
+    increment_t _incx,   // !=0 The increment for the elements of X
+    element_t _beta,     // Scalar parameter beta
+    container_2_t _vy,   // (1 + (_N-1)*abs(_incy)), output vector Y
+    increment_t _incy    // !=0 The increment for the elements of Y
+);
+
+/*!
+ @brief Matrix vector product with a triangular band matrix.
+
+ Matrix vector product with a triangular band matrix of _K off-diagonals stored
+ in band format, i.e. computing the mathematical operation:
+
+ x = op(A)*x
+
+ See the netlib blas interface documentation for more details of the high level
+ interface: http://www.netlib.org/lapack/explore-html/d6/d7d/stbmv_8f.html
+
+ */
+template <typename executor_t, typename index_t, typename container_0_t,
+          typename container_1_t, typename increment_t>
+typename executor_t::policy_t::event_t _tbmv(
+    executor_t& ex,     // executor_t (sycl, parallel, serial, etc)
+    char _Uplo,         // Whether the matrix is upper/lower ('u', 'l')
+    char _trans,        // Whether the matrix is transposed ('n', 't', 'c')
+    char _Diag,         // Whether the matrix is unit triangular ('u', 'n')
+    index_t _N,         // >0 The order of matrix A
+    index_t _K,         // The number of off-diagonals of A
+    container_0_t _mA,  // (_lda, _N) The band storage of A
+    index_t _lda,       // >=(_K + 1) The first dimension of _mA
+    container_1_t _vx,  // (1 + (_N-1)*abs(_incx)), output vector X
+    increment_t _incx   // !=0 The increment for the elements of X
+);
+
+/*!
+ @brief Matrix vector product with a triangular packed matrix.
+
+ Matrix vector product with a triangular matrix stored in packed format, i.e.
+ computing the mathematical operation:
+
+ x = op(A)*x
+
+ See the netlib blas interface documentation for more details of the high level
+ interface: http://www.netlib.org/lapack/explore-html/db/db1/stpmv_8f.html
+
+ */
+template <typename executor_t, typename index_t, typename container_0_t,
+          typename container_1_t, typename increment_t>
+typename executor_t::policy_t::event_t _tpmv(
+    executor_t& ex,      // executor_t (sycl, parallel, serial, etc)
+    char _Uplo,          // Whether the matrix is upper/lower ('u', 'l')
+    char _trans,         // Whether the matrix is transposed ('n', 't', 'c')
+    char _Diag,          // Whether the matrix is unit triangular ('u', 'n')
+    index_t _N,          // >0 The order of matrix A
+    container_0_t _mAP,  // (_N*(_N+1)/2) The packed matrix A
+    container_1_t _vx,   // (1 + (_N-1)*abs(_incx)), output vector X
+    increment_t _incx    // !=0 The increment for the elements of X
+);
+
+/*!
+ @brief Solution of a triangular band system of equations.
+
+ Solution of a system of equations with a triangular band matrix of _K
+ off-diagonals stored in band format, i.e. computing the mathematical
+ operation:
+
+ x = inv(op(A))*x
+
+ See the netlib blas interface documentation for more details of the high level
+ interface: http://www.netlib.org/lapack/explore-html/d0/d1f/stbsv_8f.html
+
+ */
+template <typename executor_t, typename index_t, typename container_0_t,
+          typename container_1_t, typename increment_t>
+typename executor_t::policy_t::event_t _tbsv(
+    executor_t& ex,     // executor_t (sycl, parallel, serial, etc)
+    char _Uplo,         // Whether the matrix is upper/lower ('u', 'l')
+    char _trans,        // Whether the matrix is transposed ('n', 't', 'c')
+    char _Diag,         // Whether the matrix is unit triangular ('u', 'n')
+    index_t _N,         // >0 The order of matrix A
+    index_t _K,         // The number of off-diagonals of A
+    container_0_t _mA,  // (_lda, _N) The band storage of A
+    index_t _lda,       // >=(_K + 1) The first dimension of _mA
+    container_1_t _vx,  // (1 + (_N-1)*abs(_incx)), in/out vector X
+    increment_t _incx   // !=0 The increment for the elements of X
+);
 }  // namespace internal
 
 /*!
@@ -250,12 +552,62 @@ typename executor_t::policy_t::event_t inline _gemv(
     // finished, y is overwritten with the updated vector.
     increment_t _incy  // The increment for elements in y (nonzero).
 ) {
+  const index_t vec_size = std::max(_M, _N);
+  if (use_int_index<index_t>(
+          static_cast<int64_t>(_lda) * _N,
+          static_cast<int64_t>(vec_size) * std::abs(_incx),
+          static_cast<int64_t>(vec_size) * std::abs(_incy))) {
+    return internal::_gemv(
+        ex, _trans, static_cast<int>(_M), static_cast<int>(_N), _alpha,
+        ex.get_policy_handler().get_buffer(_mA), static_cast<int>(_lda),
+        ex.get_policy_handler().get_buffer(_vx), static_cast<int>(_incx),
+        _beta, ex.get_policy_handler().get_buffer(_vy),
+        static_cast<int>(_incy));
+  }
   return internal::_gemv(ex, _trans, _M, _N, _alpha,
                          ex.get_policy_handler().get_buffer(_mA), _lda,
                          ex.get_policy_handler().get_buffer(_vx), _incx, _beta,
                          ex.get_policy_handler().get_buffer(_vy), _incy);
 }
 
+/*!
+ @brief Generalised matrix vector product applied to the n_rhs columns of X,
+ computing Y = alpha*op(A)*X + beta*Y with a single read of A for up to eight
+ vectors. See internal::_gemv_multi_rhs for details on the parameters.
+ */
+template <typename executor_t, typename index_t, typename element_t,
+          typename container_0_t, typename container_1_t,
+          typename container_2_t>
+typename executor_t::policy_t::event_t inline _gemv_multi_rhs(
+    executor_t& ex, char _trans, index_t _M, index_t _N, element_t _alpha,
+    container_0_t _mA, index_t _lda, container_1_t _mX, index_t _ldx,
+    element_t _beta, container_2_t _mY, index_t _ldy, index_t _n_rhs) {
+  return internal::_gemv_multi_rhs(
+      ex, _trans, _M, _N, _alpha, ex.get_policy_handler().get_buffer(_mA), _lda,
+      ex.get_policy_handler().get_buffer(_mX), _ldx, _beta,
+      ex.get_policy_handler().get_buffer(_mY), _ldy, _n_rhs);
+}
+
+/*!
+ @brief Batched generalised matrix vector product, computing
+ y_b = alpha*op(A_b)*x_b + beta*y_b for every item b of the batch in a single
+ kernel. The layout of the batch is described by batch_type, see
+ internal::_gemv_batched for details.
+ */
+template <typename executor_t, typename index_t, typename element_t,
+          typename container_0_t, typename container_1_t, typename increment_t,
+          typename container_2_t>
+typename executor_t::policy_t::event_t inline _gemv_batched(
+    executor_t& ex, char _trans, index_t _M, index_t _N, element_t _alpha,
+    container_0_t _mA, index_t _lda, container_1_t _vx, increment_t _incx,
+    element_t _beta, container_2_t _vy, increment_t _incy, index_t batch_size,
+    gemm_batch_type_t batch_type = gemm_batch_type_t::strided) {
+  return internal::_gemv_batched(
+      ex, _trans, _M, _N, _alpha, ex.get_policy_handler().get_buffer(_mA), _lda,
+      ex.get_policy_handler().get_buffer(_vx), _incx, _beta,
+      ex.get_policy_handler().get_buffer(_vy), _incy, batch_size, batch_type);
+}
+
 /*!
  @brief Generalised matrix vector product with a triangular symmetric matrix.
 
@@ -286,6 +638,37 @@ typename executor_t::policy_t::event_t inline _trmv(
                          ex.get_policy_handler().get_buffer(_vx), _incx);
 }
 
+/*!
+ @brief Solution of a triangular system of equations with a single right hand
+ side.
+
+ Solution of a system of equations with a triangular matrix, i.e. computing the
+ mathematical operation:
+
+ x = inv(op(A))*x
+
+ See the netlib blas interface documentation for more details of the high level
+ interface: http://www.netlib.org/lapack/explore-html/d0/d2a/strsv_8f.html
+
+ */
+template <typename executor_t, typename index_t, typename container_0_t,
+          typename container_1_t, typename increment_t>
+typename executor_t::policy_t::event_t inline _trsv(
+    executor_t& ex,     // executor_t (sycl, parallel, serial, etc)
+    char _Uplo,         // Whether the matrix is upper/lower ('u', 'l')
+    char _trans,        // Whether the matrix is transposed ('n', 't', 'c')
+    char _Diag,         // Whether the matrix is unit triangular ('u', 'n')
+    index_t _N,         // >0 The order of matrix A
+    container_0_t _mA,  // (_lda, _N) The input matrix
+    index_t _lda,       // >max(1, _N) The first dimension of _mA
+    container_1_t _vx,  // (1 + (_N-1)*abs(_incx)), in/out vector X
+    increment_t _incx   // !=0 The increment for the elements of X
+) {
+  return internal::_trsv(ex, _Uplo, _trans, _Diag, _N,
+                         ex.get_policy_handler().get_buffer(_mA), _lda,
+                         ex.get_policy_handler().get_buffer(_vx), _incx);
+}
+
 /*!
  @brief Generalised matrix vector product with a rectangular symmetric
  matrix, followed by a vector sum.
@@ -421,6 +804,209 @@ typename executor_t::policy_t::event_t inline _syr2(
                          ex.get_policy_handler().get_buffer(_vy), _incy,
                          ex.get_policy_handler().get_buffer(_mA), _lda);
 }
+
+/*!
+ @brief Generalised matrix vector product with a general band matrix, followed
+ by a vector sum.
+
+ Generalised matrix vector product with a band matrix of _KL sub-diagonals and
+ _KU super-diagonals stored in band format, followed by a vector sum, i.e.
+ computing the mathematical operation:
+
+ y = alpha*op(A)*x + beta*y
+
+ See the netlib blas interface documentation for more details of the high level
+ interface: http://www.netlib.org/lapack/explore-html/d6/d46/sgbmv_8f.html
+
+ */
+template <typename executor_t, typename index_t, typename element_t,
+          typename container_0_t, typename container_1_t, typename increment_t,
+          typename container_2_t>
+typename executor_t::policy_t::event_t inline _gbmv(
+    executor_t& ex,     // executor_t (sycl, parallel, serial, etc)
+    char _trans,        // Whether the matrix is transposed ('n', 't', 'c')
+    index_t _M,         // The rows in matrix A
+    index_t _N,         // The cols of matrix A
+    index_t _KL,        // The number of sub-diagonals of A
+    index_t _KU,        // The number of super-diagonals of A
+    element_t _alpha,   // Scalar parameter alpha
+    container_0_t _mA,  // (_lda, _N) The band storage of A
+    index_t _lda,       // >=(_KL + _KU + 1) The first dimension of _mA
+    container_1_t _vx,  // (1 + (_N-1)*abs(_incx)), input vector X
+    increment_t _incx,  // !=0 The increment for the elements of X
+    element_t _beta,    // Scalar parameter beta
+    container_2_t _vy,  // (1 + (_M-1)*abs(_incy)), output vector Y
+    increment_t _incy   // !=0 The increment for the elements of Y
+) {
+  return internal::_gbmv(ex, _trans, _M, _N, _KL, _KU, _alpha,
+                         ex.get_policy_handler().get_buffer(_mA), _lda,
+                         ex.get_policy_handler().get_buffer(_vx), _incx, _beta,
+                         ex.get_policy_handler().get_buffer(_vy), _incy);
+}
+
+/*!
+ @brief Generalised matrix vector product with a symmetric band matrix,
+ followed by a vector sum.
+
+ Generalised matrix vector product with a symmetric band matrix of _K
+ super-diagonals, of which only one triangle is stored in band format, followed
+ by a vector sum, i.e. computing the mathematical operation:
+
+ y = alpha*A*x + beta*y
+
+ See the netlib blas interface documentation for more details of the high level
+ interface: http://www.netlib.org/lapack/explore-html/d3/da1/ssbmv_8f.html
+
+ */
+template <typename executor_t, typename index_t, typename element_t,
+          typename container_0_t, typename container_1_t, typename increment_t,
+          typename container_2_t>
+typename executor_t::policy_t::event_t inline _sbmv(
+    executor_t& ex,     // executor_t (sycl, parallel, serial, etc)
+    char _Uplo,         // Whether the matrix is upper/lower ('u', 'l')
+    index_t _N,         // >0 The order of matrix A
+    index_t _K,         // The number of super-diagonals of A
+    element_t _alpha,   // Scalar parameter alpha
+    container_0_t _mA,  // (_lda, _N) The band storage of A
+    index_t _lda,       // >=(_K + 1) The first dimension of _mA
+    container_1_t _vx,  // (1 + (_N-1)*abs(_incx)), input vector X
+    increment_t _incx,  // !=0 The increment for the elements of X
+    element_t _beta,    // Scalar parameter beta
+    container_2_t _vy,  // (1 + (_N-1)*abs(_incy)), output vector Y
+    increment_t _incy   // !=0 The increment for the elements of Y
+) {
+  return internal::_sbmv(ex, _Uplo, _N, _K, _alpha,
+                         ex.get_policy_handler().get_buffer(_mA), _lda,
+                         ex.get_policy_handler().get_buffer(_vx), _incx, _beta,
+                         ex.get_policy_handler().get_buffer(_vy), _incy);
+}
+
+/*!
+ @brief Generalised matrix vector product with a symmetric packed matrix,
+ followed by a vector sum.
+
+ Generalised matrix vector product with a symmetric matrix, of which only one
+ triangle is stored in packed format, followed by a vector sum, i.e. computing
+ the mathematical operation:
+
+ y = alpha*A*x + beta*y
+
+ See the netlib blas interface documentation for more details of the high level
+ interface: http://www.netlib.org/lapack/explore-html/d8/d68/sspmv_8f.html
+
+ */
+template <typename executor_t, typename index_t, typename element_t,
+          typename container_0_t, typename container_1_t, typename increment_t,
+          typename container_2_t>
+typename executor_t::policy_t::event_t inline _spmv(
+    executor_t& ex,      // executor_t (sycl, parallel, serial, etc)
+    char _Uplo,          // Whether the matrix is upper/lower ('u', 'l')
+    index_t _N,          // >0 The order of matrix A
+    element_t _alpha,    // Scalar parameter alpha
+    container_0_t _mAP,  // (_N*(_N+1)/2) The packed matrix A
+    container_1_t _vx,   // (1 + (_N-1)*abs(_incx)), input vector X
+    increment_t _incx,   // !=0 The increment for the elements of X
+    element_t _beta,     // Scalar parameter beta
+    container_2_t _vy,   // (1 + (_N-1)*abs(_incy)), output vector Y
+    increment_t _incy    // !=0 The increment for the elements of Y
+) {
+  return internal::_spmv(ex, _Uplo, _N, _alpha,
+                         ex.get_policy_handler().get_buffer(_mAP),
+                         ex.get_policy_handler().get_buffer(_vx), _incx, _beta,
+                         ex.get_policy_handler().get_buffer(_vy), _incy);
+}
+
+/*!
+ @brief Matrix vector product with a triangular band matrix.
+
+ Matrix vector product with a triangular band matrix of _K off-diagonals stored
+ in band format, i.e. computing the mathematical operation:
+
+ x = op(A)*x
+
+ See the netlib blas interface documentation for more details of the high level
+ interface: http://www.netlib.org/lapack/explore-html/d6/d7d/stbmv_8f.html
+
+ */
+template <typename executor_t, typename index_t, typename container_0_t,
+          typename container_1_t, typename increment_t>
+typename executor_t::policy_t::event_t inline _tbmv(
+    executor_t& ex,     // executor_t (sycl, parallel, serial, etc)
+    char _Uplo,         // Whether the matrix is upper/lower ('u', 'l')
+    char _trans,        // Whether the matrix is transposed ('n', 't', 'c')
+    char _Diag,         // Whether the matrix is unit triangular ('u', 'n')
+    index_t _N,         // >0 The order of matrix A
+    index_t _K,         // The number of off-diagonals of A
+    container_0_t _mA,  // (_lda, _N) The band storage of A
+    index_t _lda,       // >=(_K + 1) The first dimension of _mA
+    container_1_t _vx,  // (1 + (_N-1)*abs(_incx)), output vector X
+    increment_t _incx   // !=0 The increment for the elements of X
+) {
+  return internal::_tbmv(ex, _Uplo, _trans, _Diag, _N, _K,
+                         ex.get_policy_handler().get_buffer(_mA), _lda,
+                         ex.get_policy_handler().get_buffer(_vx), _incx);
+}
+
+/*!
+ @brief Matrix vector product with a triangular packed matrix.
+
+ Matrix vector product with a triangular matrix stored in packed format, i.e.
+ computing the mathematical operation:
+
+ x = op(A)*x
+
+ See the netlib blas interface documentation for more details of the high level
+ interface: http://www.netlib.org/lapack/explore-html/db/db1/stpmv_8f.html
+
+ */
+template <typename executor_t, typename index_t, typename container_0_t,
+          typename container_1_t, typename increment_t>
+typename executor_t::policy_t::event_t inline _tpmv(
+    executor_t& ex,      // executor_t (sycl, parallel, serial, etc)
+    char _Uplo,          // Whether the matrix is upper/lower ('u', 'l')
+    char _trans,         // Whether the matrix is transposed ('n', 't', 'c')
+    char _Diag,          // Whether the matrix is unit triangular ('u', 'n')
+    index_t _N,          // >0 The order of matrix A
+    container_0_t _mAP,  // (_N*(_N+1)/2) The packed matrix A
+    container_1_t _vx,   // (1 + (_N-1)*abs(_incx)), output vector X
+    increment_t _incx    // !=0 The increment for the elements of X
+) {
+  return internal::_tpmv(ex, _Uplo, _trans, _Diag, _N,
+                         ex.get_policy_handler().get_buffer(_mAP),
+                         ex.get_policy_handler().get_buffer(_vx), _incx);
+}
+
+/*!
+ @brief Solution of a triangular band system of equations.
+
+ Solution of a system of equations with a triangular band matrix of _K
+ off-diagonals stored in band format, i.e. computing the mathematical
+ operation:
+
+ x = inv(op(A))*x
+
+ See the netlib blas interface documentation for more details of the high level
+ interface: http://www.netlib.org/lapack/explore-html/d0/d1f/stbsv_8f.html
+
+ */
+template <typename executor_t, typename index_t, typename container_0_t,
+          typename container_1_t, typename increment_t>
+typename executor_t::policy_t::event_t inline _tbsv(
+    executor_t& ex,     // executor_t (sycl, parallel, serial, etc)
+    char _Uplo,         // Whether the matrix is upper/lower ('u', 'l')
+    char _trans,        // Whether the matrix is transposed ('n', 't', 'c')
+    char _Diag,         // Whether the matrix is unit triangular ('u', 'n')
+    index_t _N,         // >0 The order of matrix A
+    index_t _K,         // The number of off-diagonals of A
+    container_0_t _mA,  // (_lda, _N) The band storage of A
+    index_t _lda,       // >=(_K + 1) The first dimension of _mA
+    container_1_t _vx,  // (1 + (_N-1)*abs(_incx)), in/out vector X
+    increment_t _incx   // !=0 The increment for the elements of X
+) {
+  return internal::_tbsv(ex, _Uplo, _trans, _Diag, _N, _K,
+                         ex.get_policy_handler().get_buffer(_mA), _lda,
+                         ex.get_policy_handler().get_buffer(_vx), _incx);
+}
 }  // namespace blas
 
 #endif  // SYCL_BLAS_BLAS2_INTERFACE
@@ -26,7 +26,10 @@
 #ifndef SYCL_BLAS_BLAS3_INTERFACE_H
 #define SYCL_BLAS_BLAS3_INTERFACE_H
 
+#include "blas_meta.h"
+#include "container/blas_iterator.h"
 #include "operations/blas3_trees.h"
+#include <algorithm>
 
 namespace blas {
 namespace internal {
@@ -37,6 +40,11 @@ namespace internal {
  * See the netlib blas interface documentation for more details of the hig
  * level interface:
  * http://www.netlib.org/lapack/explore-html/d4/de2/sgemm_8f.html
+ *
+ * The products are accumulated in element_t, the type of alpha and beta. When
+ * A and B are stored in a narrower type (half matrices with float scalars, or
+ * float matrices with double scalars), C is stored either in that type or in
+ * element_t. Alpha must not be zero for these mixed-precision GEMMs.
  */
 template <typename executor_t, typename container_0_t, typename container_1_t,
           typename container_2_t, typename element_t, typename index_t>
@@ -48,6 +56,19 @@ typename executor_t::policy_t::event_t _gemm(executor_t& ex, char _TransA,
                                              index_t _ldb, element_t _beta,
                                              container_2_t _C, index_t _ldc);
 
+/*!
+ * @brief GEMM with alpha and beta stored in device memory, so that they can be
+ * the result of a previous operation without being copied to the host.
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename element_t, typename index_t>
+typename executor_t::policy_t::event_t _gemm(
+    executor_t& ex, char _TransA, char _TransB, index_t _M, index_t _N,
+    index_t _K, BufferIterator<element_t, typename executor_t::policy_t> _alpha,
+    container_0_t a_, index_t _lda, container_1_t b_, index_t _ldb,
+    BufferIterator<element_t, typename executor_t::policy_t> _beta,
+    container_2_t _C, index_t _ldc);
+
 template <typename executor_t, typename container_0_t, typename container_1_t,
           typename container_2_t, typename element_t, typename index_t>
 typename executor_t::policy_t::event_t _gemm_batched(
@@ -57,6 +78,81 @@ typename executor_t::policy_t::event_t _gemm_batched(
     index_t _ldc, index_t batch_size,
     gemm_batch_type_t batch_type = gemm_batch_type_t::strided);
 
+/*!
+ * @brief GEMM fused with the epilogue of a layer of a neural network, so that C
+ * is written once:
+ *
+ *   C = act(alpha * op(A) * op(B) + beta * C + bias + residual_scale * R)
+ *
+ * @param _bias_type selects whether _bias holds one value per row of C
+ * (size _M), one value per column (size _N), or is not read
+ * @param _bias the bias vector, which can be any buffer when _bias_type is
+ * gemm_bias_t::none
+ * @param _residual_scale the scalar multiplying the residual, which is not
+ * read when it is zero
+ * @param _residual the _M by _N residual matrix R
+ * @param _ldr the leading dimension of R
+ * @param _activation the activation applied last
+ * @param _lower the lower bound of gemm_activation_t::clamp
+ * @param _upper the upper bound of gemm_activation_t::clamp
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename container_3_t,
+          typename container_4_t, typename element_t, typename index_t>
+typename executor_t::policy_t::event_t _gemm_epilogue(
+    executor_t& ex, char _TransA, char _TransB, index_t _M, index_t _N,
+    index_t _K, element_t _alpha, container_0_t a_, index_t _lda,
+    container_1_t b_, index_t _ldb, element_t _beta, container_2_t _C,
+    index_t _ldc, gemm_bias_t _bias_type, container_3_t _bias,
+    element_t _residual_scale, container_4_t _residual, index_t _ldr,
+    gemm_activation_t _activation, element_t _lower, element_t _upper);
+
+/*!
+ * @brief GEMM of int8 matrices accumulated in int32, whose result is
+ * requantized to the type of C before being stored:
+ *
+ *   C = saturate(round(scale * op(A) * op(B)) + zero_point)
+ *
+ * @param a_ the int8 matrix A
+ * @param b_ the int8 matrix B
+ * @param _C the output matrix, of int8_t, uint8_t or int32_t elements. An
+ * int32 C with a unit scale and no zero point receives the accumulators
+ * unchanged.
+ * @param _scale the ratio of the scale of the accumulators (the product of the
+ * scales of A and B) to the scale of C
+ * @param _zero_point the zero point of C
+ * @note the accumulators are exact as long as _K * 128 * 128 fits in an int32
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename index_t>
+typename executor_t::policy_t::event_t _gemm_int8(
+    executor_t& ex, char _TransA, char _TransB, index_t _M, index_t _N,
+    index_t _K, container_0_t a_, index_t _lda, container_1_t b_,
+    index_t _ldb, container_2_t _C, index_t _ldc, float _scale,
+    int32_t _zero_point);
+
+/*!
+ * @brief Grouped GEMM, computing _group_count independent products of
+ * different sizes in a single launch:
+ *
+ *   C_g = alpha * op(A_g) * op(B_g) + beta * C_g
+ *
+ * The arrays, each of _group_count elements in host memory, give the sizes of
+ * each problem, the leading dimensions of its matrices and the offsets of
+ * their first elements in a_, b_ and _C. The same transpositions and scalars
+ * apply to all the problems. The arrays can be reused as soon as the call
+ * returns.
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename element_t, typename index_t>
+typename executor_t::policy_t::event_t _gemm_grouped(
+    executor_t& ex, char _TransA, char _TransB, index_t _group_count,
+    const index_t* _M, const index_t* _N, const index_t* _K, element_t _alpha,
+    container_0_t a_, const index_t* _lda, const index_t* _offset_a,
+    container_1_t b_, const index_t* _ldb, const index_t* _offset_b,
+    element_t _beta, container_2_t _C, const index_t* _ldc,
+    const index_t* _offset_c);
+
 template <typename executor_t, typename container_0_t, typename container_1_t,
           typename element_t, typename index_t>
 typename executor_t::policy_t::event_t _trsm(executor_t& ex, char side,
@@ -77,6 +173,16 @@ typename executor_t::policy_t::event_t _gemm(executor_t& ex, char _TransA,
                                              index_t _lda, container_1_t b_,
                                              index_t _ldb, element_t _beta,
                                              container_2_t _C, index_t _ldc) {
+  if (use_int_index<index_t>(static_cast<int64_t>(_lda) * std::max(_M, _K),
+                             static_cast<int64_t>(_ldb) * std::max(_K, _N),
+                             static_cast<int64_t>(_ldc) * _N)) {
+    return internal::_gemm(
+        ex, _TransA, _TransB, static_cast<int>(_M), static_cast<int>(_N),
+        static_cast<int>(_K), _alpha, ex.get_policy_handler().get_buffer(a_),
+        static_cast<int>(_lda), ex.get_policy_handler().get_buffer(b_),
+        static_cast<int>(_ldb), _beta, ex.get_policy_handler().get_buffer(_C),
+        static_cast<int>(_ldc));
+  }
   return internal::_gemm(ex, _TransA, _TransB, _M, _N, _K, _alpha,
                          ex.get_policy_handler().get_buffer(a_), _lda,
                          ex.get_policy_handler().get_buffer(b_), _ldb, _beta,
@@ -98,6 +204,56 @@ typename executor_t::policy_t::event_t _gemm_batched(
                                  _ldc, batch_size, batch_type);
 }
 
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename container_3_t,
+          typename container_4_t, typename element_t, typename index_t>
+typename executor_t::policy_t::event_t _gemm_epilogue(
+    executor_t& ex, char _TransA, char _TransB, index_t _M, index_t _N,
+    index_t _K, element_t _alpha, container_0_t a_, index_t _lda,
+    container_1_t b_, index_t _ldb, element_t _beta, container_2_t _C,
+    index_t _ldc, gemm_bias_t _bias_type, container_3_t _bias,
+    element_t _residual_scale, container_4_t _residual, index_t _ldr,
+    gemm_activation_t _activation, element_t _lower, element_t _upper) {
+  return internal::_gemm_epilogue(
+      ex, _TransA, _TransB, _M, _N, _K, _alpha,
+      ex.get_policy_handler().get_buffer(a_), _lda,
+      ex.get_policy_handler().get_buffer(b_), _ldb, _beta,
+      ex.get_policy_handler().get_buffer(_C), _ldc, _bias_type,
+      ex.get_policy_handler().get_buffer(_bias), _residual_scale,
+      ex.get_policy_handler().get_buffer(_residual), _ldr, _activation, _lower,
+      _upper);
+}
+
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename index_t>
+typename executor_t::policy_t::event_t _gemm_int8(
+    executor_t& ex, char _TransA, char _TransB, index_t _M, index_t _N,
+    index_t _K, container_0_t a_, index_t _lda, container_1_t b_,
+    index_t _ldb, container_2_t _C, index_t _ldc, float _scale = 1.f,
+    int32_t _zero_point = 0) {
+  return internal::_gemm_int8(ex, _TransA, _TransB, _M, _N, _K,
+                              ex.get_policy_handler().get_buffer(a_), _lda,
+                              ex.get_policy_handler().get_buffer(b_), _ldb,
+                              ex.get_policy_handler().get_buffer(_C), _ldc,
+                              _scale, _zero_point);
+}
+
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename element_t, typename index_t>
+typename executor_t::policy_t::event_t _gemm_grouped(
+    executor_t& ex, char _TransA, char _TransB, index_t _group_count,
+    const index_t* _M, const index_t* _N, const index_t* _K, element_t _alpha,
+    container_0_t a_, const index_t* _lda, const index_t* _offset_a,
+    container_1_t b_, const index_t* _ldb, const index_t* _offset_b,
+    element_t _beta, container_2_t _C, const index_t* _ldc,
+    const index_t* _offset_c) {
+  return internal::_gemm_grouped(
+      ex, _TransA, _TransB, _group_count, _M, _N, _K, _alpha,
+      ex.get_policy_handler().get_buffer(a_), _lda, _offset_a,
+      ex.get_policy_handler().get_buffer(b_), _ldb, _offset_b, _beta,
+      ex.get_policy_handler().get_buffer(_C), _ldc, _offset_c);
+}
+
 template <typename executor_t, typename container_0_t, typename container_1_t,
           typename element_t, typename index_t>
 typename executor_t::policy_t::event_t inline _trsm(
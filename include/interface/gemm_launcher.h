@@ -31,6 +31,21 @@
 
 namespace blas {
 
+/*!
+ * @brief Whether Gemm_Launcher may split K across the work-groups left idle
+ * by a single precision GEMM with few tiles of C.
+ *
+ * The slices of K are added to C with atomic operations, in an order that
+ * changes from one run to the next, so the rounding of the result is not
+ * reproducible. Split-K is therefore only used when GEMM_SPLIT_K_SUPPORT is
+ * defined.
+ */
+#ifdef GEMM_SPLIT_K_SUPPORT
+static constexpr bool gemm_split_k_supported = true;
+#else
+static constexpr bool gemm_split_k_supported = false;
+#endif
+
 /*!
  * @brief Wrapper around Gemm. Creates the views, then makes and launches Gemm
  */
@@ -46,6 +61,31 @@ struct Gemm_Launcher {
       executor_t& ex, index_t _M, index_t _N, index_t _K, element_t _alpha,
       container_0_t a_, index_t _lda, container_1_t b_, index_t _ldb,
       element_t _beta, container_2_t _C, index_t _ldc, index_t batch_size);
+
+  /*!
+   * @brief Minimum depth of a slice of K computed by one batch of a split-K
+   * GEMM, so that the atomic accumulation in C stays cheap compared with the
+   * slice itself.
+   */
+  static constexpr int split_k_min_depth = 256;
+
+  template <typename executor_t, typename gemm_t, typename container_0_t,
+            typename container_1_t, typename container_2_t,
+            typename element_t, typename index_t>
+  static typename executor_t::policy_t::event_t _launch_gemm(
+      executor_t& ex, gemm_t gemm, index_t _M, index_t _N, index_t _K,
+      element_t _alpha, container_0_t a_, index_t _lda, container_1_t b_,
+      index_t _ldb, element_t _beta, container_2_t _C, index_t _ldc,
+      index_t batch_size, std::false_type);
+
+  template <typename executor_t, typename gemm_t, typename container_0_t,
+            typename container_1_t, typename container_2_t,
+            typename element_t, typename index_t>
+  static typename executor_t::policy_t::event_t _launch_gemm(
+      executor_t& ex, gemm_t gemm, index_t _M, index_t _N, index_t _K,
+      element_t _alpha, container_0_t a_, index_t _lda, container_1_t b_,
+      index_t _ldb, element_t _beta, container_2_t _C, index_t _ldc,
+      index_t batch_size, std::true_type);
 };
 
 }  // namespace blas
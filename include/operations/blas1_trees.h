@@ -29,6 +29,7 @@
 #include "operations/blas_operators.h"
 #include <CL/sycl.hpp>
 #include <stdexcept>
+#include <utility>
 #include <vector>
 
 namespace blas {
@@ -68,6 +69,34 @@ struct Assign {
   void adjust_access_displacement();
 };
 
+/*! PacketAssign.
+ * @brief Assign for unit-stride vectors where each work item evaluates
+ * packet_size contiguous elements at once, loaded and stored as a
+ * cl::sycl::vec. The last work item assigns the remaining elements one by
+ * one. The leaves of rhs_t and lhs_t are assumed to have a stride of 1.
+ */
+template <int packet_size, typename lhs_t, typename rhs_t>
+struct PacketAssign {
+  using index_t = typename lhs_t::index_t;
+  using value_t = typename rhs_t::value_t;
+  using packet_t = cl::sycl::vec<value_t, packet_size>;
+  lhs_t lhs_;
+  rhs_t rhs_;
+  PacketAssign(lhs_t &_l, rhs_t _r);
+  index_t get_size() const;
+  bool valid_thread(cl::sycl::nd_item<1> ndItem) const;
+  value_t eval(index_t i);
+  value_t eval(cl::sycl::nd_item<1> ndItem);
+  void bind(cl::sycl::handler &h);
+  void adjust_access_displacement();
+};
+
+template <int packet_size, typename lhs_t, typename rhs_t>
+inline PacketAssign<packet_size, lhs_t, rhs_t> make_packet_assign(lhs_t &lhs_,
+                                                                  rhs_t rhs_) {
+  return PacketAssign<packet_size, lhs_t, rhs_t>(lhs_, rhs_);
+}
+
 /*! DoubleAssign.
  */
 template <typename lhs_1_t, typename lhs_2_t, typename rhs_1_t,
@@ -88,6 +117,23 @@ struct DoubleAssign {
   void adjust_access_displacement();
 };
 
+/*!DeviceScalar.
+ * @brief Leaf holding a scalar stored in device memory, to be used as the
+ * scalar of a ScalarOp. The value is read inside the kernel, so that it can be
+ * the result of a previous kernel (e.g. the alpha of an axpy computed by a dot)
+ * without being copied back to the host.
+ */
+template <typename view_t>
+struct DeviceScalar {
+  using index_t = typename view_t::index_t;
+  using value_t = typename view_t::value_t;
+  view_t view_;
+  DeviceScalar(view_t &_v);
+  value_t eval(index_t i);
+  void bind(cl::sycl::handler &h);
+  void adjust_access_displacement();
+};
+
 /*!ScalarOp.
  * @brief Implements an scalar operation.
  * (e.g alpha OP x, with alpha scalar and x vector)
@@ -103,6 +149,8 @@ struct ScalarOp {
   bool valid_thread(cl::sycl::nd_item<1> ndItem) const;
   value_t eval(index_t i);
   value_t eval(cl::sycl::nd_item<1> ndItem);
+  template <int packet_size>
+  cl::sycl::vec<value_t, packet_size> eval_packet(index_t i);
   void bind(cl::sycl::handler &h);
   void adjust_access_displacement();
 };
@@ -120,6 +168,8 @@ struct UnaryOp {
   bool valid_thread(cl::sycl::nd_item<1> ndItem) const;
   value_t eval(index_t i);
   value_t eval(cl::sycl::nd_item<1> ndItem);
+  template <int packet_size>
+  cl::sycl::vec<value_t, packet_size> eval_packet(index_t i);
   void bind(cl::sycl::handler &h);
   void adjust_access_displacement();
 };
@@ -138,6 +188,8 @@ struct BinaryOp {
   bool valid_thread(cl::sycl::nd_item<1> ndItem) const;
   value_t eval(index_t i);
   value_t eval(cl::sycl::nd_item<1> ndItem);
+  template <int packet_size>
+  cl::sycl::vec<value_t, packet_size> eval_packet(index_t i);
   void bind(cl::sycl::handler &h);
   void adjust_access_displacement();
 };
@@ -159,6 +211,114 @@ struct TupleOp {
   void adjust_access_displacement();
 };
 
+/*! ScaledSquaresOp.
+ * @brief Maps each element of a vector to the ScaledSquaresTuple of its
+ * square (map (\x -> [|x|, 1]) vector), to be reduced with
+ * ScaledSquaresAddOperator.
+ */
+template <typename rhs_t>
+struct ScaledSquaresOp {
+  using index_t = typename rhs_t::index_t;
+  using value_t = ScaledSquaresTuple<typename rhs_t::value_t>;
+  rhs_t rhs_;
+  ScaledSquaresOp(rhs_t &_r);
+  index_t get_size() const;
+  bool valid_thread(cl::sycl::nd_item<1> ndItem) const;
+  value_t eval(index_t i);
+  value_t eval(cl::sycl::nd_item<1> ndItem);
+  void bind(cl::sycl::handler &h);
+  void adjust_access_displacement();
+};
+
+/*! TypeCastOp.
+ * @brief Converts each element of a vector to cast_t. Reducing a TypeCastOp
+ * accumulates in cast_t rather than in the element type of the vector (e.g.
+ * half precision data accumulated in single precision).
+ */
+template <typename cast_t, typename rhs_t>
+struct TypeCastOp {
+  using index_t = typename rhs_t::index_t;
+  using value_t = cast_t;
+  rhs_t rhs_;
+  TypeCastOp(rhs_t &_r);
+  index_t get_size() const;
+  bool valid_thread(cl::sycl::nd_item<1> ndItem) const;
+  value_t eval(index_t i);
+  value_t eval(cl::sycl::nd_item<1> ndItem);
+  template <int packet_size>
+  cl::sycl::vec<value_t, packet_size> eval_packet(index_t i);
+  void bind(cl::sycl::handler &h);
+  void adjust_access_displacement();
+};
+
+template <typename cast_t, typename rhs_t>
+inline TypeCastOp<cast_t, rhs_t> make_type_cast_op(rhs_t &rhs_) {
+  return TypeCastOp<cast_t, rhs_t>(rhs_);
+}
+
+/*! PacketReduceOp.
+ * @brief Element i is the reduction with operator_t of the packet_size
+ * contiguous elements starting at i * packet_size, loaded as a
+ * cl::sycl::vec, so that a reduction over it loads a packet at each step of
+ * a work item. The last element reduces the remaining elements one by one.
+ * The leaves of rhs_t are assumed to have a stride of 1.
+ */
+template <typename operator_t, int packet_size, typename rhs_t>
+struct PacketReduceOp {
+  using index_t = typename rhs_t::index_t;
+  using value_t = typename rhs_t::value_t;
+  using packet_t = cl::sycl::vec<value_t, packet_size>;
+  rhs_t rhs_;
+  PacketReduceOp(rhs_t &_r);
+  index_t get_size() const;
+  bool valid_thread(cl::sycl::nd_item<1> ndItem) const;
+  value_t eval(index_t i);
+  value_t eval(cl::sycl::nd_item<1> ndItem);
+  void bind(cl::sycl::handler &h);
+  void adjust_access_displacement();
+};
+
+template <typename operator_t, int packet_size, typename rhs_t>
+inline PacketReduceOp<operator_t, packet_size, rhs_t> make_packet_reduce_op(
+    rhs_t &rhs_) {
+  return PacketReduceOp<operator_t, packet_size, rhs_t>(rhs_);
+}
+
+/*! StridedBatchOp.
+ * @brief Concatenates batch_size_ vectors of size vector_size_, the b-th one
+ * starting at b * batch_stride_ in rhs_ and with increment inc_, so that
+ * element k of the operation is element k % vector_size_ of vector
+ * k / vector_size_.
+ */
+template <typename rhs_t>
+struct StridedBatchOp {
+  using index_t = typename rhs_t::index_t;
+  using value_t = typename rhs_t::value_t;
+  rhs_t rhs_;
+  index_t vector_size_;
+  index_t inc_;
+  index_t batch_stride_;
+  index_t batch_size_;
+  StridedBatchOp(rhs_t &_r, index_t _vecS, index_t _inc, index_t _stride,
+                 index_t _batchS);
+  index_t get_size() const;
+  bool valid_thread(cl::sycl::nd_item<1> ndItem) const;
+  value_t eval(index_t i);
+  value_t eval(cl::sycl::nd_item<1> ndItem);
+  void bind(cl::sycl::handler &h);
+  void adjust_access_displacement();
+};
+
+template <typename rhs_t, typename index_t>
+inline StridedBatchOp<rhs_t> make_strided_batch_op(rhs_t &rhs_,
+                                                    index_t vector_size_,
+                                                    index_t inc_,
+                                                    index_t batch_stride_,
+                                                    index_t batch_size_) {
+  return StridedBatchOp<rhs_t>(rhs_, vector_size_, inc_, batch_stride_,
+                               batch_size_);
+}
+
 /*! AssignReduction.
  * @brief Implements the reduction operation for assignments (in the form y
  * = x) with y a scalar and x a subexpression tree.
@@ -190,6 +350,344 @@ inline AssignReduction<operator_t, lhs_t, rhs_t> make_AssignReduction(
       lhs_, rhs_, local_num_thread_, global_num_thread_);
 }
 
+/*! SinglePassAssignReduction.
+ * @brief Implements the reduction operation for assignments (in the form y
+ * = x) with y a scalar and x a subexpression tree, in a single kernel.
+ * Each work group writes its partial result in partials_ and increments
+ * counter_; the last work group to do so combines the partial results into
+ * lhs_ and resets the counter to zero for the next launch.
+ */
+template <typename operator_t, typename lhs_t, typename rhs_t,
+          typename counter_t>
+struct SinglePassAssignReduction {
+  using value_t = typename ResolveReturnType<operator_t, rhs_t>::type::value_t;
+  using index_t = typename rhs_t::index_t;
+  lhs_t lhs_;
+  rhs_t rhs_;
+  lhs_t partials_;             // one element per work group
+  counter_t counter_;          // number of work groups done
+  index_t local_num_thread_;   // block  size
+  index_t global_num_thread_;  // grid  size
+  SinglePassAssignReduction(lhs_t &_l, rhs_t &_r, lhs_t &_partials,
+                            counter_t &_counter, index_t _blqS,
+                            index_t _grdS);
+  index_t get_size() const;
+  bool valid_thread(cl::sycl::nd_item<1> ndItem) const;
+  template <typename sharedT>
+  value_t eval(sharedT scratch, cl::sycl::nd_item<1> ndItem);
+  void bind(cl::sycl::handler &h);
+  void adjust_access_displacement();
+};
+
+template <typename operator_t, typename lhs_t, typename rhs_t,
+          typename counter_t, typename index_t>
+inline SinglePassAssignReduction<operator_t, lhs_t, rhs_t, counter_t>
+make_single_pass_reduction(lhs_t &lhs_, rhs_t &rhs_, lhs_t &partials_,
+                           counter_t &counter_, index_t local_num_thread_,
+                           index_t global_num_thread_) {
+  return SinglePassAssignReduction<operator_t, lhs_t, rhs_t, counter_t>(
+      lhs_, rhs_, partials_, counter_, local_num_thread_, global_num_thread_);
+}
+
+/*! BatchedAssignReduction.
+ * @brief Reduces each of the lhs_.get_size() consecutive vectors of size
+ * vector_size_ of rhs_ (e.g. a StridedBatchOp) into the matching element of
+ * lhs_, then applies post_op_t to it. Each work group owns one vector, so the
+ * whole batch is reduced by a single kernel.
+ */
+template <typename operator_t, typename lhs_t, typename rhs_t,
+          typename post_op_t>
+struct BatchedAssignReduction {
+  using value_t = typename ResolveReturnType<operator_t, rhs_t>::type::value_t;
+  using index_t = typename rhs_t::index_t;
+  lhs_t lhs_;
+  rhs_t rhs_;
+  index_t vector_size_;
+  index_t local_num_thread_;  // block  size
+  BatchedAssignReduction(lhs_t &_l, rhs_t &_r, index_t _vecS, index_t _blqS);
+  index_t get_size() const;
+  bool valid_thread(cl::sycl::nd_item<1> ndItem) const;
+  template <typename sharedT>
+  value_t eval(sharedT scratch, cl::sycl::nd_item<1> ndItem);
+  void bind(cl::sycl::handler &h);
+  void adjust_access_displacement();
+};
+
+template <typename operator_t, typename post_op_t = IdentityOperator,
+          typename lhs_t, typename rhs_t, typename index_t>
+inline BatchedAssignReduction<operator_t, lhs_t, rhs_t, post_op_t>
+make_batched_reduction(lhs_t &lhs_, rhs_t &rhs_, index_t vector_size_,
+                       index_t local_num_thread_) {
+  return BatchedAssignReduction<operator_t, lhs_t, rhs_t, post_op_t>(
+      lhs_, rhs_, vector_size_, local_num_thread_);
+}
+
+/*! ReductionSlots.
+ * @brief Packs the accumulator of a reduction computed by a
+ * MultiAssignReduction in consecutive slots of the type of the results, in
+ * the private, local and partial buffers of the kernel. slot(j) returns a
+ * reference to the j-th slot of the accumulator. A plain value takes a single
+ * slot.
+ */
+template <typename acc_t>
+struct ReductionSlots {
+  using value_t = acc_t;
+  static constexpr int num_slots = 1;
+  template <typename slot_t>
+  static acc_t load(slot_t slot);
+  template <typename slot_t>
+  static void store(slot_t slot, const acc_t &acc);
+};
+
+/*!
+ * @brief A ScaledSquaresTuple takes two slots, its scale and its sum of
+ * squares.
+ */
+template <typename val_t>
+struct ReductionSlots<ScaledSquaresTuple<val_t>> {
+  using value_t = val_t;
+  static constexpr int num_slots = 2;
+  template <typename slot_t>
+  static ScaledSquaresTuple<val_t> load(slot_t slot);
+  template <typename slot_t>
+  static void store(slot_t slot, const ScaledSquaresTuple<val_t> &acc);
+};
+
+/*! ReductionEntry.
+ * @brief One of the reductions computed by a MultiAssignReduction: map_t
+ * applied to the values of the operands, reduced with operator_t, then
+ * post_op_t applied to the result (e.g. the norm of a ScaledSquaresTuple for
+ * nrm2).
+ */
+template <typename operator_t, typename map_t, typename post_op_t>
+struct ReductionEntry {};
+
+template <typename operator_t, typename map_t,
+          typename post_op_t = IdentityOperator>
+inline ReductionEntry<operator_t, map_t, post_op_t> make_reduction_entry() {
+  return ReductionEntry<operator_t, map_t, post_op_t>();
+}
+
+/*! ReductionOperands.
+ * @brief Operands of a MultiAssignReduction. accumulate evaluates each of them
+ * once at index i, in this order, and passes the values to every reduction of
+ * the list.
+ */
+template <typename... operand_t>
+struct ReductionOperands {
+  template <typename reductions_t, typename val_t, typename index_t,
+            typename... value_t>
+  void accumulate(const reductions_t &reductions, val_t *val, index_t i,
+                  const value_t &... values);
+  void bind(cl::sycl::handler &h);
+  void adjust_access_displacement();
+};
+
+template <typename head_operand_t, typename... operand_t>
+struct ReductionOperands<head_operand_t, operand_t...> {
+  using tail_t = ReductionOperands<operand_t...>;
+  using index_t = typename head_operand_t::index_t;
+  // Type of the value of map_t applied to the operands
+  template <typename map_t>
+  using map_value_t =
+      decltype(map_t::eval(std::declval<typename head_operand_t::value_t>(),
+                           std::declval<typename operand_t::value_t>()...));
+  head_operand_t head_;
+  tail_t tail_;
+  ReductionOperands(head_operand_t &_h, operand_t &... _t);
+  index_t get_size() const;
+  template <typename reductions_t, typename val_t, typename... value_t>
+  void accumulate(const reductions_t &reductions, val_t *val, index_t i,
+                  const value_t &... values);
+  void bind(cl::sycl::handler &h);
+  void adjust_access_displacement();
+};
+
+template <typename... operand_t>
+inline ReductionOperands<operand_t...> make_reduction_operands(
+    operand_t &... operands_) {
+  return ReductionOperands<operand_t...>(operands_...);
+}
+
+/*! ReductionList.
+ * @brief List of the reductions computed by a MultiAssignReduction over the
+ * operands operands_t. The reduction at position offset of the list writes
+ * its result to element offset of the output, and accumulates in the slots
+ * starting at slot of the private array and of the local and partial buffers,
+ * which hold one slice per slot.
+ */
+template <int offset, int slot, typename operands_t, typename... entry_t>
+struct ReductionList {
+  static constexpr int num_reductions = 0;
+  static constexpr int num_slots = 0;
+  template <typename value_t>
+  void init(value_t *val) const;
+  template <typename value_t, typename... operand_value_t>
+  void accumulate(value_t *val, const operand_value_t &... values) const;
+  template <typename sharedT, typename index_t>
+  void combine(sharedT scratch, index_t stride, index_t dst, index_t src) const;
+  template <typename value_t, typename partials_t, typename index_t>
+  void combine_partials(value_t *val, partials_t &partials, index_t stride,
+                        index_t i) const;
+  template <typename value_t, typename lhs_t>
+  void finalize(value_t *val, lhs_t &lhs) const;
+};
+
+template <int offset, int slot, typename operands_t, typename operator_t,
+          typename map_t, typename post_op_t, typename... entry_t>
+struct ReductionList<offset, slot, operands_t,
+                     ReductionEntry<operator_t, map_t, post_op_t>,
+                     entry_t...> {
+  using acc_t = typename operands_t::template map_value_t<map_t>;
+  // Stands for the mapped operands in operator_t::init
+  struct mapped_t {
+    using value_t = acc_t;
+  };
+  using slots_t = ReductionSlots<acc_t>;
+  using tail_t = ReductionList<offset + 1, slot + slots_t::num_slots,
+                               operands_t, entry_t...>;
+  using value_t = typename slots_t::value_t;
+  static constexpr int num_reductions = 1 + tail_t::num_reductions;
+  static constexpr int num_slots = slots_t::num_slots + tail_t::num_slots;
+  template <typename val_t>
+  void init(val_t *val) const;
+  template <typename val_t, typename... operand_value_t>
+  void accumulate(val_t *val, const operand_value_t &... values) const;
+  template <typename sharedT, typename index_t>
+  void combine(sharedT scratch, index_t stride, index_t dst, index_t src) const;
+  template <typename val_t, typename partials_t, typename index_t>
+  void combine_partials(val_t *val, partials_t &partials, index_t stride,
+                        index_t i) const;
+  template <typename val_t, typename lhs_t>
+  void finalize(val_t *val, lhs_t &lhs) const;
+};
+
+/*! MultiAssignReduction.
+ * @brief Implements several reductions over the same range in a single
+ * traversal (in the form y[k] = reduction_k(map_k(x_0, ..., x_n))), with y a
+ * vector holding one result per reduction. Each operand x_j is evaluated once
+ * per index, and its value shared by all the reductions.
+ * The results share the value type of lhs_t, in which each reduction
+ * accumulates in one or more slots (see ReductionSlots).
+ */
+template <typename lhs_t, typename operands_t, typename reductions_t>
+struct MultiAssignReduction {
+  using value_t = typename reductions_t::value_t;
+  using index_t = typename operands_t::index_t;
+  lhs_t lhs_;
+  operands_t operands_;
+  reductions_t reductions_;
+  index_t local_num_thread_;   // block  size
+  index_t global_num_thread_;  // grid  size
+  MultiAssignReduction(lhs_t &_l, operands_t &_o, reductions_t &_r,
+                       index_t _blqS, index_t _grdS);
+  index_t get_size() const;
+};
+
+template <typename lhs_t, typename operands_t, typename index_t,
+          typename... entry_t>
+inline MultiAssignReduction<lhs_t, operands_t,
+                            ReductionList<0, 0, operands_t, entry_t...>>
+make_multi_reduction(lhs_t &lhs_, operands_t &operands_,
+                     index_t local_num_thread_, index_t global_num_thread_,
+                     entry_t... entries_) {
+  auto reductions_ = ReductionList<0, 0, operands_t, entry_t...>();
+  return MultiAssignReduction<lhs_t, operands_t,
+                              ReductionList<0, 0, operands_t, entry_t...>>(
+      lhs_, operands_, reductions_, local_num_thread_, global_num_thread_);
+}
+
+/*! SinglePassMultiAssignReduction.
+ * @brief Kernel of a MultiAssignReduction. It follows the same scheme as
+ * SinglePassAssignReduction, with one slice of the local memory and of the
+ * partial results per slot of the reductions.
+ */
+template <typename lhs_t, typename operands_t, typename reductions_t,
+          typename counter_t>
+struct SinglePassMultiAssignReduction {
+  using value_t = typename reductions_t::value_t;
+  using index_t = typename operands_t::index_t;
+  static constexpr int num_slots = reductions_t::num_slots;
+  lhs_t lhs_;
+  operands_t operands_;
+  reductions_t reductions_;
+  lhs_t partials_;             // num_slots slices of one element per work
+                               // group
+  counter_t counter_;          // number of work groups done
+  index_t local_num_thread_;   // block  size
+  index_t global_num_thread_;  // grid  size
+  SinglePassMultiAssignReduction(lhs_t &_l, operands_t &_o, reductions_t &_r,
+                                 lhs_t &_partials, counter_t &_counter,
+                                 index_t _blqS, index_t _grdS);
+  index_t get_size() const;
+  bool valid_thread(cl::sycl::nd_item<1> ndItem) const;
+  template <typename sharedT>
+  value_t eval(sharedT scratch, cl::sycl::nd_item<1> ndItem);
+  void bind(cl::sycl::handler &h);
+  void adjust_access_displacement();
+};
+
+template <typename lhs_t, typename operands_t, typename reductions_t,
+          typename counter_t, typename index_t>
+inline SinglePassMultiAssignReduction<lhs_t, operands_t, reductions_t,
+                                      counter_t>
+make_single_pass_multi_reduction(lhs_t &lhs_, operands_t &operands_,
+                                 reductions_t &reductions_, lhs_t &partials_,
+                                 counter_t &counter_,
+                                 index_t local_num_thread_,
+                                 index_t global_num_thread_) {
+  return SinglePassMultiAssignReduction<lhs_t, operands_t, reductions_t,
+                                        counter_t>(
+      lhs_, operands_, reductions_, partials_, counter_, local_num_thread_,
+      global_num_thread_);
+}
+
+/*! MultiPassMultiAssignReduction.
+ * @brief Step of a MultiAssignReduction on devices without single pass
+ * reductions, following the multi-pass scheme of AssignReduction. The first
+ * step reduces the operands and each of the next ones the partial results of
+ * the previous step, held in in_ as num_slots slices of in_size_ elements.
+ * Every work group writes its partial results to out_, except in the step
+ * run by a single work group, which writes the results to lhs_.
+ */
+template <typename lhs_t, typename operands_t, typename reductions_t>
+struct MultiPassMultiAssignReduction {
+  using value_t = typename reductions_t::value_t;
+  using index_t = typename operands_t::index_t;
+  static constexpr int num_slots = reductions_t::num_slots;
+  lhs_t lhs_;
+  operands_t operands_;
+  reductions_t reductions_;
+  lhs_t in_;                   // partial results of the previous step
+  lhs_t out_;                  // num_slots slices of one element per work
+                               // group
+  index_t in_size_;            // 0 in the first step
+  index_t local_num_thread_;   // block  size
+  index_t global_num_thread_;  // grid  size
+  MultiPassMultiAssignReduction(lhs_t &_l, operands_t &_o, reductions_t &_r,
+                                lhs_t &_in, lhs_t &_out, index_t _in_size,
+                                index_t _blqS, index_t _grdS);
+  index_t get_size() const;
+  bool valid_thread(cl::sycl::nd_item<1> ndItem) const;
+  template <typename sharedT>
+  value_t eval(sharedT scratch, cl::sycl::nd_item<1> ndItem);
+  void bind(cl::sycl::handler &h);
+  void adjust_access_displacement();
+};
+
+template <typename lhs_t, typename operands_t, typename reductions_t,
+          typename index_t>
+inline MultiPassMultiAssignReduction<lhs_t, operands_t, reductions_t>
+make_multi_pass_multi_reduction(lhs_t &lhs_, operands_t &operands_,
+                                reductions_t &reductions_, lhs_t &in_,
+                                lhs_t &out_, index_t in_size_,
+                                index_t local_num_thread_,
+                                index_t global_num_thread_) {
+  return MultiPassMultiAssignReduction<lhs_t, operands_t, reductions_t>(
+      lhs_, operands_, reductions_, in_, out_, in_size_, local_num_thread_,
+      global_num_thread_);
+}
+
 /*!
 @brief Template function for constructing operation nodes based on input
 template and function arguments. Non-specialized case for N reference operands.
@@ -246,6 +744,11 @@ inline TupleOp<rhs_t> make_tuple_op(rhs_t &rhs_) {
   return TupleOp<rhs_t>(rhs_);
 }
 
+template <typename rhs_t>
+inline ScaledSquaresOp<rhs_t> make_scaled_squares_op(rhs_t &rhs_) {
+  return ScaledSquaresOp<rhs_t>(rhs_);
+}
+
 }  // namespace blas
 
 #endif  // BLAS1_TREES_H
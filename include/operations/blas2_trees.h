@@ -103,6 +103,245 @@ make_Gemv(lhs_t &lhs_, matrix_t &matrix_, vector_t &vector_,
                                                 wgs_per_nc_, wgs_per_c_);
 }
 
+/*!
+ * @brief GemvSingleKernel computes y = alpha * op(A) * x + beta * y in a single
+ * kernel, without a temporary buffer of partial dot products.
+ *
+ * Each work group computes local_range / c_lanes consecutive elements of y.
+ * The c_lanes work items assigned to an element of y split its dot product,
+ * and their partial sums are reduced in local memory before the work item of
+ * the first lane applies alpha and beta. This suits matrices with a short
+ * contracting dimension, for which the launch of a second kernel to sum the
+ * partial dot products dominates.
+ *
+ * @tparam local_range  the number of work items per work group
+ * @tparam c_lanes  the number of work items sharing a dot product, a power of
+ *                  two dividing local_range
+ * @tparam is_transposed  whether the input matrix is transposed
+ * @param lhs_        the vector y, read when beta is not zero and written
+ * @param matrix_a_   the input matrix a
+ * @param vector_x_   the input vector x
+ * @param alpha_      the scalar alpha
+ * @param beta_       the scalar beta
+ */
+template <typename lhs_t, typename matrix_t, typename vector_t,
+          uint32_t local_range, uint32_t c_lanes, bool is_transposed>
+struct GemvSingleKernel {
+  using value_t = typename std::remove_cv<typename vector_t::value_t>::type;
+  using index_t = typename vector_t::index_t;
+  static constexpr index_t nc_per_wg = local_range / c_lanes;
+  lhs_t lhs_;
+  matrix_t matrix_a_;
+  vector_t vector_x_;
+  value_t alpha_;
+  value_t beta_;
+
+  GemvSingleKernel(lhs_t &_l, matrix_t &_matrix, vector_t &_vector,
+                   value_t _alpha, value_t _beta);
+  index_t get_num_workgroups() const;
+  bool valid_thread(cl::sycl::nd_item<1> ndItem) const;
+  template <typename local_memory_t>
+  value_t eval(local_memory_t local_mem, cl::sycl::nd_item<1> ndItem);
+  void bind(cl::sycl::handler &h);
+  void adjust_access_displacement();
+};
+
+/*!
+ * @brief Contructs an instance of the GemvSingleKernel class
+ */
+template <uint32_t local_range, uint32_t c_lanes, bool is_transposed,
+          typename lhs_t, typename matrix_t, typename vector_t>
+GemvSingleKernel<lhs_t, matrix_t, vector_t, local_range, c_lanes,
+                 is_transposed>
+make_gemv_single_kernel(lhs_t &lhs_, matrix_t &matrix_, vector_t &vector_,
+                        typename vector_t::value_t alpha_,
+                        typename vector_t::value_t beta_) {
+  return GemvSingleKernel<lhs_t, matrix_t, vector_t, local_range, c_lanes,
+                          is_transposed>(lhs_, matrix_, vector_, alpha_, beta_);
+}
+
+/*!
+ * @brief GemvMultiRhs computes Y = alpha * op(A) * X + beta * Y, where X and Y
+ * hold n_rhs vectors each, reading the matrix A only once.
+ *
+ * The work is split as in GemvSingleKernel, but each lane accumulates the
+ * partial dot products of the n_rhs vectors for every element of A it loads,
+ * so applying the same matrix to several vectors costs a single pass over A.
+ * The n_rhs partial sums of the lanes are reduced in local memory, which must
+ * hold local_range * n_rhs elements.
+ *
+ * @tparam local_range  the number of work items per work group
+ * @tparam c_lanes  the number of work items sharing a dot product, a power of
+ *                  two dividing local_range
+ * @tparam n_rhs  the number of vectors, i.e. columns of X and Y
+ * @tparam is_transposed  whether the input matrix is transposed
+ * @param lhs_        the matrix Y, read when beta is not zero and written
+ * @param matrix_a_   the input matrix A
+ * @param matrix_x_   the input matrix X
+ * @param alpha_      the scalar alpha
+ * @param beta_       the scalar beta
+ */
+template <typename lhs_t, typename matrix_t, typename rhs_t,
+          uint32_t local_range, uint32_t c_lanes, uint32_t n_rhs,
+          bool is_transposed>
+struct GemvMultiRhs {
+  using value_t = typename std::remove_cv<typename rhs_t::value_t>::type;
+  using index_t = typename rhs_t::index_t;
+  static constexpr index_t nc_per_wg = local_range / c_lanes;
+  lhs_t lhs_;
+  matrix_t matrix_a_;
+  rhs_t matrix_x_;
+  value_t alpha_;
+  value_t beta_;
+
+  GemvMultiRhs(lhs_t &_l, matrix_t &_matrix_a, rhs_t &_matrix_x,
+               value_t _alpha, value_t _beta);
+  index_t get_num_workgroups() const;
+  bool valid_thread(cl::sycl::nd_item<1> ndItem) const;
+  template <typename local_memory_t>
+  value_t eval(local_memory_t local_mem, cl::sycl::nd_item<1> ndItem);
+  void bind(cl::sycl::handler &h);
+  void adjust_access_displacement();
+};
+
+/*!
+ * @brief Contructs an instance of the GemvMultiRhs class
+ */
+template <uint32_t local_range, uint32_t c_lanes, uint32_t n_rhs,
+          bool is_transposed, typename lhs_t, typename matrix_t,
+          typename rhs_t>
+GemvMultiRhs<lhs_t, matrix_t, rhs_t, local_range, c_lanes, n_rhs,
+             is_transposed>
+make_gemv_multi_rhs(lhs_t &lhs_, matrix_t &matrix_a_, rhs_t &matrix_x_,
+                    typename rhs_t::value_t alpha_,
+                    typename rhs_t::value_t beta_) {
+  return GemvMultiRhs<lhs_t, matrix_t, rhs_t, local_range, c_lanes, n_rhs,
+                      is_transposed>(lhs_, matrix_a_, matrix_x_, alpha_,
+                                     beta_);
+}
+
+/*!
+ * @brief GemvBatched computes y_b = alpha * op(A_b) * x_b + beta * y_b for
+ * every item b of a batch of small matrix vector products, in a single kernel.
+ *
+ * Each work item computes a whole element of one of the output vectors, so
+ * the batch is processed without temporary buffers and a single launch
+ * replaces one GEMV per matrix. The batch is laid out as in the batched GEMM
+ * (see gemm_batch_type_t):
+ *  - strided: the matrices, the x vectors and the y vectors of the batch are
+ *    stored one after the other.
+ *  - interleaved: the batch is the fastest dimension, i.e. element i of item b
+ *    is stored at i * batch_size + b, so that neighbouring work items access
+ *    neighbouring elements.
+ *
+ * @tparam is_transposed  whether the input matrices are transposed
+ * @tparam batch_type  the layout of the batch, a gemm_batch_type_t
+ * @param lhs_        the vectors y, read when beta is not zero and written
+ * @param matrix_a_   a view of the first matrix of the batch, its leading
+ *                    dimension being the one of every matrix
+ * @param vector_x_   the vectors x
+ * @param alpha_      the scalar alpha
+ * @param beta_       the scalar beta
+ * @param inc_x_      the increment for the elements of each vector x
+ * @param inc_y_      the increment for the elements of each vector y
+ * @param batch_size_ the number of matrix vector products
+ */
+template <typename lhs_t, typename matrix_t, typename vector_t,
+          bool is_transposed, int batch_type>
+struct GemvBatched {
+  using value_t = typename std::remove_cv<typename vector_t::value_t>::type;
+  using index_t = typename vector_t::index_t;
+  lhs_t lhs_;
+  matrix_t matrix_a_;
+  vector_t vector_x_;
+  value_t alpha_;
+  value_t beta_;
+  index_t inc_x_;
+  index_t inc_y_;
+  index_t batch_size_;
+
+  GemvBatched(lhs_t &_l, matrix_t &_matrix, vector_t &_vector, value_t _alpha,
+              value_t _beta, index_t _inc_x, index_t _inc_y,
+              index_t _batch_size);
+  index_t get_size() const;
+  bool valid_thread(cl::sycl::nd_item<1> ndItem) const;
+  value_t eval(index_t i);
+  value_t eval(cl::sycl::nd_item<1> ndItem);
+  void bind(cl::sycl::handler &h);
+  void adjust_access_displacement();
+};
+
+/*!
+ * @brief Contructs an instance of the GemvBatched class
+ */
+template <bool is_transposed, int batch_type, typename lhs_t,
+          typename matrix_t, typename vector_t>
+GemvBatched<lhs_t, matrix_t, vector_t, is_transposed, batch_type>
+make_gemv_batched(lhs_t &lhs_, matrix_t &matrix_, vector_t &vector_,
+                  typename vector_t::value_t alpha_,
+                  typename vector_t::value_t beta_,
+                  typename vector_t::index_t inc_x_,
+                  typename vector_t::index_t inc_y_,
+                  typename vector_t::index_t batch_size_) {
+  return GemvBatched<lhs_t, matrix_t, vector_t, is_transposed, batch_type>(
+      lhs_, matrix_, vector_, alpha_, beta_, inc_x_, inc_y_, batch_size_);
+}
+
+/*!
+ * @brief Symv computes the partial products of y = A * x with a symmetric
+ * matrix A of which only one triangle is stored, reading that triangle once.
+ *
+ * The matrix is split in square tiles of tile_size elements, and each work
+ * group loads one tile of the stored triangle in local memory. An
+ * off-diagonal tile A_IJ contributes A_IJ * x_J to the block I of y and
+ * A_IJ^T * x_I to the block J of y, while a diagonal tile is mirrored to
+ * contribute its symmetric product to the block I. The contribution of the
+ * tile (I, J) to the block I is written to the column J of lhs_, and the one
+ * to the block J to the column I, so that every element of the N x nb matrix
+ * lhs_ is written exactly once and y is the sum of its columns.
+ *
+ * Work groups have 2 * tile_size work items, the first half computing the row
+ * products and the second half the transposed ones.
+ *
+ * @tparam tile_size  the number of rows and columns of the tiles
+ * @tparam is_upper  whether the upper triangle of A is stored
+ * @param lhs_        the N x nb matrix of partial products
+ * @param matrix_a_   the symmetric input matrix A
+ * @param vector_x_   the input vector x
+ */
+template <typename lhs_t, typename matrix_t, typename vector_t,
+          uint32_t tile_size, bool is_upper>
+struct Symv {
+  using value_t = typename std::remove_cv<typename vector_t::value_t>::type;
+  using index_t = typename vector_t::index_t;
+  static constexpr index_t local_range = 2 * tile_size;
+  // Local memory used by the kernel: the padded tile and two blocks of x
+  static constexpr index_t local_memory_size =
+      tile_size * (tile_size + 1) + 2 * tile_size;
+  lhs_t lhs_;
+  matrix_t matrix_a_;
+  vector_t vector_x_;
+
+  Symv(lhs_t &_l, matrix_t &_matrix, vector_t &_vector);
+  index_t get_num_tiles() const;
+  bool valid_thread(cl::sycl::nd_item<1> ndItem) const;
+  template <typename local_memory_t>
+  value_t eval(local_memory_t local_mem, cl::sycl::nd_item<1> ndItem);
+  void bind(cl::sycl::handler &h);
+  void adjust_access_displacement();
+};
+
+/*!
+ * @brief Contructs an instance of the Symv class
+ */
+template <uint32_t tile_size, bool is_upper, typename lhs_t,
+          typename matrix_t, typename vector_t>
+Symv<lhs_t, matrix_t, vector_t, tile_size, is_upper> make_symv(
+    lhs_t &lhs_, matrix_t &matrix_, vector_t &vector_) {
+  return Symv<lhs_t, matrix_t, vector_t, tile_size, is_upper>(lhs_, matrix_,
+                                                              vector_);
+}
+
 template <typename rhs_t>
 struct SumMatrixColumns {
   using value_t = typename rhs_t::value_t;
@@ -304,5 +543,317 @@ GerCol<Single, Lower, Diag, Upper, lhs_t, rhs_1_t, rhs_2_t> make_Ger_Col(
       lhs_, scalar_, rhs_1_, rhs_2_, nWG_row_, nWG_col_, local_memory_size_);
 }
 
+/*!
+ * @brief Gbmv computes y = alpha * op(A) * x + beta * y for a general band
+ * matrix A with kl sub-diagonals and ku super-diagonals, one element of y per
+ * work item.
+ *
+ * The matrix is stored in band format: matrix_a_ views the (kl + ku + 1) x N
+ * array holding the diagonals, A(i, j) being its element (ku + i - j, j), so
+ * that only the band is read.
+ *
+ * @tparam is_transposed  whether the input matrix is transposed
+ * @param lhs_        the vector y, read when beta is not zero and written
+ * @param matrix_a_   the band storage of the matrix A
+ * @param vector_x_   the input vector x
+ */
+template <typename lhs_t, typename matrix_t, typename vector_t,
+          bool is_transposed>
+struct Gbmv {
+  using value_t = typename std::remove_cv<typename vector_t::value_t>::type;
+  using index_t = typename vector_t::index_t;
+  lhs_t lhs_;
+  matrix_t matrix_a_;
+  vector_t vector_x_;
+  index_t kl_;
+  index_t ku_;
+  value_t alpha_;
+  value_t beta_;
+
+  Gbmv(lhs_t &_l, matrix_t &_matrix, vector_t &_vector, index_t _kl,
+       index_t _ku, value_t _alpha, value_t _beta);
+  index_t get_size() const;
+  bool valid_thread(cl::sycl::nd_item<1> ndItem) const;
+  value_t eval(index_t i);
+  value_t eval(cl::sycl::nd_item<1> ndItem);
+  void bind(cl::sycl::handler &h);
+  void adjust_access_displacement();
+};
+
+template <bool is_transposed, typename lhs_t, typename matrix_t,
+          typename vector_t>
+Gbmv<lhs_t, matrix_t, vector_t, is_transposed> make_gbmv(
+    lhs_t &lhs_, matrix_t &matrix_, vector_t &vector_,
+    typename vector_t::index_t kl_, typename vector_t::index_t ku_,
+    typename vector_t::value_t alpha_, typename vector_t::value_t beta_) {
+  return Gbmv<lhs_t, matrix_t, vector_t, is_transposed>(
+      lhs_, matrix_, vector_, kl_, ku_, alpha_, beta_);
+}
+
+/*!
+ * @brief Sbmv computes y = alpha * A * x + beta * y for a symmetric band
+ * matrix A with k super-diagonals, one element of y per work item.
+ *
+ * matrix_a_ views the (k + 1) x N band storage of the stored triangle: A(i, j)
+ * with i <= j is its element (k + i - j, j) when the upper triangle is stored,
+ * and A(i, j) with i >= j its element (i - j, j) otherwise.
+ *
+ * @tparam is_upper  whether the upper triangle of A is stored
+ */
+template <typename lhs_t, typename matrix_t, typename vector_t, bool is_upper>
+struct Sbmv {
+  using value_t = typename std::remove_cv<typename vector_t::value_t>::type;
+  using index_t = typename vector_t::index_t;
+  lhs_t lhs_;
+  matrix_t matrix_a_;
+  vector_t vector_x_;
+  index_t k_;
+  value_t alpha_;
+  value_t beta_;
+
+  Sbmv(lhs_t &_l, matrix_t &_matrix, vector_t &_vector, index_t _k,
+       value_t _alpha, value_t _beta);
+  index_t get_size() const;
+  bool valid_thread(cl::sycl::nd_item<1> ndItem) const;
+  value_t eval(index_t i);
+  value_t eval(cl::sycl::nd_item<1> ndItem);
+  void bind(cl::sycl::handler &h);
+  void adjust_access_displacement();
+};
+
+template <bool is_upper, typename lhs_t, typename matrix_t, typename vector_t>
+Sbmv<lhs_t, matrix_t, vector_t, is_upper> make_sbmv(
+    lhs_t &lhs_, matrix_t &matrix_, vector_t &vector_,
+    typename vector_t::index_t k_, typename vector_t::value_t alpha_,
+    typename vector_t::value_t beta_) {
+  return Sbmv<lhs_t, matrix_t, vector_t, is_upper>(lhs_, matrix_, vector_, k_,
+                                                   alpha_, beta_);
+}
+
+/*!
+ * @brief Tbmv computes x = op(A) * x for a triangular band matrix A with k
+ * off-diagonals, one element of x per work item. The band storage is the one
+ * of Sbmv.
+ *
+ * Since every element of x is an input of several work items, vector_x_ is a
+ * copy of x made before the kernel, and lhs_ is x itself.
+ *
+ * @tparam is_upper  whether A is upper triangular
+ * @tparam is_transposed  whether A is transposed
+ * @param unit_diag_  whether the diagonal of A is assumed to be ones
+ */
+template <typename lhs_t, typename matrix_t, typename vector_t, bool is_upper,
+          bool is_transposed>
+struct Tbmv {
+  using value_t = typename std::remove_cv<typename vector_t::value_t>::type;
+  using index_t = typename vector_t::index_t;
+  lhs_t lhs_;
+  matrix_t matrix_a_;
+  vector_t vector_x_;
+  index_t k_;
+  bool unit_diag_;
+
+  Tbmv(lhs_t &_l, matrix_t &_matrix, vector_t &_vector, index_t _k,
+       bool _unit_diag);
+  index_t get_size() const;
+  bool valid_thread(cl::sycl::nd_item<1> ndItem) const;
+  value_t eval(index_t i);
+  value_t eval(cl::sycl::nd_item<1> ndItem);
+  void bind(cl::sycl::handler &h);
+  void adjust_access_displacement();
+};
+
+template <bool is_upper, bool is_transposed, typename lhs_t,
+          typename matrix_t, typename vector_t>
+Tbmv<lhs_t, matrix_t, vector_t, is_upper, is_transposed> make_tbmv(
+    lhs_t &lhs_, matrix_t &matrix_, vector_t &vector_,
+    typename vector_t::index_t k_, bool unit_diag_) {
+  return Tbmv<lhs_t, matrix_t, vector_t, is_upper, is_transposed>(
+      lhs_, matrix_, vector_, k_, unit_diag_);
+}
+
+/*!
+ * @brief Tbsv solves op(A) * x = b for a triangular band matrix A with k
+ * off-diagonals, b being overwritten by x. The band storage is the one of
+ * Sbmv.
+ *
+ * The solve is sequential along the rows, so the kernel runs a single work
+ * group of local_range work items. For each row, the work items share the
+ * products of the already solved elements of x in the band, which are reduced
+ * in local memory before the first work item updates the element of the row.
+ *
+ * @tparam local_range  the number of work items, a power of two
+ * @tparam is_upper  whether A is upper triangular
+ * @tparam is_transposed  whether A is transposed
+ * @param unit_diag_  whether the diagonal of A is assumed to be ones
+ */
+template <typename lhs_t, typename matrix_t, uint32_t local_range,
+          bool is_upper, bool is_transposed>
+struct Tbsv {
+  using value_t = typename std::remove_cv<typename lhs_t::value_t>::type;
+  using index_t = typename lhs_t::index_t;
+  lhs_t lhs_;
+  matrix_t matrix_a_;
+  index_t k_;
+  bool unit_diag_;
+
+  Tbsv(lhs_t &_l, matrix_t &_matrix, index_t _k, bool _unit_diag);
+  bool valid_thread(cl::sycl::nd_item<1> ndItem) const;
+  template <typename local_memory_t>
+  value_t eval(local_memory_t local_mem, cl::sycl::nd_item<1> ndItem);
+  void bind(cl::sycl::handler &h);
+  void adjust_access_displacement();
+};
+
+template <uint32_t local_range, bool is_upper, bool is_transposed,
+          typename lhs_t, typename matrix_t>
+Tbsv<lhs_t, matrix_t, local_range, is_upper, is_transposed> make_tbsv(
+    lhs_t &lhs_, matrix_t &matrix_, typename lhs_t::index_t k_,
+    bool unit_diag_) {
+  return Tbsv<lhs_t, matrix_t, local_range, is_upper, is_transposed>(
+      lhs_, matrix_, k_, unit_diag_);
+}
+
+/*!
+ * @brief Spmv computes y = alpha * A * x + beta * y for a symmetric matrix A
+ * in packed format, one element of y per work item.
+ *
+ * matrix_a_ views the N * (N + 1) / 2 packed elements of the stored triangle,
+ * column by column: A(i, j) with i <= j is at i + j * (j + 1) / 2 when the
+ * upper triangle is stored, and A(i, j) with i >= j is at
+ * i + j * (2 * N - j - 1) / 2 otherwise.
+ *
+ * @tparam is_upper  whether the upper triangle of A is stored
+ */
+template <typename lhs_t, typename matrix_t, typename vector_t, bool is_upper>
+struct Spmv {
+  using value_t = typename std::remove_cv<typename vector_t::value_t>::type;
+  using index_t = typename vector_t::index_t;
+  lhs_t lhs_;
+  matrix_t matrix_a_;
+  vector_t vector_x_;
+  value_t alpha_;
+  value_t beta_;
+
+  Spmv(lhs_t &_l, matrix_t &_matrix, vector_t &_vector, value_t _alpha,
+       value_t _beta);
+  index_t get_size() const;
+  bool valid_thread(cl::sycl::nd_item<1> ndItem) const;
+  value_t eval(index_t i);
+  value_t eval(cl::sycl::nd_item<1> ndItem);
+  void bind(cl::sycl::handler &h);
+  void adjust_access_displacement();
+};
+
+template <bool is_upper, typename lhs_t, typename matrix_t, typename vector_t>
+Spmv<lhs_t, matrix_t, vector_t, is_upper> make_spmv(
+    lhs_t &lhs_, matrix_t &matrix_, vector_t &vector_,
+    typename vector_t::value_t alpha_, typename vector_t::value_t beta_) {
+  return Spmv<lhs_t, matrix_t, vector_t, is_upper>(lhs_, matrix_, vector_,
+                                                   alpha_, beta_);
+}
+
+/*!
+ * @brief Tpmv computes x = op(A) * x for a triangular matrix A in the packed
+ * format of Spmv, one element of x per work item. As in Tbmv, vector_x_ is a
+ * copy of x and lhs_ is x itself.
+ *
+ * @tparam is_upper  whether A is upper triangular
+ * @tparam is_transposed  whether A is transposed
+ * @param unit_diag_  whether the diagonal of A is assumed to be ones
+ */
+template <typename lhs_t, typename matrix_t, typename vector_t, bool is_upper,
+          bool is_transposed>
+struct Tpmv {
+  using value_t = typename std::remove_cv<typename vector_t::value_t>::type;
+  using index_t = typename vector_t::index_t;
+  lhs_t lhs_;
+  matrix_t matrix_a_;
+  vector_t vector_x_;
+  bool unit_diag_;
+
+  Tpmv(lhs_t &_l, matrix_t &_matrix, vector_t &_vector, bool _unit_diag);
+  index_t get_size() const;
+  bool valid_thread(cl::sycl::nd_item<1> ndItem) const;
+  value_t eval(index_t i);
+  value_t eval(cl::sycl::nd_item<1> ndItem);
+  void bind(cl::sycl::handler &h);
+  void adjust_access_displacement();
+};
+
+template <bool is_upper, bool is_transposed, typename lhs_t,
+          typename matrix_t, typename vector_t>
+Tpmv<lhs_t, matrix_t, vector_t, is_upper, is_transposed> make_tpmv(
+    lhs_t &lhs_, matrix_t &matrix_, vector_t &vector_, bool unit_diag_) {
+  return Tpmv<lhs_t, matrix_t, vector_t, is_upper, is_transposed>(
+      lhs_, matrix_, vector_, unit_diag_);
+}
+
+/*!
+ * @brief TrsvBlock performs one step of a blocked triangular solve
+ * op(A) * x = b, for the diagonal block of rows block_ * block_size to
+ * (block_ + 1) * block_size.
+ *
+ * The diagonal blocks of A are inverted beforehand by DiagonalBlocksInverter.
+ * Each work group multiplies the inverse of the diagonal block with the
+ * corresponding elements of the right hand side in local memory, the first
+ * work group writing them to x. The work groups then subtract the product of
+ * the block column of op(A) below (or above, for a backward substitution) the
+ * diagonal block with these elements from the rest of the right hand side,
+ * one row per work item, which is a GEMV update.
+ *
+ * @tparam block_size  the size of the diagonal blocks
+ * @tparam local_range  the number of work items per work group, at least
+ *                      block_size
+ * @tparam is_upper  whether A is upper triangular
+ * @tparam is_transposed  whether A is transposed
+ * @param lhs_        the solution x
+ * @param matrix_a_   the triangular matrix A
+ * @param inv_a_      the inverses of the diagonal blocks of A, as a block_size
+ *                    x N matrix
+ * @param vector_b_   the right hand side, updated in place
+ * @param block_      the index of the diagonal block
+ */
+template <typename lhs_t, typename matrix_t, typename vector_t,
+          uint32_t block_size, uint32_t local_range, bool is_upper,
+          bool is_transposed>
+struct TrsvBlock {
+  using value_t = typename std::remove_cv<typename vector_t::value_t>::type;
+  using index_t = typename vector_t::index_t;
+  static constexpr index_t local_memory_size = block_size;
+  lhs_t lhs_;
+  matrix_t matrix_a_;
+  matrix_t inv_a_;
+  vector_t vector_b_;
+  index_t block_;
+
+  TrsvBlock(lhs_t &_l, matrix_t &_matrix, matrix_t &_inv_a, vector_t &_vector,
+            index_t _block);
+  index_t get_num_workgroups() const;
+  bool valid_thread(cl::sycl::nd_item<1> ndItem) const;
+  template <typename local_memory_t>
+  value_t eval(local_memory_t local_mem, cl::sycl::nd_item<1> ndItem);
+  void bind(cl::sycl::handler &h);
+  void adjust_access_displacement();
+
+ private:
+  void get_update_range(index_t &first, index_t &end) const;
+};
+
+/*!
+ * @brief Contructs an instance of the TrsvBlock class
+ */
+template <uint32_t block_size, uint32_t local_range, bool is_upper,
+          bool is_transposed, typename lhs_t, typename matrix_t,
+          typename vector_t>
+TrsvBlock<lhs_t, matrix_t, vector_t, block_size, local_range, is_upper,
+          is_transposed>
+make_trsv_block(lhs_t &lhs_, matrix_t &matrix_, matrix_t &inv_a_,
+                vector_t &vector_, typename vector_t::index_t block_) {
+  return TrsvBlock<lhs_t, matrix_t, vector_t, block_size, local_range,
+                   is_upper, is_transposed>(lhs_, matrix_, inv_a_, vector_,
+                                            block_);
+}
+
 }  // namespace blas
 #endif  // BLAS2_TREES_H
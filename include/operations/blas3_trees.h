@@ -58,6 +58,41 @@ enum class gemm_vectorization_t : int { none = 0, partial = 1, full = 2 };
  */
 enum class gemm_batch_type_t : int { strided = 0, interleaved = 1 };
 
+/*!
+ * @brief Activation applied by a GemmEpilogue to each element of C.
+ * none: the element is stored unchanged.
+ * relu: max(x, 0).
+ * clamp: min(max(x, lower), upper).
+ * gelu: the tanh approximation of the Gaussian error linear unit.
+ */
+enum class gemm_activation_t : int { none = 0, relu = 1, clamp = 2, gelu = 3 };
+
+/*!
+ * @brief Indicates which bias vector a GemmEpilogue adds to C.
+ * none: no bias is added.
+ * row: bias(i) is added to each element of row i (one value per row of C).
+ * column: bias(j) is added to each element of column j.
+ */
+enum class gemm_bias_t : int { none = 0, row = 1, column = 2 };
+
+/*!
+ * @brief Fields describing one problem in the schedule of a GemmGrouped: its
+ * sizes, the leading dimensions of its matrices and the offsets of their first
+ * elements in the buffers of A, B and C. count is the number of fields.
+ */
+enum class gemm_grouped_field_t : int {
+  m = 0,
+  n = 1,
+  k = 2,
+  lda = 3,
+  ldb = 4,
+  ldc = 5,
+  offset_a = 6,
+  offset_b = 7,
+  offset_c = 8,
+  count = 9
+};
+
 /*!
  * @brief The Tile structure determines the tiling configuration of a gemm
  *        implementation.
@@ -130,6 +165,127 @@ struct Tile {
   static std::string get_type_string() noexcept;
 };
 
+/*!
+ * @brief The default epilogue of Gemm, which stores
+ * alpha * op(A) * op(B) + beta * C unchanged.
+ */
+struct GemmNoEpilogue {
+  //! @brief iff true, the kernels store C without calling apply
+  static constexpr bool is_identity = true;
+  //! @brief iff true, the batches are slices of K accumulated in C, see
+  //! GemmSplitK
+  static constexpr bool is_split_k = false;
+  template <typename value_t, typename index_t>
+  value_t apply(value_t value, index_t row, index_t col);
+  void bind(cl::sycl::handler& h);
+  void adjust_access_displacement();
+};
+
+/*!
+ * @brief Epilogue fused into the store of C by Gemm, so that the output of a
+ * layer of a neural network is written once instead of being re-read by
+ * separate bias and activation kernels. Each element of C becomes
+ *
+ *   C(i, j) = act(value + bias + residual_scale * R(i, j))
+ *
+ * where value is alpha * op(A) * op(B) + beta * C, bias is selected by
+ * bias_type_ and R is a residual matrix with the shape of C.
+ * The residual is not read when residual_scale_ is zero.
+ *
+ * @tparam Activation a gemm_activation_t
+ * @tparam vector_t the view type of the bias vector
+ * @tparam matrix_t the view type of the residual matrix
+ * @param bias_ the bias vector, of size m for a row bias, n for a column bias
+ * @param residual_ the residual matrix
+ * @param bias_type_ the gemm_bias_t selecting how bias_ is added
+ * @param residual_scale_ the scalar multiplying the residual
+ * @param lower_ the lower bound of the clamp activation
+ * @param upper_ the upper bound of the clamp activation
+ */
+template <int Activation, typename vector_t, typename matrix_t>
+struct GemmEpilogue {
+  using value_t = typename vector_t::value_t;
+  using index_t = typename vector_t::index_t;
+  static constexpr bool is_identity = false;
+  static constexpr bool is_split_k = false;
+  vector_t bias_;
+  matrix_t residual_;
+  int bias_type_;
+  value_t residual_scale_;
+  value_t lower_;
+  value_t upper_;
+  GemmEpilogue(vector_t bias, matrix_t residual, gemm_bias_t bias_type,
+               value_t residual_scale, value_t lower, value_t upper);
+  template <typename idx_t>
+  value_t apply(value_t value, idx_t row, idx_t col);
+  void bind(cl::sycl::handler& h);
+  void adjust_access_displacement();
+};
+
+/*!
+ @brief Contructs an instance of the GemmEpilogue class.
+ */
+template <gemm_activation_t Activation, typename vector_t, typename matrix_t,
+          typename value_t>
+inline GemmEpilogue<static_cast<int>(Activation), vector_t, matrix_t>
+make_gemm_epilogue(vector_t bias, matrix_t residual, gemm_bias_t bias_type,
+                   value_t residual_scale, value_t lower, value_t upper) {
+  return GemmEpilogue<static_cast<int>(Activation), vector_t, matrix_t>(
+      bias, residual, bias_type, residual_scale, lower, upper);
+}
+
+/*!
+ * @brief Epilogue of the integer Gemm, requantizing its int32 accumulators to
+ * the 8-bit type of C so that the int32 result is never written to memory:
+ *
+ *   C(i, j) = saturate(round(scale_ * value) + zero_point_)
+ *
+ * where saturate clamps to the range of out_value_t.
+ *
+ * @tparam out_value_t the type of the elements of C
+ * @param scale_ the ratio of the scale of the accumulators (the product of the
+ * scales of A and B) to the scale of C
+ * @param zero_point_ the zero point of C
+ */
+template <typename out_value_t>
+struct GemmRequantize {
+  static constexpr bool is_identity = false;
+  static constexpr bool is_split_k = false;
+  float scale_;
+  int32_t zero_point_;
+  GemmRequantize(float scale, int32_t zero_point);
+  template <typename value_t, typename index_t>
+  value_t apply(value_t value, index_t row, index_t col);
+  void bind(cl::sycl::handler& h);
+  void adjust_access_displacement();
+};
+
+/*!
+ @brief Contructs an instance of the GemmRequantize class.
+ */
+template <typename out_value_t>
+inline GemmRequantize<out_value_t> make_gemm_requantize(float scale,
+                                                        int32_t zero_point) {
+  return GemmRequantize<out_value_t>(scale, zero_point);
+}
+
+/*!
+ * @brief Epilogue of a split-K Gemm, used when the tiles of C are too few to
+ * fill the device. The batches of the kernel are then consecutive slices of
+ * the contracting dimension of a single problem rather than independent
+ * matrices, and each work-group adds alpha times its partial product to C
+ * with atomic operations. C must therefore hold beta * C before the launch,
+ * and the kernel must be built with is_beta_zero.
+ */
+struct GemmSplitK {
+  static constexpr bool is_identity = true;
+  static constexpr bool is_split_k = true;
+  template <typename value_t, typename index_t>
+  value_t apply(value_t value, index_t row, index_t col);
+  void bind(cl::sycl::handler& h);
+  void adjust_access_displacement();
+};
+
 /*!
  * @brief GemmFactory is a template class whose instantiations provide
  *        different implementations of the GEMM device function. It also support
@@ -161,6 +317,8 @@ struct Tile {
  * @tparam TransA  iff true, matrix A will be transposed on the fly
  * @tparam TransB  iff true, matrix B will be transposed on the fly
  * @tparam element_t  type of matrix elements
+ * @tparam epilogue_t  the transformation applied to each element of C before
+ *                     it is stored, see GemmEpilogue
  * @param a_ the lhs_t matrix
  * @param b_ the rhs_t matrix
  * @param c_ the output matrix
@@ -178,7 +336,7 @@ template <typename input_t, typename output_t, bool DoubleBuffer, bool NbcA,
           bool NbcB, int ClSize, typename tile_type, bool TransA, bool TransB,
           typename element_t, bool is_beta_zero, int GemmMemoryType,
           int GemmAlgorithm, int GemmVectorization, int VectorSize,
-          int BatchType>
+          int BatchType, typename epilogue_t = GemmNoEpilogue>
 class Gemm {
  public:
   using value_t = element_t;
@@ -199,6 +357,7 @@ class Gemm {
   index_t ldb_;
   index_t ldc_;
   index_t batch_size_;
+  epilogue_t epilogue_;
 
   // Reject GEMM configurations which do not have a partial specialization and
   // thus would default to the naive implementation. If GemmAlgorithm is set to
@@ -213,7 +372,7 @@ class Gemm {
                 "Invalid GEMM configuration options, this would cause the "
                 "naive implementation to be selected");
   Gemm(input_t A, input_t B, output_t C, element_t alpha, element_t beta,
-       index_t batch_size);
+       index_t batch_size, epilogue_t epilogue = epilogue_t());
   static std::string get_type_string() noexcept;
   index_t get_workgroup_cluster() const noexcept;
   index_t get_num_workgroup_cluster(index_t compute_units) const noexcept;
@@ -254,6 +413,109 @@ make_gemm(input_t buffer_a, input_t buffer_b, output_t buffer_c,
       buffer_a, buffer_b, buffer_c, alpha, beta, batch_size);
 }
 
+/*
+ * @brief a helper function used for constructing a GEMM which applies the
+ * given epilogue to C before storing it.
+ */
+template <bool DoubleBuffer, bool ConflictA, bool ConflictB, int ClSize,
+          typename TileType, bool TransA, bool TransB, int GemmMemoryType,
+          int GemmAlgorithm, int GemmVectorization, bool is_beta_zero,
+          int VectorSize, int BatchType, typename input_t, typename output_t,
+          typename element_t, typename index_t, typename epilogue_t>
+inline Gemm<input_t, output_t, DoubleBuffer, ConflictA, ConflictB, ClSize,
+            TileType, TransA, TransB, element_t, is_beta_zero, GemmMemoryType,
+            GemmAlgorithm, GemmVectorization, VectorSize, BatchType,
+            epilogue_t>
+make_gemm(input_t buffer_a, input_t buffer_b, output_t buffer_c,
+          element_t alpha, element_t beta, index_t batch_size,
+          epilogue_t epilogue) {
+  return Gemm<input_t, output_t, DoubleBuffer, ConflictA, ConflictB, ClSize,
+              TileType, TransA, TransB, element_t, is_beta_zero, GemmMemoryType,
+              GemmAlgorithm, GemmVectorization, VectorSize, BatchType,
+              epilogue_t>(buffer_a, buffer_b, buffer_c, alpha, beta,
+                          batch_size, epilogue);
+}
+
+/*!
+ * @brief Grouped GEMM, computing independent products of different sizes
+ *
+ *   C_g = alpha * op(A_g) * op(B_g) + beta * C_g
+ *
+ * in a single launch, so that many small problems still fill the device. The
+ * tiles of C of all the problems are numbered one problem after the other, and
+ * each work-group finds the problem owning its tile with a binary search of
+ * the prefix sum of the number of tiles of each problem. Each work item then
+ * accumulates item_rows * item_cols elements of the tile in registers.
+ *
+ * @tparam input_t the vector view type of the buffers holding A and B
+ * @tparam output_t the vector view type of the buffer holding C
+ * @tparam schedule_t the vector view type of the schedule
+ * @tparam tile_type the tile computed by each work-group, see Tile. Only its
+ *                   item and work-group levels are used.
+ * @param schedule_ the group_count_ + 1 entries of the prefix sum of the
+ * number of tiles of each problem, followed by the gemm_grouped_field_t of
+ * each problem
+ * @param group_count_ the number of problems
+ * @param num_tiles_ the total number of tiles, i.e. of work-groups
+ */
+template <typename input_t, typename output_t, typename schedule_t,
+          typename tile_type, bool TransA, bool TransB, typename element_t,
+          bool is_beta_zero>
+class GemmGrouped {
+ public:
+  using value_t = element_t;
+  using index_t = typename std::remove_cv<typename schedule_t::value_t>::type;
+  static constexpr index_t item_rows = tile_type::item_rows;
+  static constexpr index_t item_cols = tile_type::item_cols;
+  static constexpr index_t wg_rows = tile_type::wg_rows;
+  static constexpr index_t wg_cols = tile_type::wg_cols;
+  static constexpr index_t wg_size = wg_rows * wg_cols;
+  static constexpr index_t block_rows = wg_rows * item_rows;
+  static constexpr index_t block_cols = wg_cols * item_cols;
+  static constexpr bool trans_a = TransA;
+  static constexpr bool trans_b = TransB;
+  static constexpr int local_memory_size = 0;
+  input_t a_;
+  input_t b_;
+  output_t c_;
+  schedule_t schedule_;
+  element_t alpha_;
+  element_t beta_;
+  index_t group_count_;
+  index_t num_tiles_;
+
+  GemmGrouped(input_t A, input_t B, output_t C, schedule_t schedule,
+              element_t alpha, element_t beta, index_t group_count,
+              index_t num_tiles);
+  static std::string get_type_string() noexcept;
+  cl::sycl::nd_range<1> get_nd_range() const noexcept;
+  index_t get_size() const;
+  bool valid_thread(const cl::sycl::nd_item<1>& ndItem) const;
+  void eval(cl::sycl::nd_item<1> id) noexcept;
+  void bind(cl::sycl::handler& h);
+  void adjust_access_displacement();
+
+ private:
+  index_t get_field(index_t problem, gemm_grouped_field_t field) const;
+};
+
+/*!
+ @brief Contructs an instance of the GemmGrouped class.
+ */
+template <typename tile_type, bool TransA, bool TransB, bool is_beta_zero,
+          typename input_t, typename output_t, typename schedule_t,
+          typename element_t, typename index_t>
+inline GemmGrouped<input_t, output_t, schedule_t, tile_type, TransA, TransB,
+                   element_t, is_beta_zero>
+make_gemm_grouped(input_t buffer_a, input_t buffer_b, output_t buffer_c,
+                  schedule_t schedule, element_t alpha, element_t beta,
+                  index_t group_count, index_t num_tiles) {
+  return GemmGrouped<input_t, output_t, schedule_t, tile_type, TransA, TransB,
+                     element_t, is_beta_zero>(buffer_a, buffer_b, buffer_c,
+                                              schedule, alpha, beta,
+                                              group_count, num_tiles);
+}
+
 /**
  * @brief Kernel that inverts the square diagonal blocks of a matrix. This
  * is used in the TRSM algorithm.
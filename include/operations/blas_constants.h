@@ -91,6 +91,39 @@ struct IndexValueTuple {
   }
 };
 
+/*!
+@brief Partial result of a scaled sum of squares, as in LAPACK's lassq: the
+represented sum of squares is scale * scale * ssq. Accumulating the squares
+relative to the largest absolute value seen avoids the overflow and underflow
+of a plain sum of squares.
+*/
+template <typename val_t>
+struct ScaledSquaresTuple {
+  using value_t = val_t;
+
+  value_t scale;
+  value_t ssq;
+
+  // This operator is required due to a ComputeCPP bug
+  // (If the RHS of this operator is static const, then llvm.memcpy is broken)
+  constexpr ScaledSquaresTuple(const ScaledSquaresTuple<value_t> &other)
+      : scale(other.scale), ssq(other.ssq) {}
+
+  constexpr explicit ScaledSquaresTuple(value_t _scale, value_t _ssq)
+      : scale(_scale), ssq(_ssq){};
+  SYCL_BLAS_INLINE value_t get_scale() const { return scale; }
+  SYCL_BLAS_INLINE value_t get_ssq() const { return ssq; }
+  // This operator is required due to a ComputeCPP bug
+  // (If the RHS of this operator is static const, then llvm.memcpy is broken)
+  ScaledSquaresTuple<value_t> &operator=(
+      const ScaledSquaresTuple<value_t> &other) {
+    scale = other.scale;
+    ssq = other.ssq;
+
+    return *this;
+  }
+};
+
 /*!
 @brief Enum class used to indicate a constant value associated with a type.
 */
@@ -210,6 +243,14 @@ struct constant<std::complex<value_t>, Indicator> {
   }
 };
 
+template <typename value_t, int packet_size, const_val Indicator>
+struct constant<cl::sycl::vec<value_t, packet_size>, Indicator> {
+  static SYCL_BLAS_INLINE cl::sycl::vec<value_t, packet_size> value() {
+    return cl::sycl::vec<value_t, packet_size>(
+        constant<value_t, Indicator>::value());
+  }
+};
+
 #ifdef BLAS_DATA_TYPE_HALF
 template <>
 struct constant<cl::sycl::half, const_val::zero>
@@ -252,6 +293,30 @@ struct constant<cl::sycl::half, const_val::collapse>
     : constant<float, const_val::collapse> {};
 #endif // BLAS_DATA_TYPE_HALF
 
+/*!
+@brief Type in which the mixed precision reductions (e.g. _sdsdot) of data
+stored as element_t accumulate. It is the next wider enabled type, or element_t
+itself if there is none.
+*/
+template <typename element_t>
+struct AccumulatorType {
+  using type = element_t;
+};
+
+#ifdef BLAS_DATA_TYPE_HALF
+template <>
+struct AccumulatorType<cl::sycl::half> {
+  using type = float;
+};
+#endif // BLAS_DATA_TYPE_HALF
+
+#ifdef BLAS_DATA_TYPE_DOUBLE
+template <>
+struct AccumulatorType<float> {
+  using type = double;
+};
+#endif // BLAS_DATA_TYPE_DOUBLE
+
 template <typename iv_type, const_val IndexIndicator, const_val ValueIndicator>
 struct constant_pair {
   constexpr static SYCL_BLAS_INLINE iv_type value() {
@@ -30,10 +30,43 @@
 
 namespace blas {
 struct Operators;
+struct IdentityOperator;
+struct AddOperator;
+struct ProductOperator;
+
+/*!
+ * @brief Strategy used to combine the partial results of the work groups of an
+ * AssignReduction. Each reduction operator selects one in blas_operators.hpp.
+ */
+enum class reduction_algorithm_t : int {
+  // One kernel launch per level of the reduction tree
+  multi_pass = 0,
+  // A single kernel launch, the last work group to finish combines the
+  // partial results of the other ones
+  single_pass = 1
+};
+
+/*!
+ * @brief Whether the single pass reductions can be used.
+ *
+ * The last work group of a single pass reduction is elected with an atomic
+ * counter, and reads the partial results the other work groups wrote before
+ * incrementing it. SYCL 1.2.1 atomics are relaxed, so this relies on the
+ * global memory fence issued around the increment ordering these accesses
+ * across work groups, which the specification only guarantees within a work
+ * group. When SINGLE_PASS_REDUCTION_SUPPORT is not defined, the operators
+ * choosing single_pass and the fused reductions use the multi pass scheme
+ * instead.
+ */
+#ifdef SINGLE_PASS_REDUCTION_SUPPORT
+static constexpr bool single_pass_reduction_supported = true;
+#else
+static constexpr bool single_pass_reduction_supported = false;
+#endif
 
 // A template for getting the return type of a blas operator
-// This is special cased for the CollapseIndex operator, which returns a
-// different type than its input
+// This is special cased for the CollapseIndex and ScaledSquaresNorm
+// operators, which return a different type than their input
 template <typename operator_t, typename rhs_t>
 struct ResolveReturnType {
   using type = rhs_t;
@@ -44,6 +77,12 @@ template <typename rhs_t>
 struct ResolveReturnType<CollapseIndexTupleOperator, rhs_t> {
   using type = typename rhs_t::value_t;
 };
+
+struct ScaledSquaresNormOperator;
+template <typename rhs_t>
+struct ResolveReturnType<ScaledSquaresNormOperator, rhs_t> {
+  using type = typename rhs_t::value_t;
+};
 }  // namespace blas
 
 #endif
@@ -0,0 +1,167 @@
+/***************************************************************************
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename gemm_selection_cache.h
+ *
+ **************************************************************************/
+
+#ifndef SYCL_BLAS_GEMM_SELECTION_CACHE_H
+#define SYCL_BLAS_GEMM_SELECTION_CACHE_H
+
+#include <cstdint>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <string>
+#include <tuple>
+
+namespace blas {
+
+/*!
+ * @brief Problem a GEMM kernel selection is made for.
+ */
+struct gemm_selection_key_t {
+  int64_t m;
+  int64_t n;
+  int64_t k;
+  int64_t lda;
+  int64_t ldb;
+  int64_t ldc;
+  int64_t batch_size;
+  bool trans_a;
+  bool trans_b;
+  bool is_beta_zero;
+  // Size of the element type, to tell float and double problems apart
+  int element_size;
+
+  inline bool operator<(const gemm_selection_key_t &other) const {
+    return std::tie(m, n, k, lda, ldb, ldc, batch_size, trans_a, trans_b,
+                    is_beta_zero, element_size) <
+           std::tie(other.m, other.n, other.k, other.lda, other.ldb, other.ldc,
+                    other.batch_size, other.trans_a, other.trans_b,
+                    other.is_beta_zero, other.element_size);
+  }
+};
+
+/*!
+ * @brief Table of the fastest GEMM candidate of the backend for each problem.
+ *
+ * When enabled, the first GEMM of a given shape times every general purpose
+ * configuration compiled into the backend and records the fastest one here.
+ * Later calls with the same shape launch it directly. The table can be saved
+ * to a file and loaded at startup, so that a new process does not need to time
+ * the candidates again.
+ *
+ * The selection is disabled by default, in which case the backend heuristic
+ * picks the configuration.
+ */
+class GemmSelectionCache {
+ public:
+  GemmSelectionCache() : enabled_(false) {}
+
+  inline void enable() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    enabled_ = true;
+  }
+
+  inline void disable() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    enabled_ = false;
+  }
+
+  inline bool is_enabled() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return enabled_;
+  }
+
+  /*!
+   * @brief Looks up the candidate selected for a problem.
+   * @return The index of the candidate, or -1 if none was selected yet
+   */
+  inline int find(const gemm_selection_key_t &key) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = table_.find(key);
+    return it == table_.end() ? -1 : it->second;
+  }
+
+  inline void insert(const gemm_selection_key_t &key, int candidate) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    table_[key] = candidate;
+  }
+
+  inline size_t size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return table_.size();
+  }
+
+  inline void clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    table_.clear();
+  }
+
+  /*!
+   * @brief Writes the table to a file, one problem per line.
+   * @return Whether the file could be written
+   */
+  inline bool save(const std::string &file_name) const {
+    std::ofstream file(file_name);
+    if (!file) {
+      return false;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const auto &entry : table_) {
+      const auto &key = entry.first;
+      file << key.m << " " << key.n << " " << key.k << " " << key.lda << " "
+           << key.ldb << " " << key.ldc << " " << key.batch_size << " "
+           << key.trans_a << " " << key.trans_b << " " << key.is_beta_zero
+           << " " << key.element_size << " " << entry.second << "\n";
+    }
+    return static_cast<bool>(file);
+  }
+
+  /*!
+   * @brief Adds the entries of a file written by save to the table.
+   * @return Whether the file could be read
+   */
+  inline bool load(const std::string &file_name) {
+    std::ifstream file(file_name);
+    if (!file) {
+      return false;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    gemm_selection_key_t key;
+    int candidate;
+    while (file >> key.m >> key.n >> key.k >> key.lda >> key.ldb >> key.ldc >>
+           key.batch_size >> key.trans_a >> key.trans_b >> key.is_beta_zero >>
+           key.element_size >> candidate) {
+      table_[key] = candidate;
+    }
+    return file.eof();
+  }
+
+ private:
+  mutable std::mutex mutex_;
+  bool enabled_;
+  std::map<gemm_selection_key_t, int> table_;
+};
+
+}  // namespace blas
+
+#endif  // SYCL_BLAS_GEMM_SELECTION_CACHE_H
@@ -28,7 +28,9 @@
 #include "blas_meta.h"
 #include "container/sycl_iterator.h"
 #include "policy/default_policy_handler.h"
+#include "policy/gemm_selection_cache.h"
 #include "policy/sycl_policy.h"
+#include "policy/sycl_workspace_pool.h"
 #include <CL/sycl.hpp>
 #include <stdexcept>
 #include <vptr/virtual_ptr.hpp>
@@ -48,6 +50,8 @@ class PolicyHandler<codeplay_policy> {
               p->clear();
               delete p;
             })),
+        workspacePoolPtr_(std::make_shared<WorkspacePool>()),
+        gemmSelectionCachePtr_(std::make_shared<GemmSelectionCache>()),
         workGroupSize_(codeplay_policy::get_work_group_size(q)),
         selectedDeviceType_(codeplay_policy::find_chosen_device_type(q)),
         localMemorySupport_(codeplay_policy::has_local_memory(q)),
@@ -156,6 +160,49 @@ class PolicyHandler<codeplay_policy> {
                                   element_t value = element_t{0},
                                   size_t size = 0);
 
+  /*  @brief Getting a scratch buffer from the workspace pool of the handler
+      @tparam element_t is the type of the data
+      @param num_elements is the minimum number of elements of the buffer
+  */
+  template <typename element_t>
+  inline BufferIterator<element_t, policy_t> acquire_workspace(
+      size_t num_elements) {
+    return workspacePoolPtr_->template acquire<element_t>(num_elements);
+  }
+
+  /*  @brief Giving back a scratch buffer to the workspace pool. The buffer can
+      be released as soon as the kernels using it have been submitted.
+      @tparam element_t is the type of the data
+      @param buff is the BufferIterator returned by acquire_workspace
+  */
+  template <typename element_t>
+  inline void release_workspace(BufferIterator<element_t, policy_t> buff) {
+    workspacePoolPtr_->release(buff);
+  }
+
+  /*  @brief Getting a counter used by a single pass reduction to
+      synchronize its work groups
+  */
+  inline BufferIterator<int, policy_t> get_sync_counter() const {
+    return workspacePoolPtr_->get_sync_counter();
+  }
+
+  inline workspace_stats_t get_workspace_stats() const {
+    return workspacePoolPtr_->get_stats();
+  }
+
+  /*  @brief Freeing the scratch buffers of the workspace pool that are not in
+      use
+  */
+  inline void trim_workspace() { workspacePoolPtr_->trim(); }
+
+  /*  @brief Getting the table of the GEMM configurations selected at runtime.
+      The selection is disabled until enable is called on the table.
+  */
+  inline GemmSelectionCache &get_gemm_selection_cache() const {
+    return *gemmSelectionCachePtr_;
+  }
+
   inline const policy_t::device_type get_device_type() const {
     return selectedDeviceType_;
   };
@@ -183,6 +230,8 @@ class PolicyHandler<codeplay_policy> {
  private:
   typename policy_t::queue_t q_;
   std::shared_ptr<cl::sycl::codeplay::PointerMapper> pointerMapperPtr_;
+  std::shared_ptr<WorkspacePool> workspacePoolPtr_;
+  std::shared_ptr<GemmSelectionCache> gemmSelectionCachePtr_;
   const size_t workGroupSize_;
   const policy_t::device_type selectedDeviceType_;
   const bool localMemorySupport_;
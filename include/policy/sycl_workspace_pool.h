@@ -0,0 +1,174 @@
+/***************************************************************************
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename sycl_workspace_pool.h
+ *
+ **************************************************************************/
+
+#ifndef SYCL_BLAS_SYCL_WORKSPACE_POOL_H
+#define SYCL_BLAS_SYCL_WORKSPACE_POOL_H
+
+#include "blas_meta.h"
+#include "container/sycl_iterator.h"
+#include "policy/sycl_policy.h"
+#include <CL/sycl.hpp>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <vector>
+
+namespace blas {
+
+/*!
+ * @brief Counters reported by a WorkspacePool.
+ */
+struct workspace_stats_t {
+  // Number of requests served with a cached buffer
+  size_t hits;
+  // Number of requests that required allocating a new buffer
+  size_t misses;
+  // Total size in bytes of the buffers owned by the pool, in use or not
+  size_t bytes_held;
+};
+
+/*!
+ * @brief Size-bucketed pool of scratch buffers.
+ *
+ * Operations that need temporary device memory between kernels (the
+ * intermediate results of a reduction, the partial dot products of GEMV, the
+ * inverted diagonal blocks of TRSM...) take it from this pool instead of
+ * creating and destroying a SYCL buffer on every call.
+ *
+ * Buffers are stored untyped and bucketed by size, rounded up to a power of
+ * two bytes, so that a buffer can be reused by any element type and by
+ * requests of similar size. A buffer can be released as soon as the kernels
+ * using it have been submitted: the SYCL runtime orders any later command group
+ * accessing the same buffer after them.
+ */
+class WorkspacePool {
+ public:
+  using byte_t = uint8_t;
+  using byte_buffer_t = codeplay_policy::buffer_t<byte_t, 1>;
+
+  // Smallest bucket, large enough for any element type used by the library
+  static constexpr size_t min_bucket_size = 256;
+
+  WorkspacePool() : stats_{0, 0, 0}, counter_(make_counter()) {}
+
+  /*!
+   * @brief Returns a buffer that can hold at least num_elements elements.
+   * The buffer can be larger than requested and its content is undefined.
+   * @tparam element_t Element type of the returned BufferIterator
+   * @param num_elements Minimum number of elements
+   */
+  template <typename element_t>
+  inline BufferIterator<element_t, codeplay_policy> acquire(
+      size_t num_elements) {
+    const size_t bytes = bucket_size(num_elements * sizeof(element_t));
+    auto buff = acquire_bytes(roundUp<size_t>(bytes, sizeof(element_t)));
+    return BufferIterator<element_t, codeplay_policy>{
+        buff.template reinterpret<element_t>(
+            cl::sycl::range<1>(buff.get_count() / sizeof(element_t)))};
+  }
+
+  /*!
+   * @brief Gives back to the pool a buffer obtained with acquire.
+   * @param buff BufferIterator returned by acquire
+   */
+  template <typename element_t>
+  inline void release(BufferIterator<element_t, codeplay_policy> buff) {
+    auto typed_buff = buff.get_buffer();
+    release_bytes(typed_buff.template reinterpret<byte_t>(
+        cl::sycl::range<1>(typed_buff.get_count() * sizeof(element_t))));
+  }
+
+  /*!
+   * @brief Returns a one-element buffer that holds zero between kernels. It is
+   * used by the single pass reductions to elect the last work group to finish,
+   * which resets it before returning.
+   *
+   * All the single pass reductions share this counter, so the runtime orders
+   * them one after the other. Reductions of similar sizes would be ordered
+   * anyway by their partial results, which are released as soon as the
+   * reduction is submitted and handed to the next one from the same bucket.
+   */
+  inline BufferIterator<int, codeplay_policy> get_sync_counter() const {
+    return counter_;
+  }
+
+  /*!
+   * @brief Returns the hit, miss and memory counters of the pool.
+   */
+  inline workspace_stats_t get_stats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stats_;
+  }
+
+  /*!
+   * @brief Frees all the buffers that are not currently in use.
+   */
+  inline void trim() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto &bucket : free_buffers_) {
+      stats_.bytes_held -= bucket.first * bucket.second.size();
+    }
+    free_buffers_.clear();
+  }
+
+ private:
+  static inline size_t bucket_size(size_t bytes) {
+    const size_t min_bytes = min_bucket_size;
+    return bytes <= min_bytes ? min_bytes : get_power_of_two(bytes, true);
+  }
+
+  static inline BufferIterator<int, codeplay_policy> make_counter() {
+    static const int zero = 0;
+    return BufferIterator<int, codeplay_policy>{
+        codeplay_policy::buffer_t<int, 1>{&zero, cl::sycl::range<1>(1)}};
+  }
+
+  inline byte_buffer_t acquire_bytes(size_t bytes) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto bucket = free_buffers_.find(bytes);
+    if (bucket != free_buffers_.end() && !bucket->second.empty()) {
+      auto buff = bucket->second.back();
+      bucket->second.pop_back();
+      ++stats_.hits;
+      return buff;
+    }
+    ++stats_.misses;
+    stats_.bytes_held += bytes;
+    return byte_buffer_t{cl::sycl::range<1>(bytes)};
+  }
+
+  inline void release_bytes(byte_buffer_t buff) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    free_buffers_[buff.get_count()].push_back(buff);
+  }
+
+  mutable std::mutex mutex_;
+  std::map<size_t, std::vector<byte_buffer_t>> free_buffers_;
+  workspace_stats_t stats_;
+  BufferIterator<int, codeplay_policy> counter_;
+};
+
+}  // namespace blas
+
+#endif  // SYCL_BLAS_SYCL_WORKSPACE_POOL_H
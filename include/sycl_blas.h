@@ -33,6 +33,8 @@
 
 #include "container/sycl_iterator.h"
 
+#include "container/scalar_future.h"
+
 #include "executors/executor.h"
 
 #include "executors/kernel_constructor.h"
@@ -38,6 +38,185 @@
 #include "views/view.h"
 
 namespace blas {
+namespace internal {
+
+/*!
+ * @brief Index of the first tree from first on that is not element-wise, or
+ * the number of trees if there is none.
+ */
+template <size_t first, typename trees_t,
+          bool in_range = (first < std::tuple_size<trees_t>::value)>
+struct ElementwiseSegmentEnd {
+  static constexpr size_t value = first;
+};
+
+template <size_t first, typename trees_t>
+struct ElementwiseSegmentEnd<first, trees_t, true> {
+  static constexpr size_t value =
+      is_elementwise<typename std::tuple_element<first, trees_t>::type>::value
+          ? ElementwiseSegmentEnd<first + 1, trees_t>::value
+          : first;
+};
+
+/*!
+ * @brief Joins the length trees starting at first after joined, in order.
+ */
+template <size_t first, size_t length>
+struct JoinRange {
+  template <typename trees_t, typename joined_t>
+  using next_joined_t =
+      Join<joined_t, typename std::tuple_element<first, trees_t>::type>;
+
+  template <typename trees_t, typename joined_t>
+  using type = typename JoinRange<first + 1, length - 1>::template type<
+      trees_t, next_joined_t<trees_t, joined_t>>;
+
+  template <typename trees_t, typename joined_t>
+  static inline type<trees_t, joined_t> join(trees_t &trees,
+                                             joined_t joined) {
+    auto next =
+        next_joined_t<trees_t, joined_t>(joined, std::get<first>(trees));
+    return JoinRange<first + 1, length - 1>::join(trees, next);
+  }
+};
+
+template <size_t first>
+struct JoinRange<first, 0> {
+  template <typename trees_t, typename joined_t>
+  using type = joined_t;
+
+  template <typename trees_t, typename joined_t>
+  static inline joined_t join(trees_t &, joined_t joined) {
+    return joined;
+  }
+};
+
+/*!
+ * @brief Submits the length trees starting at first, which are all
+ * element-wise. They are joined in a single kernel when they have the same
+ * size and all their views map the indices alike, otherwise they are executed
+ * one by one.
+ */
+template <size_t first, size_t length>
+struct ElementwiseSegment {
+  using next_t = ElementwiseSegment<first + 1, length - 1>;
+
+  template <typename trees_t, typename index_t>
+  static inline bool has_size(trees_t &trees, index_t n) {
+    return std::get<first>(trees).get_size() == n &&
+           next_t::has_size(trees, n);
+  }
+
+  template <typename trees_t>
+  static inline void append_view_mappings(
+      trees_t &trees, std::vector<view_mapping_t> &mappings) {
+    blas::append_view_mappings(std::get<first>(trees), mappings);
+    next_t::append_view_mappings(trees, mappings);
+  }
+
+  template <typename trees_t>
+  static inline bool maps_alike(trees_t &trees) {
+    std::vector<view_mapping_t> mappings;
+    append_view_mappings(trees, mappings);
+    for (const auto &mapping : mappings) {
+      if (!(mapping == mappings.front())) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  template <typename executor_t, typename trees_t>
+  static inline typename executor_t::policy_t::event_t submit_each(
+      executor_t &ex, trees_t &trees) {
+    auto events = ex.execute(std::get<first>(trees));
+    return concatenate_vectors(events, next_t::submit_each(ex, trees));
+  }
+
+  template <typename executor_t, typename trees_t>
+  static inline typename executor_t::policy_t::event_t submit(
+      executor_t &ex, trees_t &trees) {
+    if (length == 1 ||
+        !next_t::has_size(trees, std::get<first>(trees).get_size()) ||
+        !maps_alike(trees)) {
+      return submit_each(ex, trees);
+    }
+    return ex.execute(JoinRange<first + 1, length - 1>::join(
+        trees, std::get<first>(trees)));
+  }
+};
+
+template <size_t first>
+struct ElementwiseSegment<first, 0> {
+  template <typename trees_t, typename index_t>
+  static inline bool has_size(trees_t &, index_t) {
+    return true;
+  }
+
+  template <typename trees_t>
+  static inline void append_view_mappings(trees_t &,
+                                          std::vector<view_mapping_t> &) {}
+
+  template <typename executor_t, typename trees_t>
+  static inline typename executor_t::policy_t::event_t submit_each(
+      executor_t &, trees_t &) {
+    return {};
+  }
+
+  template <typename executor_t, typename trees_t>
+  static inline typename executor_t::policy_t::event_t submit(executor_t &,
+                                                             trees_t &) {
+    return {};
+  }
+};
+
+/*!
+ * @brief Submits the trees of a graph from first on: the element-wise trees
+ * up to the next tree that is not, then that tree, then the rest.
+ */
+template <size_t first, typename trees_t,
+          bool in_range = (first < std::tuple_size<trees_t>::value)>
+struct GraphSubmitter {
+  template <typename executor_t>
+  static inline typename executor_t::policy_t::event_t submit(
+      executor_t &ex, trees_t &trees) {
+    return {};
+  }
+};
+
+template <size_t first, typename trees_t>
+struct GraphSubmitter<first, trees_t, true> {
+  static constexpr size_t last = ElementwiseSegmentEnd<first, trees_t>::value;
+  static constexpr bool has_barrier = last < std::tuple_size<trees_t>::value;
+
+  template <typename executor_t>
+  static inline typename executor_t::policy_t::event_t submit(
+      executor_t &ex, trees_t &trees) {
+    auto events =
+        ElementwiseSegment<first, last - first>::submit(ex, trees);
+    return concatenate_vectors(events, submit_barrier(ex, trees));
+  }
+
+ private:
+  template <typename executor_t, bool enabled = has_barrier>
+  static inline typename std::enable_if<
+      enabled, typename executor_t::policy_t::event_t>::type
+  submit_barrier(executor_t &ex, trees_t &trees) {
+    auto events = ex.execute(std::get<last>(trees));
+    return concatenate_vectors(
+        events, GraphSubmitter<last + 1, trees_t>::submit(ex, trees));
+  }
+
+  template <typename executor_t, bool enabled = has_barrier>
+  static inline typename std::enable_if<
+      !enabled, typename executor_t::policy_t::event_t>::type
+  submit_barrier(executor_t &ex, trees_t &trees) {
+    return {};
+  }
+};
+
+}  // namespace internal
+
 /*! Executor<PolicyHandler<codeplay_policy>>.
  * @brief Executes an Expression expression_tree_t using SYCL.
  */
@@ -104,57 +283,69 @@ Executor<PolicyHandler<codeplay_policy>>::execute(expression_tree_t t,
       policy_handler_.get_queue(), t, localSize, globalSize, shMem)};
 }
 
+/*!
+ * @brief Submits the trees recorded in graph. Consecutive element-wise trees
+ * of the same size are joined in a single kernel, the other trees are
+ * executed with the matching overload.
+ */
+template <>
+template <typename... expression_tree_t>
+inline typename codeplay_policy::event_t
+Executor<PolicyHandler<codeplay_policy>>::end_capture(
+    ExpressionGraph<expression_tree_t...> graph) {
+  using trees_t = typename ExpressionGraph<expression_tree_t...>::trees_t;
+  return internal::GraphSubmitter<0, trees_t>::submit(*this,
+                                                      graph.get_trees());
+}
+
 /*!
  * @brief Applies a reduction to a tree.
+ * The scratch memory holding the intermediate results is taken from the
+ * workspace pool of the policy handler. Depending on the reduction algorithm
+ * of the operator, the reduction is done in a single kernel or in one kernel
+ * per level of the reduction tree. The single kernel is only used when
+ * single_pass_reduction_supported holds.
  */
 template <>
 template <typename operator_t, typename lhs_t, typename rhs_t>
 inline typename codeplay_policy::event_t
 Executor<PolicyHandler<codeplay_policy>>::execute(
     AssignReduction<operator_t, lhs_t, rhs_t> t) {
-  using expression_tree_t = AssignReduction<operator_t, lhs_t, rhs_t>;
-  auto _N = t.get_size();
   auto localSize = t.local_num_thread_;
-  // IF THERE ARE ENOUGH ELEMENTS, EACH BLOCK PROCESS TWO BLOCKS OF
-  // ELEMENTS THEREFORE, 2*GLOBALSIZE ELEMENTS ARE PROCESSED IN A STEP
-  // MOREOVER, A LOOP ALLOWS TO REPEAT THE PROCESS UNTIL
-  // ALL THE ELEMENTS ARE PROCESSED
   auto nWG = (t.global_num_thread_ + (2 * localSize) - 1) / (2 * localSize);
-  auto lhs = t.lhs_;
-  auto rhs = t.rhs_;
-
-  // Two accessors to local memory
-  auto sharedSize = ((nWG < localSize) ? localSize : nWG);
-  auto shMem1 = make_sycl_iterator_buffer<typename lhs_t::value_t>(sharedSize);
-  auto shMem2 = make_sycl_iterator_buffer<typename lhs_t::value_t>(sharedSize);
-  auto opShMem1 = lhs_t(shMem1, 1, sharedSize);
-  auto opShMem2 = lhs_t(shMem2, 1, sharedSize);
-  typename codeplay_policy::event_t event;
-  bool frst = true;
-  bool even = false;
-  do {
+  if (single_pass_reduction_supported &&
+      operator_t::reduction_algorithm == reduction_algorithm_t::single_pass) {
+    // Do not launch more blocks than needed, and no more than one partial
+    // result per work item of the block doing the final combination
+    auto _N = t.get_size();
+    auto neededWG = (_N + (2 * localSize) - 1) / (2 * localSize);
+    nWG = std::max(decltype(nWG)(1), std::min(std::min(nWG, neededWG),
+                                              decltype(nWG)(localSize)));
     auto globalSize = nWG * localSize;
-    if (frst) {
-      // THE FIRST CASE USES THE ORIGINAL BINARY/TERNARY FUNCTION
-      auto localTree = expression_tree_t(((nWG == 1) ? lhs : opShMem1), rhs,
-                                         localSize, globalSize);
-      event.push_back(execute_tree<using_local_memory::enabled>(
-          policy_handler_.get_queue(), localTree, localSize, globalSize,
-          sharedSize));
-    } else {
-      // THE OTHER CASES ALWAYS USE THE BINARY FUNCTION
-      auto localTree = AssignReduction<operator_t, lhs_t, lhs_t>(
-          ((nWG == 1) ? lhs : (even ? opShMem2 : opShMem1)),
-          (even ? opShMem1 : opShMem2), localSize, globalSize);
-      event.push_back(execute_tree<using_local_memory::enabled>(
-          policy_handler_.get_queue(), localTree, localSize, globalSize,
-          sharedSize));
-    }
-    _N = nWG;
-    nWG = (_N + (2 * localSize) - 1) / (2 * localSize);
-    frst = false;
-    even = !even;
-  } while (_N > 1);
+    auto partials =
+        policy_handler_.template acquire_workspace<typename lhs_t::value_t>(
+            nWG);
+    auto partialsView = lhs_t(partials, 1, nWG);
+    auto counter = make_vector_view(*this, policy_handler_.get_sync_counter(),
+                                    1, decltype(nWG)(1));
+    auto localTree = make_single_pass_reduction<operator_t>(
+        t.lhs_, t.rhs_, partialsView, counter, localSize, globalSize);
+    typename codeplay_policy::event_t event{
+        execute_tree<using_local_memory::enabled>(policy_handler_.get_queue(),
+                                                  localTree, localSize,
+                                                  globalSize, localSize)};
+    policy_handler_.release_workspace(partials);
+    return event;
+  }
+  // Two halves of the scratch buffer, see the overload below
+  auto sharedSize = ((nWG < localSize) ? localSize : nWG);
+  auto scratch =
+      policy_handler_.template acquire_workspace<typename lhs_t::value_t>(
+          2 * sharedSize);
+  auto event = execute(t, scratch);
+  // The kernels using the scratch buffer have been submitted, so it can be
+  // handed over to the next operation
+  policy_handler_.release_workspace(scratch);
   return event;
 }
 
@@ -212,22 +403,84 @@ Executor<PolicyHandler<codeplay_policy>>::execute(
   return event;
 }
 
+/*!
+ * @brief Applies several reductions to the same range in a single kernel.
+ * Without single_pass_reduction_supported, the partial results of the work
+ * groups are combined by further kernels instead, as in the multi-pass
+ * AssignReduction.
+ */
+template <>
+template <typename lhs_t, typename operands_t, typename reductions_t>
+inline typename codeplay_policy::event_t
+Executor<PolicyHandler<codeplay_policy>>::execute(
+    MultiAssignReduction<lhs_t, operands_t, reductions_t> t) {
+  constexpr auto num_slots = reductions_t::num_slots;
+  auto _N = t.get_size();
+  auto localSize = t.local_num_thread_;
+  auto nWG = (t.global_num_thread_ + (2 * localSize) - 1) / (2 * localSize);
+  // Same launch bounds as the single pass AssignReduction
+  auto neededWG = (_N + (2 * localSize) - 1) / (2 * localSize);
+  nWG = std::max(decltype(nWG)(1), std::min(std::min(nWG, neededWG),
+                                            decltype(nWG)(localSize)));
+  typename codeplay_policy::event_t event;
+  if (single_pass_reduction_supported) {
+    auto globalSize = nWG * localSize;
+    auto partials =
+        policy_handler_.template acquire_workspace<typename lhs_t::value_t>(
+            num_slots * nWG);
+    auto partialsView = lhs_t(partials, 1, num_slots * nWG);
+    auto counter = make_vector_view(*this, policy_handler_.get_sync_counter(),
+                                    1, decltype(nWG)(1));
+    auto localTree = make_single_pass_multi_reduction(
+        t.lhs_, t.operands_, t.reductions_, partialsView, counter, localSize,
+        globalSize);
+    event.push_back(execute_tree<using_local_memory::enabled>(
+        policy_handler_.get_queue(), localTree, localSize, globalSize,
+        num_slots * localSize));
+    policy_handler_.release_workspace(partials);
+    return event;
+  }
+  // Two halves of the workspace, holding in turn the partial results read
+  // and written by a step
+  auto partials =
+      policy_handler_.template acquire_workspace<typename lhs_t::value_t>(
+          2 * num_slots * nWG);
+  auto partials1 = lhs_t(partials, 1, num_slots * nWG);
+  auto partials2 = lhs_t(partials + num_slots * nWG, 1, num_slots * nWG);
+  decltype(nWG) inSize = 0;
+  bool even = false;
+  do {
+    auto globalSize = nWG * localSize;
+    auto localTree = make_multi_pass_multi_reduction(
+        t.lhs_, t.operands_, t.reductions_, (even ? partials2 : partials1),
+        (even ? partials1 : partials2), inSize, localSize, globalSize);
+    event.push_back(execute_tree<using_local_memory::enabled>(
+        policy_handler_.get_queue(), localTree, localSize, globalSize,
+        num_slots * localSize));
+    inSize = nWG;
+    nWG = (inSize + (2 * localSize) - 1) / (2 * localSize);
+    even = !even;
+  } while (inSize > 1);
+  policy_handler_.release_workspace(partials);
+  return event;
+}
+
 template <>
 template <typename input_t, typename output_t, bool DoubleBuffer, bool NbcA,
           bool NbcB, int ClSize, typename tile_type, bool TransA, bool TransB,
           typename element_t, bool is_beta_zero, int GemmMemoryType,
           int GemmAlgorithm, int GemmVectorization, int VectorSize,
-          int BatchType>
+          int BatchType, typename epilogue_t>
 inline typename codeplay_policy::event_t
 Executor<PolicyHandler<codeplay_policy>>::execute(
     Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type, TransA,
          TransB, element_t, is_beta_zero, GemmMemoryType, GemmAlgorithm,
-         GemmVectorization, VectorSize, BatchType>
+         GemmVectorization, VectorSize, BatchType, epilogue_t>
         gemm_tree) {
   using gemm_t =
       Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type,
            TransA, TransB, element_t, is_beta_zero, GemmMemoryType,
-           GemmAlgorithm, GemmVectorization, VectorSize, BatchType>;
+           GemmAlgorithm, GemmVectorization, VectorSize, BatchType, epilogue_t>;
   auto rng = gemm_tree.get_nd_range(policy_handler_.get_num_compute_units());
   return {execute_tree<
       Choose<GemmMemoryType == static_cast<int>(gemm_memory_t::local), int,
@@ -357,6 +610,22 @@ Executor<PolicyHandler<codeplay_policy>>::execute(
       gemm_partial.local_memory_size)};
 }
 
+/* GemmGrouped */
+template <>
+template <typename input_t, typename output_t, typename schedule_t,
+          typename tile_type, bool TransA, bool TransB, typename element_t,
+          bool is_beta_zero>
+inline typename codeplay_policy::event_t
+Executor<PolicyHandler<codeplay_policy>>::execute(
+    GemmGrouped<input_t, output_t, schedule_t, tile_type, TransA, TransB,
+                element_t, is_beta_zero>
+        gemm_grouped) {
+  auto rng = gemm_grouped.get_nd_range();
+  return {execute_tree<using_local_memory::disabled>(
+      policy_handler_.get_queue(), gemm_grouped, rng.get_local_range()[0],
+      rng.get_global_range()[0], gemm_grouped.local_memory_size)};
+}
+
 /* Utility function used by the ReductionPartialRows specialization */
 template <typename operator_t, int ClSize, int WgSize, typename element_t,
           typename input_t, typename output_t, typename index_t,
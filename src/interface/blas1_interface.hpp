@@ -41,6 +41,133 @@
 
 namespace blas {
 namespace internal {
+
+/*! Blas1PacketSize.
+ * @brief Number of contiguous elements evaluated by each work item of the
+ * element-wise kernels when all the vectors have a unit stride, so that every
+ * load and store moves 16 bytes. A size of 1 disables the packet kernels.
+ */
+template <typename element_t>
+struct Blas1PacketSize {
+  static constexpr int value = 1;
+};
+
+template <>
+struct Blas1PacketSize<float> {
+  static constexpr int value = 4;
+};
+
+#ifdef BLAS_DATA_TYPE_DOUBLE
+template <>
+struct Blas1PacketSize<double> {
+  static constexpr int value = 2;
+};
+#endif  // BLAS_DATA_TYPE_DOUBLE
+
+#ifdef BLAS_DATA_TYPE_HALF
+template <>
+struct Blas1PacketSize<cl::sycl::half> {
+  static constexpr int value = 8;
+};
+#endif  // BLAS_DATA_TYPE_HALF
+
+/**
+ * \brief Executes lhs = rhs with one element per work item.
+ */
+template <typename executor_t, typename lhs_t, typename rhs_t>
+typename executor_t::policy_t::event_t _execute_assign(executor_t &ex,
+                                                       lhs_t &lhs, rhs_t rhs,
+                                                       bool, std::false_type) {
+  auto assignOp = make_op<Assign>(lhs, rhs);
+  return ex.execute(assignOp);
+}
+
+/**
+ * \brief Executes lhs = rhs with one packet of contiguous elements per work
+ * item when unit_stride is true, else with one element per work item.
+ */
+template <typename executor_t, typename lhs_t, typename rhs_t>
+typename executor_t::policy_t::event_t _execute_assign(executor_t &ex,
+                                                       lhs_t &lhs, rhs_t rhs,
+                                                       bool unit_stride,
+                                                       std::true_type) {
+  if (unit_stride) {
+    constexpr int packet_size =
+        Blas1PacketSize<typename lhs_t::value_t>::value;
+    auto assignOp = make_packet_assign<packet_size>(lhs, rhs);
+    return ex.execute(assignOp);
+  }
+  return _execute_assign(ex, lhs, rhs, unit_stride, std::false_type{});
+}
+
+/**
+ * \brief Executes the element-wise assignment lhs = rhs. When every vector
+ * of the expression has a unit stride, each work item evaluates a packet of
+ * Blas1PacketSize contiguous elements with vector loads and stores.
+ * @param unit_stride Whether all the vectors of lhs and rhs have a stride of 1
+ */
+template <typename executor_t, typename lhs_t, typename rhs_t>
+typename executor_t::policy_t::event_t _execute_assign(executor_t &ex,
+                                                       lhs_t &lhs, rhs_t rhs,
+                                                       bool unit_stride) {
+  using use_packets_t = std::integral_constant<
+      bool, (Blas1PacketSize<typename lhs_t::value_t>::value > 1)>;
+  return _execute_assign(ex, lhs, rhs, unit_stride, use_packets_t{});
+}
+
+/**
+ * \brief Executes the reduction of rhs into lhs with operator_t, reading one
+ * element at each step of a work item.
+ */
+template <typename operator_t, typename executor_t, typename lhs_t,
+          typename rhs_t, typename index_t>
+typename executor_t::policy_t::event_t _execute_reduction(
+    executor_t &ex, lhs_t &lhs, rhs_t rhs, index_t local_size,
+    index_t global_size, bool, std::false_type) {
+  auto assignOp =
+      make_AssignReduction<operator_t>(lhs, rhs, local_size, global_size);
+  return ex.execute(assignOp);
+}
+
+/**
+ * \brief Executes the reduction of rhs into lhs with operator_t, reading one
+ * packet of contiguous elements at each step of a work item when unit_stride
+ * is true, else one element.
+ */
+template <typename operator_t, typename executor_t, typename lhs_t,
+          typename rhs_t, typename index_t>
+typename executor_t::policy_t::event_t _execute_reduction(
+    executor_t &ex, lhs_t &lhs, rhs_t rhs, index_t local_size,
+    index_t global_size, bool unit_stride, std::true_type) {
+  if (unit_stride) {
+    constexpr int packet_size =
+        Blas1PacketSize<typename rhs_t::value_t>::value;
+    auto packetOp = make_packet_reduce_op<operator_t, packet_size>(rhs);
+    auto assignOp = make_AssignReduction<operator_t>(lhs, packetOp, local_size,
+                                                     global_size);
+    return ex.execute(assignOp);
+  }
+  return _execute_reduction<operator_t>(ex, lhs, rhs, local_size, global_size,
+                                        unit_stride, std::false_type{});
+}
+
+/**
+ * \brief Executes the reduction of rhs into lhs with operator_t. When every
+ * vector of rhs has a unit stride, each work item loads a packet of
+ * Blas1PacketSize contiguous elements at each step and reduces it.
+ * @param unit_stride Whether all the vectors of rhs have a stride of 1
+ */
+template <typename operator_t, typename executor_t, typename lhs_t,
+          typename rhs_t, typename index_t>
+typename executor_t::policy_t::event_t _execute_reduction(
+    executor_t &ex, lhs_t &lhs, rhs_t rhs, index_t local_size,
+    index_t global_size, bool unit_stride) {
+  using use_packets_t = std::integral_constant<
+      bool, (Blas1PacketSize<typename rhs_t::value_t>::value > 1)>;
+  return _execute_reduction<operator_t>(ex, lhs, rhs, local_size, global_size,
+                                        unit_stride, use_packets_t{});
+}
+
 /**
  * \brief AXPY constant times a vector plus a vector.
  *
@@ -62,9 +189,34 @@ typename executor_t::policy_t::event_t _axpy(
 
   auto scalOp = make_op<ScalarOp, ProductOperator>(_alpha, vx);
   auto addOp = make_op<BinaryOp, AddOperator>(vy, scalOp);
-  auto assignOp = make_op<Assign>(vy, addOp);
-  auto ret = ex.execute(assignOp);
-  return ret;
+  return _execute_assign(ex, vy, addOp, _incx == 1 && _incy == 1);
+}
+
+/**
+ * \brief AXPY with alpha stored in device memory.
+ *
+ * @param executor_t<ExecutorType> ex
+ * @param _alpha  BufferIterator to a single element
+ * @param _vx  BufferIterator
+ * @param _incx Increment in X axis
+ * @param _vy  BufferIterator
+ * @param _incy Increment in Y axis
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename element_t, typename index_t, typename increment_t>
+typename executor_t::policy_t::event_t _axpy(
+    executor_t &ex, index_t _N,
+    BufferIterator<element_t, typename executor_t::policy_t> _alpha,
+    container_0_t _vx, increment_t _incx, container_1_t _vy,
+    increment_t _incy) {
+  auto vx = make_vector_view(ex, _vx, _incx, _N);
+  auto vy = make_vector_view(ex, _vy, _incy, _N);
+  auto valpha = make_vector_view(ex, _alpha, increment_t{1}, index_t{1});
+
+  auto alpha = make_op<DeviceScalar>(valpha);
+  auto scalOp = make_op<ScalarOp, ProductOperator>(alpha, vx);
+  auto addOp = make_op<BinaryOp, AddOperator>(vy, scalOp);
+  return _execute_assign(ex, vy, addOp, _incx == 1 && _incy == 1);
 }
 
 /**
@@ -85,14 +237,13 @@ typename executor_t::policy_t::event_t _copy(executor_t &ex, index_t _N,
                                              increment_t _incy) {
   auto vx = make_vector_view(ex, _vx, _incx, _N);
   auto vy = make_vector_view(ex, _vy, _incy, _N);
-  auto assignOp2 = make_op<Assign>(vy, vx);
-  auto ret = ex.execute(assignOp2);
-  return ret;
+  return _execute_assign(ex, vy, vx, _incx == 1 && _incy == 1);
 }
 
 /**
  * \brief Compute the inner product of two vectors with extended precision
-    accumulation.
+    accumulation. The products are accumulated in the element type of _rs,
+    which may be wider than the one of the vectors.
  * @param executor_t<ExecutorType> ex
  * @param _vx  BufferIterator
  * @param _incx Increment in X axis
@@ -104,23 +255,99 @@ template <typename executor_t, typename container_0_t, typename container_1_t,
 typename executor_t::policy_t::event_t _dot(
     executor_t &ex, index_t _N, container_0_t _vx, increment_t _incx,
     container_1_t _vy, increment_t _incy, container_2_t _rs) {
+  using acc_t = typename ValueType<container_2_t>::type;
   auto vx = make_vector_view(ex, _vx, _incx, _N);
   auto vy = make_vector_view(ex, _vy, _incy, _N);
   auto rs = make_vector_view(ex, _rs, static_cast<increment_t>(1),
                              static_cast<index_t>(1));
-  auto prdOp = make_op<BinaryOp, ProductOperator>(vx, vy);
+  auto accX = make_type_cast_op<acc_t>(vx);
+  auto accY = make_type_cast_op<acc_t>(vy);
+  auto prdOp = make_op<BinaryOp, ProductOperator>(accX, accY);
 
   auto localSize = ex.get_policy_handler().get_work_group_size();
   auto nWG = 2 * localSize;
 
-  auto assignOp =
-      make_AssignReduction<AddOperator>(rs, prdOp, localSize, localSize * nWG);
+  return _execute_reduction<AddOperator>(ex, rs, prdOp, localSize,
+                                         localSize * nWG,
+                                         _incx == 1 && _incy == 1);
+}
+
+/**
+ * \brief Adds _sb to the inner product of two vectors, computed in the
+ * accumulation type of their element type (see AccumulatorType), and writes
+ * the result rounded to the element type in _rs.
+ * @param executor_t<ExecutorType> ex
+ * @param _sb Scalar added to the inner product
+ * @param _vx  BufferIterator
+ * @param _incx Increment in X axis
+ * @param _vy  BufferIterator
+ * @param _incy Increment in Y axis
+ */
+template <typename executor_t, typename element_t, typename container_0_t,
+          typename container_1_t, typename container_2_t, typename index_t,
+          typename increment_t>
+typename executor_t::policy_t::event_t _sdsdot(
+    executor_t &ex, index_t _N, element_t _sb, container_0_t _vx,
+    increment_t _incx, container_1_t _vy, increment_t _incy,
+    container_2_t _rs) {
+  using acc_t = typename AccumulatorType<element_t>::type;
+  auto gpu_acc = ex.get_policy_handler().template acquire_workspace<acc_t>(1);
+  auto ret0 = internal::_dot(ex, _N, _vx, _incx, _vy, _incy, gpu_acc);
+  auto acc = make_vector_view(ex, gpu_acc, static_cast<increment_t>(1),
+                              static_cast<index_t>(1));
+  auto rs = make_vector_view(ex, _rs, static_cast<increment_t>(1),
+                             static_cast<index_t>(1));
+  auto addOp = make_op<ScalarOp, AddOperator>(static_cast<acc_t>(_sb), acc);
+  auto castOp = make_type_cast_op<element_t>(addOp);
+  auto assignOp = make_op<Assign>(rs, castOp);
+  auto ret1 = ex.execute(assignOp);
+  ex.get_policy_handler().release_workspace(gpu_acc);
+  return blas::concatenate_vectors(ret0, ret1);
+}
+
+/**
+ * \brief Computes the inner product of X and Y, the Euclidean norm of X and
+ * the sum of the absolute values of X in a single pass over the vectors.
+ * @param executor_t<ExecutorType> ex
+ * @param _vx  BufferIterator
+ * @param _incx Increment in X axis
+ * @param _vy  BufferIterator
+ * @param _incy Increment in Y axis
+ * @param _rs  BufferIterator receiving dot, nrm2 and asum, in this order
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename index_t, typename increment_t>
+typename executor_t::policy_t::event_t _dot_nrm2_asum(
+    executor_t &ex, index_t _N, container_0_t _vx, increment_t _incx,
+    container_1_t _vy, increment_t _incy, container_2_t _rs) {
+  auto vx = make_vector_view(ex, _vx, _incx, _N);
+  auto vy = make_vector_view(ex, _vy, _incy, _N);
+  auto rs = make_vector_view(ex, _rs, static_cast<increment_t>(1),
+                             static_cast<index_t>(3));
+  // Each element of x and y is loaded once and shared by the three
+  // reductions
+  auto operands = make_reduction_operands(vx, vy);
+
+  auto localSize = ex.get_policy_handler().get_work_group_size();
+  auto nWG = 2 * localSize;
+
+  // nrm2 uses the same scaled sum of squares as _nrm2, so the norm neither
+  // overflows nor underflows when it fits in the element type
+  auto assignOp = make_multi_reduction(
+      rs, operands, localSize, localSize * nWG,
+      make_reduction_entry<AddOperator, ProductOperator>(),
+      make_reduction_entry<ScaledSquaresAddOperator,
+                           FirstOperandOperator<ScaledSquaresOperator>,
+                           ScaledSquaresNormOperator>(),
+      make_reduction_entry<AbsoluteAddOperator,
+                           FirstOperandOperator<IdentityOperator>>());
   auto ret = ex.execute(assignOp);
   return ret;
 }
 
 /**
- * \brief ASUM Takes the sum of the absolute values
+ * \brief ASUM Takes the sum of the absolute values, accumulated in the element
+ * type of _rs
  * @param executor_t<ExecutorType> ex
  * @param _vx  BufferIterator
  * @param _incx Increment in X axis
@@ -131,14 +358,16 @@ typename executor_t::policy_t::event_t _asum(executor_t &ex, index_t _N,
                                              container_0_t _vx,
                                              increment_t _incx,
                                              container_1_t _rs) {
+  using acc_t = typename ValueType<container_1_t>::type;
   auto vx = make_vector_view(ex, _vx, _incx, _N);
   auto rs = make_vector_view(ex, _rs, static_cast<increment_t>(1),
                              static_cast<index_t>(1));
+  auto accX = make_type_cast_op<acc_t>(vx);
 
   const auto localSize = ex.get_policy_handler().get_work_group_size();
   const auto nWG = 2 * localSize;
-  auto assignOp = make_AssignReduction<AbsoluteAddOperator>(rs, vx, localSize,
-                                                            localSize * nWG);
+  auto assignOp = make_AssignReduction<AbsoluteAddOperator>(
+      rs, accX, localSize, localSize * nWG);
   auto ret = ex.execute(assignOp);
   return ret;
 }
@@ -229,19 +458,38 @@ typename executor_t::policy_t::event_t _scal(executor_t &ex, index_t _N,
   auto vx = make_vector_view(ex, _vx, _incx, _N);
   if (_alpha == element_t{0}) {
     auto zeroOp = make_op<UnaryOp, AdditionIdentity>(vx);
-    auto assignOp = make_op<Assign>(vx, zeroOp);
-    auto ret = ex.execute(assignOp);
-    return ret;
+    return _execute_assign(ex, vx, zeroOp, _incx == 1);
   } else {
     auto scalOp = make_op<ScalarOp, ProductOperator>(_alpha, vx);
-    auto assignOp = make_op<Assign>(vx, scalOp);
-    auto ret = ex.execute(assignOp);
-    return ret;
+    return _execute_assign(ex, vx, scalOp, _incx == 1);
   }
 }
 
 /**
- * \brief NRM2 Returns the euclidian norm of a vector
+ * \brief SCALAR operation on a vector with alpha stored in device memory.
+ * Since alpha is not known on the host, the vector is always multiplied.
+ * @param executor_t ex
+ * @param _alpha  BufferIterator to a single element
+ * @param _vx  BufferIterator
+ * @param _incx Increment in X axis
+ */
+template <typename executor_t, typename element_t, typename container_0_t,
+          typename index_t, typename increment_t>
+typename executor_t::policy_t::event_t _scal(
+    executor_t &ex, index_t _N,
+    BufferIterator<element_t, typename executor_t::policy_t> _alpha,
+    container_0_t _vx, increment_t _incx) {
+  auto vx = make_vector_view(ex, _vx, _incx, _N);
+  auto valpha = make_vector_view(ex, _alpha, increment_t{1}, index_t{1});
+
+  auto alpha = make_op<DeviceScalar>(valpha);
+  auto scalOp = make_op<ScalarOp, ProductOperator>(alpha, vx);
+  return _execute_assign(ex, vx, scalOp, _incx == 1);
+}
+
+/**
+ * \brief NRM2 Returns the euclidian norm of a vector, accumulated in the
+ * element type of _rs
  * @param executor_t<ExecutorType> ex
  * @param _vx  BufferIterator
  * @param _incx Increment in X axis
@@ -252,22 +500,154 @@ typename executor_t::policy_t::event_t _nrm2(executor_t &ex, index_t _N,
                                              container_0_t _vx,
                                              increment_t _incx,
                                              container_1_t _rs) {
+  using acc_t = typename ValueType<container_1_t>::type;
   auto vx = make_vector_view(ex, _vx, _incx, _N);
   auto rs = make_vector_view(ex, _rs, static_cast<increment_t>(1),
                              static_cast<index_t>(1));
-  auto prdOp = make_op<UnaryOp, SquareOperator>(vx);
+  auto accX = make_type_cast_op<acc_t>(vx);
+  // The squares are accumulated relative to the largest absolute value, so
+  // the result neither overflows nor underflows when the norm itself fits
+  using tuple_t = ScaledSquaresTuple<acc_t>;
+  auto gpu_ssq =
+      ex.get_policy_handler().template acquire_workspace<tuple_t>(1);
+  auto ssq = make_vector_view(ex, gpu_ssq, static_cast<increment_t>(1),
+                              static_cast<index_t>(1));
+  auto sqrOp = make_scaled_squares_op(accX);
 
   const auto localSize = ex.get_policy_handler().get_work_group_size();
   const auto nWG = 2 * localSize;
-  auto assignOp =
-      make_AssignReduction<AddOperator>(rs, prdOp, localSize, localSize * nWG);
+  auto assignOp = make_AssignReduction<ScaledSquaresAddOperator>(
+      ssq, sqrOp, localSize, localSize * nWG);
   auto ret0 = ex.execute(assignOp);
-  auto sqrtOp = make_op<UnaryOp, SqrtOperator>(rs);
-  auto assignOpFinal = make_op<Assign>(rs, sqrtOp);
+  auto normOp = make_op<UnaryOp, ScaledSquaresNormOperator>(ssq);
+  auto assignOpFinal = make_op<Assign>(rs, normOp);
   auto ret1 = ex.execute(assignOpFinal);
+  ex.get_policy_handler().release_workspace(gpu_ssq);
   return blas::concatenate_vectors(ret0, ret1);
 }
 
+/**
+ * \brief Computes the inner products of a batch of pairs of vectors. Each
+ * work group reduces one pair, so the batch is computed by a single kernel.
+ * @param executor_t<ExecutorType> ex
+ * @param _vx  BufferIterator
+ * @param _incx Increment in X axis
+ * @param _stridex Distance between two consecutive vectors X
+ * @param _vy  BufferIterator
+ * @param _incy Increment in Y axis
+ * @param _stridey Distance between two consecutive vectors Y
+ * @param _rs  BufferIterator receiving one result per pair
+ * @param _batch_size Number of pairs of vectors
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename index_t, typename increment_t>
+typename executor_t::policy_t::event_t _dot_batched(
+    executor_t &ex, index_t _N, container_0_t _vx, increment_t _incx,
+    index_t _stridex, container_1_t _vy, increment_t _incy, index_t _stridey,
+    container_2_t _rs, index_t _batch_size) {
+  auto vx = make_vector_view(ex, _vx, static_cast<increment_t>(1),
+                             _stridex * _batch_size);
+  auto vy = make_vector_view(ex, _vy, static_cast<increment_t>(1),
+                             _stridey * _batch_size);
+  auto rs = make_vector_view(ex, _rs, static_cast<increment_t>(1), _batch_size);
+  auto batchX = make_strided_batch_op(vx, _N, static_cast<index_t>(_incx),
+                                      _stridex, _batch_size);
+  auto batchY = make_strided_batch_op(vy, _N, static_cast<index_t>(_incy),
+                                      _stridey, _batch_size);
+  auto prdOp = make_op<BinaryOp, ProductOperator>(batchX, batchY);
+
+  const auto localSize =
+      static_cast<index_t>(ex.get_policy_handler().get_work_group_size());
+  auto assignOp = make_batched_reduction<AddOperator>(rs, prdOp, _N, localSize);
+  return ex.execute(assignOp, localSize, localSize * _batch_size, localSize);
+}
+
+/**
+ * \brief Takes the sum of the absolute values of each vector of a batch
+ * @param executor_t<ExecutorType> ex
+ * @param _vx  BufferIterator
+ * @param _incx Increment in X axis
+ * @param _stridex Distance between two consecutive vectors X
+ * @param _rs  BufferIterator receiving one result per vector
+ * @param _batch_size Number of vectors
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename index_t, typename increment_t>
+typename executor_t::policy_t::event_t _asum_batched(
+    executor_t &ex, index_t _N, container_0_t _vx, increment_t _incx,
+    index_t _stridex, container_1_t _rs, index_t _batch_size) {
+  auto vx = make_vector_view(ex, _vx, static_cast<increment_t>(1),
+                             _stridex * _batch_size);
+  auto rs = make_vector_view(ex, _rs, static_cast<increment_t>(1), _batch_size);
+  auto batchX = make_strided_batch_op(vx, _N, static_cast<index_t>(_incx),
+                                      _stridex, _batch_size);
+
+  const auto localSize =
+      static_cast<index_t>(ex.get_policy_handler().get_work_group_size());
+  auto assignOp =
+      make_batched_reduction<AbsoluteAddOperator>(rs, batchX, _N, localSize);
+  return ex.execute(assignOp, localSize, localSize * _batch_size, localSize);
+}
+
+/**
+ * \brief Returns the euclidian norm of each vector of a batch. Unlike _nrm2,
+ * the square root is applied by the reduction kernel itself.
+ * @param executor_t<ExecutorType> ex
+ * @param _vx  BufferIterator
+ * @param _incx Increment in X axis
+ * @param _stridex Distance between two consecutive vectors X
+ * @param _rs  BufferIterator receiving one result per vector
+ * @param _batch_size Number of vectors
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename index_t, typename increment_t>
+typename executor_t::policy_t::event_t _nrm2_batched(
+    executor_t &ex, index_t _N, container_0_t _vx, increment_t _incx,
+    index_t _stridex, container_1_t _rs, index_t _batch_size) {
+  auto vx = make_vector_view(ex, _vx, static_cast<increment_t>(1),
+                             _stridex * _batch_size);
+  auto rs = make_vector_view(ex, _rs, static_cast<increment_t>(1), _batch_size);
+  auto batchX = make_strided_batch_op(vx, _N, static_cast<index_t>(_incx),
+                                      _stridex, _batch_size);
+  auto sqrOp = make_scaled_squares_op(batchX);
+
+  const auto localSize =
+      static_cast<index_t>(ex.get_policy_handler().get_work_group_size());
+  auto assignOp =
+      make_batched_reduction<ScaledSquaresAddOperator,
+                             ScaledSquaresNormOperator>(rs, sqrOp, _N,
+                                                        localSize);
+  return ex.execute(assignOp, localSize, localSize * _batch_size, localSize);
+}
+
+/**
+ * \brief Finds the index of the first element having maximum absolute value
+ * in each vector of a batch
+ * @param _vx  BufferIterator
+ * @param _incx Increment in X axis
+ * @param _stridex Distance between two consecutive vectors X
+ * @param _rs  BufferIterator receiving one index-value tuple per vector
+ * @param _batch_size Number of vectors
+ */
+template <typename executor_t, typename container_t, typename ContainerI,
+          typename index_t, typename increment_t>
+typename executor_t::policy_t::event_t _iamax_batched(
+    executor_t &ex, index_t _N, container_t _vx, increment_t _incx,
+    index_t _stridex, ContainerI _rs, index_t _batch_size) {
+  auto vx = make_vector_view(ex, _vx, static_cast<increment_t>(1),
+                             _stridex * _batch_size);
+  auto rs = make_vector_view(ex, _rs, static_cast<increment_t>(1), _batch_size);
+  auto batchX = make_strided_batch_op(vx, _N, static_cast<index_t>(_incx),
+                                      _stridex, _batch_size);
+  auto tupOp = make_tuple_op(batchX);
+
+  const auto localSize =
+      static_cast<index_t>(ex.get_policy_handler().get_work_group_size());
+  auto assignOp =
+      make_batched_reduction<IMaxOperator>(rs, tupOp, _N, localSize);
+  return ex.execute(assignOp, localSize, localSize * _batch_size, localSize);
+}
+
 /**
  * .
  * @brief _rot constructor given plane rotation
@@ -300,6 +680,121 @@ typename executor_t::policy_t::event_t _rot(
   return ret;
 }
 
+/**
+ * \brief Compute the inner product of two vectors without blocking the host.
+ * The result is copied to the host slot of the returned future.
+ *
+ * @param executor_t<ExecutorType> ex
+ * @param _vx  BufferIterator
+ * @param _incx Increment in X axis
+ * @param _vx  BufferIterator
+ * @param _incy Increment in Y axis
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename index_t, typename increment_t>
+scalar_future<typename ValueType<container_0_t>::type> _dot_async(
+    executor_t &ex, index_t _N, container_0_t _vx, increment_t _incx,
+    container_1_t _vy, increment_t _incy) {
+  using element_t = typename ValueType<container_0_t>::type;
+  scalar_future<element_t> res(element_t(0));
+  auto gpu_res =
+      ex.get_policy_handler().template acquire_workspace<element_t>(1);
+  res.add_events(
+      blas::internal::_dot(ex, _N, _vx, _incx, _vy, _incy, gpu_res));
+  res.add_events(ex.get_policy_handler().copy_to_host(gpu_res, res.data(), 1));
+  ex.get_policy_handler().release_workspace(gpu_res);
+  return res;
+}
+
+/**
+ * \brief ICAMAX finds the index of the first element having maximum without
+ * blocking the host.
+ * @param _vx  BufferIterator
+ * @param _incx Increment in X axis
+ */
+template <typename executor_t, typename container_t, typename index_t,
+          typename increment_t>
+scalar_future<index_t,
+              IndexValueTuple<index_t, typename ValueType<container_t>::type>>
+_iamax_async(executor_t &ex, index_t _N, container_t _vx, increment_t _incx) {
+  using element_t = typename ValueType<container_t>::type;
+  using IndValTuple = IndexValueTuple<index_t, element_t>;
+  scalar_future<index_t, IndValTuple> res(
+      IndValTuple(index_t(-1), element_t(-1)));
+  auto gpu_res =
+      ex.get_policy_handler().template acquire_workspace<IndValTuple>(1);
+  res.add_events(blas::internal::_iamax(ex, _N, _vx, _incx, gpu_res));
+  res.add_events(ex.get_policy_handler().copy_to_host(gpu_res, res.data(), 1));
+  ex.get_policy_handler().release_workspace(gpu_res);
+  return res;
+}
+
+/**
+ * \brief ICAMIN finds the index of the first element having minimum without
+ * blocking the host.
+ * @param _vx  BufferIterator
+ * @param _incx Increment in X axis
+ */
+template <typename executor_t, typename container_t, typename index_t,
+          typename increment_t>
+scalar_future<index_t,
+              IndexValueTuple<index_t, typename ValueType<container_t>::type>>
+_iamin_async(executor_t &ex, index_t _N, container_t _vx, increment_t _incx) {
+  using element_t = typename ValueType<container_t>::type;
+  using IndValTuple = IndexValueTuple<index_t, element_t>;
+  scalar_future<index_t, IndValTuple> res(
+      IndValTuple(index_t(-1), element_t(-1)));
+  auto gpu_res =
+      ex.get_policy_handler().template acquire_workspace<IndValTuple>(1);
+  res.add_events(blas::internal::_iamin(ex, _N, _vx, _incx, gpu_res));
+  res.add_events(ex.get_policy_handler().copy_to_host(gpu_res, res.data(), 1));
+  ex.get_policy_handler().release_workspace(gpu_res);
+  return res;
+}
+
+/**
+ * \brief ASUM Takes the sum of the absolute values without blocking the host.
+ *
+ * @param executor_t<ExecutorType> ex
+ * @param _vx  BufferIterator
+ * @param _incx Increment in X axis
+ */
+template <typename executor_t, typename container_t, typename index_t,
+          typename increment_t>
+scalar_future<typename ValueType<container_t>::type> _asum_async(
+    executor_t &ex, index_t _N, container_t _vx, increment_t _incx) {
+  using element_t = typename ValueType<container_t>::type;
+  scalar_future<element_t> res(element_t(0));
+  auto gpu_res =
+      ex.get_policy_handler().template acquire_workspace<element_t>(1);
+  res.add_events(blas::internal::_asum(ex, _N, _vx, _incx, gpu_res));
+  res.add_events(ex.get_policy_handler().copy_to_host(gpu_res, res.data(), 1));
+  ex.get_policy_handler().release_workspace(gpu_res);
+  return res;
+}
+
+/**
+ * \brief NRM2 Returns the euclidian norm of a vector without blocking the
+ * host.
+ *
+ * @param executor_t<ExecutorType> ex
+ * @param _vx  BufferIterator
+ * @param _incx Increment in X axis
+ */
+template <typename executor_t, typename container_t, typename index_t,
+          typename increment_t>
+scalar_future<typename ValueType<container_t>::type> _nrm2_async(
+    executor_t &ex, index_t _N, container_t _vx, increment_t _incx) {
+  using element_t = typename ValueType<container_t>::type;
+  scalar_future<element_t> res(element_t(0));
+  auto gpu_res =
+      ex.get_policy_handler().template acquire_workspace<element_t>(1);
+  res.add_events(blas::internal::_nrm2(ex, _N, _vx, _incx, gpu_res));
+  res.add_events(ex.get_policy_handler().copy_to_host(gpu_res, res.data(), 1));
+  ex.get_policy_handler().release_workspace(gpu_res);
+  return res;
+}
+
 /**
  * \brief Compute the inner product of two vectors with extended
     precision accumulation and result.
@@ -317,12 +812,7 @@ typename ValueType<container_0_t>::type _dot(executor_t &ex, index_t _N,
                                              increment_t _incx,
                                              container_1_t _vy,
                                              increment_t _incy) {
-  using element_t = typename ValueType<container_0_t>::type;
-  auto res = std::vector<element_t>(1);
-  auto gpu_res = make_sycl_iterator_buffer<element_t>(static_cast<index_t>(1));
-  blas::internal::_dot(ex, _N, _vx, _incx, _vy, _incy, gpu_res);
-  ex.get_policy_handler().copy_to_host(gpu_res, res.data(), 1);
-  return res[0];
+  return blas::internal::_dot_async(ex, _N, _vx, _incx, _vy, _incy).get();
 }
 
 /**
@@ -333,14 +823,7 @@ typename ValueType<container_0_t>::type _dot(executor_t &ex, index_t _N,
 template <typename executor_t, typename container_t, typename index_t,
           typename increment_t>
 index_t _iamax(executor_t &ex, index_t _N, container_t _vx, increment_t _incx) {
-  using element_t = typename ValueType<container_t>::type;
-  using IndValTuple = IndexValueTuple<index_t, element_t>;
-  std::vector<IndValTuple> rsT(1, IndValTuple(index_t(-1), element_t(-1)));
-  auto gpu_res =
-      make_sycl_iterator_buffer<IndValTuple>(static_cast<index_t>(1));
-  blas::internal::_iamax(ex, _N, _vx, _incx, gpu_res);
-  ex.get_policy_handler().copy_to_host(gpu_res, rsT.data(), 1);
-  return rsT[0].get_index();
+  return blas::internal::_iamax_async(ex, _N, _vx, _incx).get();
 }
 
 /**
@@ -351,14 +834,7 @@ index_t _iamax(executor_t &ex, index_t _N, container_t _vx, increment_t _incx) {
 template <typename executor_t, typename container_t, typename index_t,
           typename increment_t>
 index_t _iamin(executor_t &ex, index_t _N, container_t _vx, increment_t _incx) {
-  using element_t = typename ValueType<container_t>::type;
-  using IndValTuple = IndexValueTuple<index_t, element_t>;
-  std::vector<IndValTuple> rsT(1, IndValTuple(index_t(-1), element_t(-1)));
-  auto gpu_res =
-      make_sycl_iterator_buffer<IndValTuple>(static_cast<index_t>(1));
-  blas::internal::_iamin(ex, _N, _vx, _incx, gpu_res);
-  ex.get_policy_handler().copy_to_host(gpu_res, rsT.data(), 1);
-  return rsT[0].get_index();
+  return blas::internal::_iamin_async(ex, _N, _vx, _incx).get();
 }
 
 /**
@@ -373,12 +849,7 @@ template <typename executor_t, typename container_t, typename index_t,
 typename ValueType<container_t>::type _asum(executor_t &ex, index_t _N,
                                             container_t _vx,
                                             increment_t _incx) {
-  using element_t = typename ValueType<container_t>::type;
-  auto res = std::vector<element_t>(1, element_t(0));
-  auto gpu_res = make_sycl_iterator_buffer<element_t>(static_cast<index_t>(1));
-  blas::internal::_asum(ex, _N, _vx, _incx, gpu_res);
-  ex.get_policy_handler().copy_to_host(gpu_res, res.data(), 1);
-  return res[0];
+  return blas::internal::_asum_async(ex, _N, _vx, _incx).get();
 }
 
 /**
@@ -393,12 +864,7 @@ template <typename executor_t, typename container_t, typename index_t,
 typename ValueType<container_t>::type _nrm2(executor_t &ex, index_t _N,
                                             container_t _vx,
                                             increment_t _incx) {
-  using element_t = typename ValueType<container_t>::type;
-  auto res = std::vector<element_t>(1, element_t(0));
-  auto gpu_res = make_sycl_iterator_buffer<element_t>(static_cast<index_t>(1));
-  blas::internal::_nrm2(ex, _N, _vx, _incx, gpu_res);
-  ex.get_policy_handler().copy_to_host(gpu_res, res.data(), 1);
-  return res[0];
+  return blas::internal::_nrm2_async(ex, _N, _vx, _incx).get();
 }
 
 }  // namespace internal
@@ -0,0 +1,203 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename blas1_lazy_interface.hpp
+ *
+ **************************************************************************/
+
+#ifndef SYCL_BLAS_BLAS1_LAZY_INTERFACE_HPP
+#define SYCL_BLAS_BLAS1_LAZY_INTERFACE_HPP
+
+#include "blas_meta.h"
+#include "executors/executor.h"
+#include "interface/blas1_lazy_interface.h"
+#include "operations/blas1_trees.h"
+#include "operations/blas_operators.hpp"
+
+namespace blas {
+
+/*! LazyVector.
+ * @brief Vector whose value is a pending expression.
+ */
+template <typename view_t, typename expr_t>
+LazyVector<view_t, expr_t>::LazyVector(view_t view, expr_t expr)
+    : view_(view), expr_(expr) {}
+
+template <typename view_t, typename expr_t>
+view_t &LazyVector<view_t, expr_t>::get_view() {
+  return view_;
+}
+
+template <typename view_t, typename expr_t>
+expr_t &LazyVector<view_t, expr_t>::get_expression() {
+  return expr_;
+}
+
+template <typename executor_t, typename container_t, typename index_t,
+          typename increment_t>
+auto make_lazy_vector(executor_t &ex, container_t _vx, increment_t _incx,
+                      index_t _N)
+    -> LazyVector<decltype(make_vector_view(ex, _vx, _incx, _N)),
+                  decltype(make_vector_view(ex, _vx, _incx, _N))> {
+  auto vx = make_vector_view(ex, _vx, _incx, _N);
+  return LazyVector<decltype(vx), decltype(vx)>(vx, vx);
+}
+
+/**
+ * \brief Lazy AXPY, the result is the pending expression alpha * x + y
+ * stored in the memory of y.
+ */
+template <typename element_t, typename x_view_t, typename x_expr_t,
+          typename y_view_t, typename y_expr_t>
+LazyVector<y_view_t,
+           BinaryOp<AddOperator, y_expr_t,
+                    ScalarOp<ProductOperator, element_t, x_expr_t>>>
+_axpy(element_t _alpha, LazyVector<x_view_t, x_expr_t> _vx,
+      LazyVector<y_view_t, y_expr_t> _vy) {
+  auto scalOp =
+      make_op<ScalarOp, ProductOperator>(_alpha, _vx.get_expression());
+  auto addOp = make_op<BinaryOp, AddOperator>(_vy.get_expression(), scalOp);
+  return LazyVector<y_view_t, decltype(addOp)>(_vy.get_view(), addOp);
+}
+
+/**
+ * \brief Lazy SCAL, the result is the pending expression alpha * x stored in
+ * the memory of x.
+ */
+template <typename element_t, typename x_view_t, typename x_expr_t>
+LazyVector<x_view_t, ScalarOp<ProductOperator, element_t, x_expr_t>> _scal(
+    element_t _alpha, LazyVector<x_view_t, x_expr_t> _vx) {
+  auto scalOp =
+      make_op<ScalarOp, ProductOperator>(_alpha, _vx.get_expression());
+  return LazyVector<x_view_t, decltype(scalOp)>(_vx.get_view(), scalOp);
+}
+
+/**
+ * \brief Lazy COPY, the result is the pending expression of x stored in the
+ * memory of y.
+ */
+template <typename x_view_t, typename x_expr_t, typename y_view_t,
+          typename y_expr_t>
+LazyVector<y_view_t, x_expr_t> _copy(LazyVector<x_view_t, x_expr_t> _vx,
+                                     LazyVector<y_view_t, y_expr_t> _vy) {
+  return LazyVector<y_view_t, x_expr_t>(_vy.get_view(), _vx.get_expression());
+}
+
+/**
+ * \brief Lazy SWAP, the results are the pending expression of y stored in the
+ * memory of x and the one of x stored in the memory of y.
+ */
+template <typename x_view_t, typename x_expr_t, typename y_view_t,
+          typename y_expr_t>
+std::pair<LazyVector<x_view_t, y_expr_t>, LazyVector<y_view_t, x_expr_t>>
+_swap(LazyVector<x_view_t, x_expr_t> _vx, LazyVector<y_view_t, y_expr_t> _vy) {
+  return std::make_pair(
+      LazyVector<x_view_t, y_expr_t>(_vx.get_view(), _vy.get_expression()),
+      LazyVector<y_view_t, x_expr_t>(_vy.get_view(), _vx.get_expression()));
+}
+
+namespace internal {
+template <typename executor_t, typename x_view_t, typename x_expr_t>
+typename executor_t::policy_t::event_t materialize(
+    executor_t &ex, LazyVector<x_view_t, x_expr_t> _vx, std::true_type) {
+  auto assignOp = make_op<Assign>(_vx.get_view(), _vx.get_expression());
+  return ex.execute(assignOp);
+}
+
+// The memory of the vector already holds its value
+template <typename executor_t, typename x_view_t, typename x_expr_t>
+typename executor_t::policy_t::event_t materialize(
+    executor_t &, LazyVector<x_view_t, x_expr_t>, std::false_type) {
+  return {};
+}
+}  // namespace internal
+
+/**
+ * \brief Computes the pending expression of x and stores it in its memory.
+ */
+template <typename executor_t, typename x_view_t, typename x_expr_t>
+typename executor_t::policy_t::event_t materialize(
+    executor_t &ex, LazyVector<x_view_t, x_expr_t> _vx) {
+  return internal::materialize(
+      ex, _vx,
+      std::integral_constant<
+          bool, LazyVector<x_view_t, x_expr_t>::is_pending>());
+}
+
+/**
+ * \brief Computes the pending expressions of x and y in a single kernel and
+ * stores them in their memory.
+ */
+template <typename executor_t, typename x_view_t, typename x_expr_t,
+          typename y_view_t, typename y_expr_t>
+typename executor_t::policy_t::event_t materialize(
+    executor_t &ex, LazyVector<x_view_t, x_expr_t> _vx,
+    LazyVector<y_view_t, y_expr_t> _vy) {
+  auto assignOp = make_op<DoubleAssign>(_vx.get_view(), _vy.get_view(),
+                                        _vx.get_expression(),
+                                        _vy.get_expression());
+  return ex.execute(assignOp);
+}
+
+/**
+ * \brief Materializes both results of a lazy SWAP.
+ */
+template <typename executor_t, typename x_view_t, typename x_expr_t,
+          typename y_view_t, typename y_expr_t>
+typename executor_t::policy_t::event_t materialize(
+    executor_t &ex, std::pair<LazyVector<x_view_t, x_expr_t>,
+                              LazyVector<y_view_t, y_expr_t>>
+                        _vxy) {
+  return materialize(ex, _vxy.first, _vxy.second);
+}
+
+/**
+ * \brief Materializes x and waits for it to be stored in its memory.
+ */
+template <typename executor_t, typename x_view_t, typename x_expr_t>
+void wait(executor_t &ex, LazyVector<x_view_t, x_expr_t> _vx) {
+  ex.get_policy_handler().wait(materialize(ex, _vx));
+}
+
+/**
+ * \brief Materializes x and y together and waits for them.
+ */
+template <typename executor_t, typename x_view_t, typename x_expr_t,
+          typename y_view_t, typename y_expr_t>
+void wait(executor_t &ex, LazyVector<x_view_t, x_expr_t> _vx,
+          LazyVector<y_view_t, y_expr_t> _vy) {
+  ex.get_policy_handler().wait(materialize(ex, _vx, _vy));
+}
+
+/**
+ * \brief Materializes both results of a lazy SWAP and waits for them.
+ */
+template <typename executor_t, typename x_view_t, typename x_expr_t,
+          typename y_view_t, typename y_expr_t>
+void wait(executor_t &ex, std::pair<LazyVector<x_view_t, x_expr_t>,
+                                    LazyVector<y_view_t, y_expr_t>>
+                              _vxy) {
+  ex.get_policy_handler().wait(materialize(ex, _vxy));
+}
+
+}  // namespace blas
+
+#endif  // SYCL_BLAS_BLAS1_LAZY_INTERFACE_HPP
@@ -38,6 +38,18 @@ typename Executor::policy_t::event_t _gemv(Executor& ex, index_t _M, index_t _N,
                                            increment_t _incx, element_t _beta,
                                            container_t2 _vy,
                                            increment_t _incy) {
+  // Skinny matrices with a short contracting dimension are computed by a
+  // single kernel, without the temporary buffer of partial dot products
+  const index_t c_dim = trn == transpose_type::Normal ? _N : _M;
+  if ((_M < 512 || _N < 512) && c_dim <= 4096) {
+    if (trn == transpose_type::Normal) {
+      return blas::internal::_gemv_single_kernel_impl<64, 4, trn>(
+          ex, _M, _N, _alpha, _mA, _lda, _vx, _incx, _beta, _vy, _incy);
+    } else {
+      return blas::internal::_gemv_single_kernel_impl<64, 8, trn>(
+          ex, _M, _N, _alpha, _mA, _lda, _vx, _incx, _beta, _vy, _incy);
+    }
+  }
   if (trn == transpose_type::Normal) {
     return blas::internal::_gemv_impl<32, 32, gemv_memory_t::local, trn>(
         ex, _M, _N, _alpha, _mA, _lda, _vx, _incx, _beta, _vy, _incy);
@@ -46,6 +58,22 @@ typename Executor::policy_t::event_t _gemv(Executor& ex, index_t _M, index_t _N,
         ex, _M, _N, _alpha, _mA, _lda, _vx, _incx, _beta, _vy, _incy);
   }
 }
+
+template <transpose_type trn, uint32_t n_rhs, typename Executor,
+          typename index_t, typename element_t, typename container_t0,
+          typename container_t1, typename container_t2>
+typename Executor::policy_t::event_t _gemv_multi_rhs(
+    Executor& ex, index_t _M, index_t _N, element_t _alpha, container_t0 _mA,
+    index_t _lda, container_t1 _mX, index_t _ldx, element_t _beta,
+    container_t2 _mY, index_t _ldy) {
+  if (trn == transpose_type::Normal) {
+    return blas::internal::_gemv_multi_rhs_impl<64, 4, n_rhs, trn>(
+        ex, _M, _N, _alpha, _mA, _lda, _mX, _ldx, _beta, _mY, _ldy);
+  } else {
+    return blas::internal::_gemv_multi_rhs_impl<64, 16, n_rhs, trn>(
+        ex, _M, _N, _alpha, _mA, _lda, _mX, _ldx, _beta, _mY, _ldy);
+  }
+}
 }  // namespace backend
 }  // namespace gemv
 }  // namespace blas
@@ -87,7 +87,8 @@ typename Executor::policy_t::event_t _gemv_impl(
     const auto ld = is_transposed ? _N : _M;
     constexpr index_t one = 1;
 
-    auto dot_products_buffer = blas::make_sycl_iterator_buffer<element_t>(ld);
+    auto dot_products_buffer =
+        ex.get_policy_handler().template acquire_workspace<element_t>(ld);
     auto dot_products_matrix =
         make_matrix_view<col_major>(ex, dot_products_buffer, ld, one, ld);
 
@@ -101,6 +102,7 @@ typename Executor::policy_t::event_t _gemv_impl(
     auto gemvEvent =
         ex.execute(gemv, static_cast<index_t>(local_range), global_size);
 
+    typename Executor::policy_t::event_t ret;
     if (_beta != static_cast<element_t>(0)) {
       // vec_y * b
       auto betaMulYOp = make_op<ScalarOp, ProductOperator>(_beta, vy);
@@ -116,13 +118,15 @@ typename Executor::policy_t::event_t _gemv_impl(
       auto assignOp = make_op<Assign>(vy, addOp);
 
       // exectutes the above expression tree to yield the final GEMV result
-      return concatenate_vectors(gemvEvent, ex.execute(assignOp, local_range));
+      ret = concatenate_vectors(gemvEvent, ex.execute(assignOp, local_range));
     } else {
       auto alphaMulDotsOp =
           make_op<ScalarOp, ProductOperator>(_alpha, dot_products_matrix);
       auto assignOp = make_op<Assign>(vy, alphaMulDotsOp);
-      return concatenate_vectors(gemvEvent, ex.execute(assignOp, local_range));
+      ret = concatenate_vectors(gemvEvent, ex.execute(assignOp, local_range));
     }
+    ex.get_policy_handler().release_workspace(dot_products_buffer);
+    return ret;
 
   } else  // Local memory kernel
   {
@@ -146,7 +150,8 @@ typename Executor::policy_t::event_t _gemv_impl(
 
     // Create the dot products buffer and matrix view
     auto dot_products_buffer =
-        blas::make_sycl_iterator_buffer<element_t>(dot_products_buffer_size);
+        ex.get_policy_handler().template acquire_workspace<element_t>(
+            dot_products_buffer_size);
     auto dot_products_matrix =
         make_matrix_view<col_major>(ex, dot_products_buffer, ld, WGs_per_C, ld);
 
@@ -163,6 +168,7 @@ typename Executor::policy_t::event_t _gemv_impl(
     // Sum the partial dot products results from the GEMV kernel
     auto sumColsOp = make_sumMatrixColumns(dot_products_matrix);
 
+    typename Executor::policy_t::event_t ret;
     if (_beta != static_cast<element_t>(0)) {
       // vec_y * b
       auto betaMulYOp = make_op<ScalarOp, ProductOperator>(_beta, vy);
@@ -178,16 +184,146 @@ typename Executor::policy_t::event_t _gemv_impl(
       auto assignOp = make_op<Assign>(vy, addOp);
 
       // exectutes the above expression tree to yield the final GEMV result
-      return concatenate_vectors(gemvEvent, ex.execute(assignOp, local_range));
+      ret = concatenate_vectors(gemvEvent, ex.execute(assignOp, local_range));
     } else {
       auto alphaMulDotsOp =
           make_op<ScalarOp, ProductOperator>(_alpha, sumColsOp);
       auto assignOp = make_op<Assign>(vy, alphaMulDotsOp);
-      return concatenate_vectors(gemvEvent, ex.execute(assignOp, local_range));
+      ret = concatenate_vectors(gemvEvent, ex.execute(assignOp, local_range));
     }
+    ex.get_policy_handler().release_workspace(dot_products_buffer);
+    return ret;
   }
 }
 
+/*! _gemv_single_kernel_impl.
+ * @brief Internal implementation of the General Matrix Vector product with a
+ * single kernel.
+ *
+ * Unlike _gemv_impl, the partial dot products are reduced within the work
+ * group and alpha and beta are applied by the same kernel, so no temporary
+ * buffer nor second launch are needed. Every dot product is computed by a
+ * single work group, hence this is meant for short contracting dimensions.
+ *
+ * This function is called by blas::gemv::backend::_gemv, which selects it for
+ * skinny matrices on the platforms where it is beneficial.
+ *
+ * @tparam local_range  specifies the number of threads per work group used by
+ *                      the kernel
+ * @tparam c_lanes  specifies the number of threads computing each dot product,
+ *                  a power of two dividing local_range
+ * @tparam trn  specifies whether the input matrix should be transposed
+ */
+template <uint32_t local_range, uint32_t c_lanes, transpose_type trn,
+          typename Executor, typename index_t, typename element_t,
+          typename container_t0, typename container_t1, typename increment_t,
+          typename container_t2>
+typename Executor::policy_t::event_t _gemv_single_kernel_impl(
+    Executor& ex, index_t _M, index_t _N, element_t _alpha, container_t0 _mA,
+    index_t _lda, container_t1 _vx, increment_t _incx, element_t _beta,
+    container_t2 _vy, increment_t _incy) {
+  static_assert(local_range % c_lanes == 0 && (c_lanes & (c_lanes - 1)) == 0,
+                "c_lanes must be a power of two dividing local_range");
+  constexpr bool is_transposed = trn != transpose_type::Normal;
+
+  const auto x_vector_size = is_transposed ? _M : _N;
+  const auto y_vector_size = is_transposed ? _N : _M;
+
+  auto mA = make_matrix_view<col_major>(ex, _mA, _M, _N, _lda);
+  auto vx = make_vector_view(ex, _vx, _incx, x_vector_size);
+  auto vy = make_vector_view(ex, _vy, _incy, y_vector_size);
+
+  auto gemv = make_gemv_single_kernel<local_range, c_lanes, is_transposed>(
+      vy, mA, vx, _alpha, _beta);
+
+  const index_t global_size = gemv.get_num_workgroups() * local_range;
+  return ex.execute(gemv, static_cast<index_t>(local_range), global_size,
+                    static_cast<index_t>(local_range));
+}
+
+/*! _gemv_multi_rhs_impl.
+ * @brief Internal implementation of the General Matrix Vector product applied
+ * to the n_rhs columns of X.
+ *
+ * The kernel is organised as the one of _gemv_single_kernel_impl, with every
+ * work item accumulating n_rhs dot products, so that A is read only once
+ * whatever the number of vectors.
+ *
+ * This function is called by blas::gemv::backend::_gemv_multi_rhs, which
+ * selects the work group configuration for the platform.
+ *
+ * @tparam local_range  specifies the number of threads per work group used by
+ *                      the kernel
+ * @tparam c_lanes  specifies the number of threads computing each dot product,
+ *                  a power of two dividing local_range
+ * @tparam n_rhs  specifies the number of vectors
+ * @tparam trn  specifies whether the input matrix should be transposed
+ */
+template <uint32_t local_range, uint32_t c_lanes, uint32_t n_rhs,
+          transpose_type trn, typename Executor, typename index_t,
+          typename element_t, typename container_t0, typename container_t1,
+          typename container_t2>
+typename Executor::policy_t::event_t _gemv_multi_rhs_impl(
+    Executor& ex, index_t _M, index_t _N, element_t _alpha, container_t0 _mA,
+    index_t _lda, container_t1 _mX, index_t _ldx, element_t _beta,
+    container_t2 _mY, index_t _ldy) {
+  static_assert(local_range % c_lanes == 0 && (c_lanes & (c_lanes - 1)) == 0,
+                "c_lanes must be a power of two dividing local_range");
+  constexpr bool is_transposed = trn != transpose_type::Normal;
+
+  const index_t x_vector_size = is_transposed ? _M : _N;
+  const index_t y_vector_size = is_transposed ? _N : _M;
+
+  auto mA = make_matrix_view<col_major>(ex, _mA, _M, _N, _lda);
+  auto mX = make_matrix_view<col_major>(ex, _mX, x_vector_size,
+                                        static_cast<index_t>(n_rhs), _ldx);
+  auto mY = make_matrix_view<col_major>(ex, _mY, y_vector_size,
+                                        static_cast<index_t>(n_rhs), _ldy);
+
+  auto gemv = make_gemv_multi_rhs<local_range, c_lanes, n_rhs, is_transposed>(
+      mY, mA, mX, _alpha, _beta);
+
+  const index_t global_size = gemv.get_num_workgroups() * local_range;
+  return ex.execute(gemv, static_cast<index_t>(local_range), global_size,
+                    static_cast<index_t>(local_range * n_rhs));
+}
+
+/*! _gemv_batched_impl.
+ * @brief Internal implementation of the batched General Matrix Vector product.
+ *
+ * A single kernel computes the whole batch, each work item computing one
+ * element of one of the output vectors. This avoids a launch and a temporary
+ * buffer per item of the batch, which dominate for small matrices.
+ *
+ * @tparam trn  specifies whether the input matrices should be transposed
+ * @tparam batch_type  the layout of the batch, a gemm_batch_type_t
+ */
+template <transpose_type trn, int batch_type, typename Executor,
+          typename index_t, typename element_t, typename container_t0,
+          typename container_t1, typename increment_t, typename container_t2>
+typename Executor::policy_t::event_t _gemv_batched_impl(
+    Executor& ex, index_t _M, index_t _N, element_t _alpha, container_t0 _mA,
+    index_t _lda, container_t1 _vx, increment_t _incx, element_t _beta,
+    container_t2 _vy, increment_t _incy, index_t batch_size) {
+  constexpr bool is_transposed = trn != transpose_type::Normal;
+
+  const index_t x_vector_size = is_transposed ? _M : _N;
+  const index_t y_vector_size = is_transposed ? _N : _M;
+
+  // The kernel computes the offsets of the items of the batch itself, so the
+  // vectors are viewed as contiguous arrays covering the whole batch
+  auto mA = make_matrix_view<col_major>(ex, _mA, _M, _N, _lda);
+  auto vx = make_vector_view(ex, _vx, increment_t{1},
+                             x_vector_size * std::abs(_incx) * batch_size);
+  auto vy = make_vector_view(ex, _vy, increment_t{1},
+                             y_vector_size * std::abs(_incy) * batch_size);
+
+  auto gemv = make_gemv_batched<is_transposed, batch_type>(
+      vy, mA, vx, _alpha, _beta, static_cast<index_t>(_incx),
+      static_cast<index_t>(_incy), batch_size);
+  return ex.execute(gemv);
+}
+
 /*! _TRMV.
  * @brief Implementation of the Triangular Matrix Vector product.
  */
@@ -303,6 +439,11 @@ typename Executor::policy_t::event_t _trmv_impl(
 
 /*! _SYMV.
  * @brief Implementation of the Symmetric Matrix Vector product.
+ *
+ * Only the stored triangle of the matrix is read, once, each tile being used
+ * for both its row and its transposed products (see Symv in blas2_trees.h).
+ *
+ * @tparam tile_size  specifies the size of the square tiles of the matrix
  */
 /*
 ssymv 	( 	character  	UPLO,
@@ -316,89 +457,165 @@ ssymv 	( 	character  	UPLO,
    real, dimension(*)  	Y,
    integer  	INCY
  ) 	*/
-template <typename Executor, typename index_t, typename element_t,
-          typename container_t0, typename container_t1, typename increment_t,
-          typename container_t2>
+template <uint32_t tile_size, typename Executor, typename index_t,
+          typename element_t, typename container_t0, typename container_t1,
+          typename increment_t, typename container_t2>
 typename Executor::policy_t::event_t _symv_impl(
     Executor& ex, char _Uplo, index_t _N, element_t _alpha, container_t0 _mA,
     index_t _lda, container_t1 _vx, increment_t _incx, element_t _beta,
-    container_t2 _vy, increment_t _incy, index_t _localSize = 0,
-    index_t _scratchPadSize = 0, index_t _nRowsWG = 0, index_t _nColsWG = 0) {
+    container_t2 _vy, increment_t _incy) {
   _Uplo = tolower(_Uplo);
   typename Executor::policy_t::event_t ret;
   if ((_Uplo != 'u') && (_Uplo != 'l')) {
     throw std::invalid_argument("Erroneous parameter");
   }
-  int triangOpr = (_Uplo == 'u');
   index_t N = _N;
   auto mA = make_matrix_view<col_major>(ex, _mA, N, N, _lda);
   auto vx = make_vector_view(ex, _vx, _incx, N);
   auto vy = make_vector_view(ex, _vy, _incy, N);
-  auto mAT = make_matrix_view<row_major>(ex, _mA, N, N, _lda);
-
-  const index_t interLoop = 1;
-
-  const index_t localSize = (_localSize == 0)
-                                ? ex.get_policy_handler().get_work_group_size()
-                                : _localSize;
-  const index_t scratchPadSize =
-      (_localSize == 0) ? localSize : _scratchPadSize;
 
-  const index_t nRowsWG_R = (_nRowsWG == 0) ? 1 : std::min(N, _nRowsWG);
-  const index_t nColsWG_R = (_nColsWG == 0) ? N : std::min(N, _nColsWG);
-
-  const index_t nWGPerRow_R = (N - 1) / nRowsWG_R + 1;
-  const index_t nWGPerCol_R = (N - 1) / nColsWG_R + 1;
-  const index_t globalSize_R = localSize * nWGPerRow_R * nWGPerCol_R;
-
-  const index_t nRowsWG_C = (_nRowsWG == 0) ? localSize : _nRowsWG;
-  const index_t nColsWG_C = (_nColsWG == 0) ? localSize : _nColsWG;
-
-  const index_t nWGPerRow_C = (N - 1) / nRowsWG_C + 1;
-  const index_t nWGPerCol_C = (N - 1) / nColsWG_C + 1;
-  const index_t globalSize_C = localSize * nWGPerRow_C * nWGPerCol_C;
+  // Each tile of the stored triangle writes its row and transposed products
+  // to their own column of a N x num_tiles matrix, y being the sum of its
+  // columns
+  const index_t num_tiles = (N - 1) / tile_size + 1;
+  auto partial_buffer =
+      ex.get_policy_handler().template acquire_workspace<element_t>(
+          N * num_tiles);
+  auto partial_matrix =
+      make_matrix_view<col_major>(ex, partial_buffer, N, num_tiles, N);
+
+  if (_Uplo == 'u') {
+    auto symv = make_symv<tile_size, true>(partial_matrix, mA, vx);
+    ret = ex.execute(symv, symv.local_range,
+                     num_tiles * num_tiles * symv.local_range,
+                     symv.local_memory_size);
+  } else {
+    auto symv = make_symv<tile_size, false>(partial_matrix, mA, vx);
+    ret = ex.execute(symv, symv.local_range,
+                     num_tiles * num_tiles * symv.local_range,
+                     symv.local_memory_size);
+  }
 
-  const index_t scratchSize_R =
-      ((scratchPadSize == 0) ? std::min(N, localSize) : 1) * nWGPerCol_R;
+  auto sumColsOp = make_sumMatrixColumns(partial_matrix);
+  auto alphaMulSumOp = make_op<ScalarOp, ProductOperator>(_alpha, sumColsOp);
+  if (_beta != static_cast<element_t>(0)) {
+    auto betaMulYOp = make_op<ScalarOp, ProductOperator>(_beta, vy);
+    auto addOp = make_op<BinaryOp, AddOperator>(betaMulYOp, alphaMulSumOp);
+    auto assignOp = make_op<Assign>(vy, addOp);
+    ret = concatenate_vectors(ret, ex.execute(assignOp));
+  } else {
+    // y is not read when beta is zero, as in the reference BLAS
+    auto assignOp = make_op<Assign>(vy, alphaMulSumOp);
+    ret = concatenate_vectors(ret, ex.execute(assignOp));
+  }
+  ex.get_policy_handler().release_workspace(partial_buffer);
+  return ret;
+}
 
-  auto valTR = blas::make_sycl_iterator_buffer<element_t>(N * scratchSize_R);
-  auto matR =
-      make_matrix_view<row_major>(ex, valTR, N, scratchSize_R, scratchSize_R);
+/*! _TRSV.
+ * @brief Implementation of the Triangular Solve with a single right hand side.
+ *
+ * The diagonal blocks of A are inverted first by DiagonalBlocksInverter, as in
+ * _trsm. The blocks are then solved in order, forward when op(A) is lower
+ * triangular and backward otherwise, each by a single TrsvBlock kernel that
+ * multiplies the right hand side of the block with the inverse of the
+ * diagonal block in local memory and applies the GEMV update of the remaining
+ * rows (see TrsvBlock in blas2_trees.h).
+ *
+ * The right hand side is copied to a contiguous workspace that holds the
+ * updated right hand side, while the solution is written to x.
+ *
+ * @tparam block_size  the size of the diagonal blocks
+ * @tparam local_range  the number of work items per work group of the update
+ */
+template <uint32_t block_size, uint32_t local_range, transpose_type trn,
+          typename Executor, typename index_t, typename container_t0,
+          typename container_t1, typename increment_t>
+typename Executor::policy_t::event_t _trsv_impl(
+    Executor& ex, char _Uplo, char _Diag, index_t _N, container_t0 _mA,
+    index_t _lda, container_t1 _vx, increment_t _incx) {
+  static_assert(local_range >= block_size,
+                "The work groups must have a work item per row of the block");
+  _Uplo = tolower(_Uplo);
+  _Diag = tolower(_Diag);
+  if (((_Uplo != 'u') && (_Uplo != 'l')) ||
+      ((_Diag != 'u') && (_Diag != 'n'))) {
+    throw std::invalid_argument("Erroneous parameter");
+  }
+  constexpr bool is_transposed = trn != transpose_type::Normal;
+  const bool is_upper = _Uplo == 'u';
+  const bool is_unit_diag = _Diag == 'u';
+  const bool is_op_upper = is_upper != is_transposed;
+  using element_t = typename ValueType<container_t0>::type;
 
-  const index_t scratchSize_C = nWGPerCol_C;
+  const index_t N = _N;
+  constexpr index_t block_dim = static_cast<index_t>(block_size);
+  const index_t num_blocks = (N - 1) / block_dim + 1;
+  auto mA = make_matrix_view<col_major>(ex, _mA, N, N, _lda);
+  auto vx = make_vector_view(ex, _vx, _incx, N);
 
-  auto valTC = blas::make_sycl_iterator_buffer<element_t>(N * scratchSize_C);
-  auto matC =
-      make_matrix_view<row_major>(ex, valTC, N, scratchSize_C, scratchSize_C);
+  // Inverses of the diagonal blocks, one block_size x block_size block after
+  // the other
+  auto inv_a_buffer =
+      ex.get_policy_handler().template acquire_workspace<element_t>(
+          num_blocks * block_dim * block_dim);
+  auto inv_a = make_matrix_view<col_major>(ex, inv_a_buffer, block_dim,
+                                           num_blocks * block_dim, block_dim);
+  typename Executor::policy_t::event_t ret;
+  {
+    const index_t global_size = num_blocks * block_dim;
+    const index_t local_memory_size = block_dim * block_dim;
+    if (is_unit_diag && is_upper) {
+      auto inverter =
+          make_diag_blocks_inverter<true, true, block_size>(mA, inv_a);
+      ret = ex.execute(inverter, block_dim, global_size, local_memory_size);
+    } else if (!is_unit_diag && is_upper) {
+      auto inverter =
+          make_diag_blocks_inverter<false, true, block_size>(mA, inv_a);
+      ret = ex.execute(inverter, block_dim, global_size, local_memory_size);
+    } else if (is_unit_diag && !is_upper) {
+      auto inverter =
+          make_diag_blocks_inverter<true, false, block_size>(mA, inv_a);
+      ret = ex.execute(inverter, block_dim, global_size, local_memory_size);
+    } else {
+      auto inverter =
+          make_diag_blocks_inverter<false, false, block_size>(mA, inv_a);
+      ret = ex.execute(inverter, block_dim, global_size, local_memory_size);
+    }
+  }
 
-  if (triangOpr == 1) {
-    auto gemvC = make_Gemv_Col<false, true, true>(matC, mA, vx, nWGPerRow_C,
-                                                  nWGPerCol_C, scratchPadSize);
-    auto gemvR = make_Gemv_Row<interLoop, true, false, false>(
-        matR, mAT, vx, nWGPerRow_R, nWGPerCol_R, scratchPadSize);
-    ret = concatenate_vectors(
-        ret, ex.execute(gemvC, localSize, globalSize_C, scratchPadSize));
-    ret = concatenate_vectors(
-        ret, ex.execute(gemvR, localSize, globalSize_R, scratchPadSize));
-  } else {
-    auto gemvC = make_Gemv_Col<true, true, false>(matC, mA, vx, nWGPerRow_C,
-                                                  nWGPerCol_C, scratchPadSize);
-    auto gemvR = make_Gemv_Row<interLoop, false, false, true>(
-        matR, mAT, vx, nWGPerRow_R, nWGPerCol_R, scratchPadSize);
-    ret = concatenate_vectors(
-        ret, ex.execute(gemvC, localSize, globalSize_C, scratchPadSize));
-    ret = concatenate_vectors(
-        ret, ex.execute(gemvR, localSize, globalSize_R, scratchPadSize));
+  // Contiguous copy of the right hand side
+  constexpr increment_t one = 1;
+  auto b_buffer =
+      ex.get_policy_handler().template acquire_workspace<element_t>(N);
+  auto vb = make_vector_view(ex, b_buffer, one, N);
+  auto copyOp = make_op<Assign>(vb, vx);
+  ret = concatenate_vectors(ret, ex.execute(copyOp));
+
+  constexpr index_t local_size = static_cast<index_t>(local_range);
+  for (index_t step = 0; step < num_blocks; step++) {
+    const index_t block = is_op_upper ? num_blocks - 1 - step : step;
+    if (is_upper) {
+      auto trsv =
+          make_trsv_block<block_size, local_range, true, is_transposed>(
+              vx, mA, inv_a, vb, block);
+      ret = concatenate_vectors(
+          ret, ex.execute(trsv, local_size,
+                          trsv.get_num_workgroups() * local_size,
+                          trsv.local_memory_size));
+    } else {
+      auto trsv =
+          make_trsv_block<block_size, local_range, false, is_transposed>(
+              vx, mA, inv_a, vb, block);
+      ret = concatenate_vectors(
+          ret, ex.execute(trsv, local_size,
+                          trsv.get_num_workgroups() * local_size,
+                          trsv.local_memory_size));
+    }
   }
 
-  auto scalOp1 = make_op<ScalarOp, ProductOperator>(_beta, vy);
-  auto addMOpR = make_sumMatrixColumns(matR);
-  auto addMOpC = make_sumMatrixColumns(matC);
-  auto addMOp = make_op<BinaryOp, AddOperator>(addMOpR, addMOpC);
-  auto scalOp2 = make_op<ScalarOp, ProductOperator>(_alpha, addMOp);
-  auto addOp = make_op<BinaryOp, AddOperator>(scalOp1, scalOp2);
-  auto assignOp = make_op<Assign>(vy, addOp);
-  ret = concatenate_vectors(ret, ex.execute(assignOp, localSize));
+  ex.get_policy_handler().release_workspace(inv_a_buffer);
+  ex.get_policy_handler().release_workspace(b_buffer);
   return ret;
 }
 
@@ -542,6 +759,215 @@ typename Executor::policy_t::event_t _syr2_impl(
   }
 }
 
+/**** BANDED AND PACKED MATRICES ****/
+
+/*! _GBMV.
+ * @brief Implementation of the General Band Matrix Vector product.
+ *
+ * The matrix view spans the (_KL + _KU + 1) x _N band storage only, each work
+ * item computing an element of y from the band of its row (see Gbmv in
+ * blas2_trees.h).
+ */
+template <transpose_type trn, typename Executor, typename index_t,
+          typename element_t, typename container_t0, typename container_t1,
+          typename increment_t, typename container_t2>
+typename Executor::policy_t::event_t _gbmv_impl(
+    Executor& ex, index_t _M, index_t _N, index_t _KL, index_t _KU,
+    element_t _alpha, container_t0 _mA, index_t _lda, container_t1 _vx,
+    increment_t _incx, element_t _beta, container_t2 _vy, increment_t _incy) {
+  if ((_KL < 0) || (_KU < 0) || (_lda < _KL + _KU + 1)) {
+    throw std::invalid_argument("Erroneous parameter");
+  }
+  constexpr bool is_transposed = trn != transpose_type::Normal;
+  const index_t x_vector_size = is_transposed ? _M : _N;
+  const index_t y_vector_size = is_transposed ? _N : _M;
+
+  auto mA = make_matrix_view<col_major>(ex, _mA, _KL + _KU + 1, _N, _lda);
+  auto vx = make_vector_view(ex, _vx, _incx, x_vector_size);
+  auto vy = make_vector_view(ex, _vy, _incy, y_vector_size);
+
+  auto gbmv = make_gbmv<is_transposed>(vy, mA, vx, _KL, _KU, _alpha, _beta);
+  return ex.execute(gbmv);
+}
+
+/*! _SBMV.
+ * @brief Implementation of the Symmetric Band Matrix Vector product.
+ */
+template <typename Executor, typename index_t, typename element_t,
+          typename container_t0, typename container_t1, typename increment_t,
+          typename container_t2>
+typename Executor::policy_t::event_t _sbmv_impl(
+    Executor& ex, char _Uplo, index_t _N, index_t _K, element_t _alpha,
+    container_t0 _mA, index_t _lda, container_t1 _vx, increment_t _incx,
+    element_t _beta, container_t2 _vy, increment_t _incy) {
+  _Uplo = tolower(_Uplo);
+  if (((_Uplo != 'u') && (_Uplo != 'l')) || (_K < 0) || (_lda < _K + 1)) {
+    throw std::invalid_argument("Erroneous parameter");
+  }
+  auto mA = make_matrix_view<col_major>(ex, _mA, _K + 1, _N, _lda);
+  auto vx = make_vector_view(ex, _vx, _incx, _N);
+  auto vy = make_vector_view(ex, _vy, _incy, _N);
+
+  if (_Uplo == 'u') {
+    auto sbmv = make_sbmv<true>(vy, mA, vx, _K, _alpha, _beta);
+    return ex.execute(sbmv);
+  } else {
+    auto sbmv = make_sbmv<false>(vy, mA, vx, _K, _alpha, _beta);
+    return ex.execute(sbmv);
+  }
+}
+
+/*! _SPMV.
+ * @brief Implementation of the Symmetric Packed Matrix Vector product.
+ *
+ * The packed matrix is viewed as a vector of _N * (_N + 1) / 2 elements, the
+ * position of each element being computed in the kernel (see Spmv in
+ * blas2_trees.h).
+ */
+template <typename Executor, typename index_t, typename element_t,
+          typename container_t0, typename container_t1, typename increment_t,
+          typename container_t2>
+typename Executor::policy_t::event_t _spmv_impl(
+    Executor& ex, char _Uplo, index_t _N, element_t _alpha, container_t0 _mAP,
+    container_t1 _vx, increment_t _incx, element_t _beta, container_t2 _vy,
+    increment_t _incy) {
+  _Uplo = tolower(_Uplo);
+  if ((_Uplo != 'u') && (_Uplo != 'l')) {
+    throw std::invalid_argument("Erroneous parameter");
+  }
+  constexpr increment_t one = 1;
+  auto mAP = make_vector_view(ex, _mAP, one, (_N * (_N + 1)) / 2);
+  auto vx = make_vector_view(ex, _vx, _incx, _N);
+  auto vy = make_vector_view(ex, _vy, _incy, _N);
+
+  if (_Uplo == 'u') {
+    auto spmv = make_spmv<true>(vy, mAP, vx, _alpha, _beta);
+    return ex.execute(spmv);
+  } else {
+    auto spmv = make_spmv<false>(vy, mAP, vx, _alpha, _beta);
+    return ex.execute(spmv);
+  }
+}
+
+/*! _TBMV.
+ * @brief Implementation of the Triangular Band Matrix Vector product.
+ *
+ * x is copied to a workspace first, since each of its elements is read by
+ * several work items while the result overwrites it.
+ */
+template <transpose_type trn, typename Executor, typename index_t,
+          typename container_t0, typename container_t1, typename increment_t>
+typename Executor::policy_t::event_t _tbmv_impl(
+    Executor& ex, char _Uplo, char _Diag, index_t _N, index_t _K,
+    container_t0 _mA, index_t _lda, container_t1 _vx, increment_t _incx) {
+  _Uplo = tolower(_Uplo);
+  _Diag = tolower(_Diag);
+  if (((_Uplo != 'u') && (_Uplo != 'l')) ||
+      ((_Diag != 'u') && (_Diag != 'n')) || (_K < 0) || (_lda < _K + 1)) {
+    throw std::invalid_argument("Erroneous parameter");
+  }
+  constexpr bool is_transposed = trn != transpose_type::Normal;
+  const bool unit_diag = _Diag == 'u';
+  using element_t = typename ValueType<container_t0>::type;
+  auto mA = make_matrix_view<col_major>(ex, _mA, _K + 1, _N, _lda);
+  auto vx = make_vector_view(ex, _vx, _incx, _N);
+
+  constexpr increment_t one = 1;
+  auto x_copy_buffer =
+      ex.get_policy_handler().template acquire_workspace<element_t>(_N);
+  auto vx_copy = make_vector_view(ex, x_copy_buffer, one, _N);
+  auto copyOp = make_op<Assign>(vx_copy, vx);
+  auto ret = ex.execute(copyOp);
+
+  if (_Uplo == 'u') {
+    auto tbmv = make_tbmv<true, is_transposed>(vx, mA, vx_copy, _K, unit_diag);
+    ret = concatenate_vectors(ret, ex.execute(tbmv));
+  } else {
+    auto tbmv = make_tbmv<false, is_transposed>(vx, mA, vx_copy, _K, unit_diag);
+    ret = concatenate_vectors(ret, ex.execute(tbmv));
+  }
+  ex.get_policy_handler().release_workspace(x_copy_buffer);
+  return ret;
+}
+
+/*! _TPMV.
+ * @brief Implementation of the Triangular Packed Matrix Vector product.
+ *
+ * As in _tbmv_impl, the kernel reads a copy of x.
+ */
+template <transpose_type trn, typename Executor, typename index_t,
+          typename container_t0, typename container_t1, typename increment_t>
+typename Executor::policy_t::event_t _tpmv_impl(
+    Executor& ex, char _Uplo, char _Diag, index_t _N, container_t0 _mAP,
+    container_t1 _vx, increment_t _incx) {
+  _Uplo = tolower(_Uplo);
+  _Diag = tolower(_Diag);
+  if (((_Uplo != 'u') && (_Uplo != 'l')) ||
+      ((_Diag != 'u') && (_Diag != 'n'))) {
+    throw std::invalid_argument("Erroneous parameter");
+  }
+  constexpr bool is_transposed = trn != transpose_type::Normal;
+  const bool unit_diag = _Diag == 'u';
+  using element_t = typename ValueType<container_t0>::type;
+  constexpr increment_t one = 1;
+  auto mAP = make_vector_view(ex, _mAP, one, (_N * (_N + 1)) / 2);
+  auto vx = make_vector_view(ex, _vx, _incx, _N);
+
+  auto x_copy_buffer =
+      ex.get_policy_handler().template acquire_workspace<element_t>(_N);
+  auto vx_copy = make_vector_view(ex, x_copy_buffer, one, _N);
+  auto copyOp = make_op<Assign>(vx_copy, vx);
+  auto ret = ex.execute(copyOp);
+
+  if (_Uplo == 'u') {
+    auto tpmv = make_tpmv<true, is_transposed>(vx, mAP, vx_copy, unit_diag);
+    ret = concatenate_vectors(ret, ex.execute(tpmv));
+  } else {
+    auto tpmv = make_tpmv<false, is_transposed>(vx, mAP, vx_copy, unit_diag);
+    ret = concatenate_vectors(ret, ex.execute(tpmv));
+  }
+  ex.get_policy_handler().release_workspace(x_copy_buffer);
+  return ret;
+}
+
+/*! _TBSV.
+ * @brief Implementation of the Triangular Band Solve.
+ *
+ * The substitution is sequential along the rows, so a single work group of
+ * local_range work items solves the whole system, splitting the band of each
+ * row between them (see Tbsv in blas2_trees.h).
+ *
+ * @tparam local_range  the number of work items of the work group
+ */
+template <uint32_t local_range, transpose_type trn, typename Executor,
+          typename index_t, typename container_t0, typename container_t1,
+          typename increment_t>
+typename Executor::policy_t::event_t _tbsv_impl(
+    Executor& ex, char _Uplo, char _Diag, index_t _N, index_t _K,
+    container_t0 _mA, index_t _lda, container_t1 _vx, increment_t _incx) {
+  _Uplo = tolower(_Uplo);
+  _Diag = tolower(_Diag);
+  if (((_Uplo != 'u') && (_Uplo != 'l')) ||
+      ((_Diag != 'u') && (_Diag != 'n')) || (_K < 0) || (_lda < _K + 1)) {
+    throw std::invalid_argument("Erroneous parameter");
+  }
+  constexpr bool is_transposed = trn != transpose_type::Normal;
+  const bool unit_diag = _Diag == 'u';
+  auto mA = make_matrix_view<col_major>(ex, _mA, _K + 1, _N, _lda);
+  auto vx = make_vector_view(ex, _vx, _incx, _N);
+
+  constexpr index_t local_size = static_cast<index_t>(local_range);
+  if (_Uplo == 'u') {
+    auto tbsv = make_tbsv<local_range, true, is_transposed>(vx, mA, _K,
+                                                            unit_diag);
+    return ex.execute(tbsv, local_size, local_size, local_size);
+  } else {
+    auto tbsv = make_tbsv<local_range, false, is_transposed>(vx, mA, _K,
+                                                             unit_diag);
+    return ex.execute(tbsv, local_size, local_size, local_size);
+  }
+}
+
 /*!
  @brief Generalised matrix vector product with rectangular non-symmetric
  matrices.
@@ -585,6 +1011,150 @@ typename Executor::policy_t::event_t inline _gemv(
                    _incy);
 }
 
+/*! _gemv.
+ * @brief GEMV with alpha and beta stored in device memory.
+ *
+ * The matrix vector product is computed by the backend GEMV into a scratch
+ * vector, and the scalars are applied by a second kernel that reads them from
+ * the device, so no copy to the host is needed. Since beta is not known on the
+ * host, y is always read, but its values are ignored when beta is zero.
+ */
+template <typename Executor, typename index_t, typename element_t,
+          typename container_t0, typename container_t1, typename increment_t,
+          typename container_t2>
+typename Executor::policy_t::event_t _gemv(
+    Executor& ex, char _trans, index_t _M, index_t _N,
+    BufferIterator<element_t, typename Executor::policy_t> _alpha,
+    container_t0 _mA, index_t _lda, container_t1 _vx, increment_t _incx,
+    BufferIterator<element_t, typename Executor::policy_t> _beta,
+    container_t2 _vy, increment_t _incy) {
+  const index_t y_vector_size = tolower(_trans) == 'n' ? _M : _N;
+
+  auto product_buffer =
+      ex.get_policy_handler().template acquire_workspace<element_t>(
+          y_vector_size);
+  auto gemvEvent =
+      internal::_gemv(ex, _trans, _M, _N, element_t{1}, _mA, _lda, _vx, _incx,
+                      element_t{0}, product_buffer, increment_t{1});
+
+  auto vy = make_vector_view(ex, _vy, _incy, y_vector_size);
+  auto vproduct =
+      make_vector_view(ex, product_buffer, increment_t{1}, y_vector_size);
+  auto valpha = make_vector_view(ex, _alpha, increment_t{1}, index_t{1});
+  auto vbeta = make_vector_view(ex, _beta, increment_t{1}, index_t{1});
+
+  // y = beta * y + alpha * (A * x)
+  auto alpha = make_op<DeviceScalar>(valpha);
+  auto beta = make_op<DeviceScalar>(vbeta);
+  auto betaMulYOp = make_op<ScalarOp, ScalarProductOrZeroOperator>(beta, vy);
+  auto alphaMulProductOp = make_op<ScalarOp, ProductOperator>(alpha, vproduct);
+  auto addOp = make_op<BinaryOp, AddOperator>(betaMulYOp, alphaMulProductOp);
+  auto assignOp = make_op<Assign>(vy, addOp);
+  auto ret = concatenate_vectors(gemvEvent, ex.execute(assignOp));
+
+  ex.get_policy_handler().release_workspace(product_buffer);
+  return ret;
+}
+
+/*! _gemv_multi_rhs_chunk.
+ * @brief Computes up to eight vectors with the backend multi vector GEMV,
+ * turning their number into the compile time parameter of the kernel.
+ */
+template <transpose_type trn, typename Executor, typename index_t,
+          typename element_t, typename container_t0, typename container_t1,
+          typename container_t2>
+typename Executor::policy_t::event_t _gemv_multi_rhs_chunk(
+    Executor& ex, index_t _M, index_t _N, element_t _alpha, container_t0 _mA,
+    index_t _lda, container_t1 _mX, index_t _ldx, element_t _beta,
+    container_t2 _mY, index_t _ldy, index_t _n_rhs) {
+  switch (_n_rhs) {
+    case 1:
+      return blas::gemv::backend::_gemv_multi_rhs<trn, 1>(
+          ex, _M, _N, _alpha, _mA, _lda, _mX, _ldx, _beta, _mY, _ldy);
+    case 2:
+      return blas::gemv::backend::_gemv_multi_rhs<trn, 2>(
+          ex, _M, _N, _alpha, _mA, _lda, _mX, _ldx, _beta, _mY, _ldy);
+    case 3:
+      return blas::gemv::backend::_gemv_multi_rhs<trn, 3>(
+          ex, _M, _N, _alpha, _mA, _lda, _mX, _ldx, _beta, _mY, _ldy);
+    case 4:
+      return blas::gemv::backend::_gemv_multi_rhs<trn, 4>(
+          ex, _M, _N, _alpha, _mA, _lda, _mX, _ldx, _beta, _mY, _ldy);
+    case 5:
+      return blas::gemv::backend::_gemv_multi_rhs<trn, 5>(
+          ex, _M, _N, _alpha, _mA, _lda, _mX, _ldx, _beta, _mY, _ldy);
+    case 6:
+      return blas::gemv::backend::_gemv_multi_rhs<trn, 6>(
+          ex, _M, _N, _alpha, _mA, _lda, _mX, _ldx, _beta, _mY, _ldy);
+    case 7:
+      return blas::gemv::backend::_gemv_multi_rhs<trn, 7>(
+          ex, _M, _N, _alpha, _mA, _lda, _mX, _ldx, _beta, _mY, _ldy);
+    default:
+      return blas::gemv::backend::_gemv_multi_rhs<trn, 8>(
+          ex, _M, _N, _alpha, _mA, _lda, _mX, _ldx, _beta, _mY, _ldy);
+  }
+}
+
+/*! _gemv_multi_rhs.
+ * @brief GEMV applied to the n_rhs columns of X, see blas2_interface.h.
+ *
+ * The vectors are computed in groups of up to eight, each group reading A
+ * once.
+ */
+template <typename Executor, typename index_t, typename element_t,
+          typename container_t0, typename container_t1,
+          typename container_t2>
+typename Executor::policy_t::event_t _gemv_multi_rhs(
+    Executor& ex, char _trans, index_t _M, index_t _N, element_t _alpha,
+    container_t0 _mA, index_t _lda, container_t1 _mX, index_t _ldx,
+    element_t _beta, container_t2 _mY, index_t _ldy, index_t _n_rhs) {
+  constexpr index_t max_rhs = 8;
+  typename Executor::policy_t::event_t ret;
+  for (index_t first = 0; first < _n_rhs; first += max_rhs) {
+    const index_t n_rhs = std::min(max_rhs, _n_rhs - first);
+    ret = concatenate_vectors(
+        ret, tolower(_trans) == 'n'
+                 ? _gemv_multi_rhs_chunk<transpose_type::Normal>(
+                       ex, _M, _N, _alpha, _mA, _lda, _mX + first * _ldx, _ldx,
+                       _beta, _mY + first * _ldy, _ldy, n_rhs)
+                 : _gemv_multi_rhs_chunk<transpose_type::Transposed>(
+                       ex, _M, _N, _alpha, _mA, _lda, _mX + first * _ldx, _ldx,
+                       _beta, _mY + first * _ldy, _ldy, n_rhs));
+  }
+  return ret;
+}
+
+/*! _gemv_batched.
+ * @brief Batched GEMV, see blas2_interface.h for the layouts of the batch.
+ */
+template <typename Executor, typename index_t, typename element_t,
+          typename container_t0, typename container_t1, typename increment_t,
+          typename container_t2>
+typename Executor::policy_t::event_t _gemv_batched(
+    Executor& ex, char _trans, index_t _M, index_t _N, element_t _alpha,
+    container_t0 _mA, index_t _lda, container_t1 _vx, increment_t _incx,
+    element_t _beta, container_t2 _vy, increment_t _incy, index_t batch_size,
+    gemm_batch_type_t batch_type) {
+  constexpr int strided = static_cast<int>(gemm_batch_type_t::strided);
+  constexpr int interleaved = static_cast<int>(gemm_batch_type_t::interleaved);
+  if (tolower(_trans) == 'n') {
+    return batch_type == gemm_batch_type_t::interleaved
+               ? _gemv_batched_impl<transpose_type::Normal, interleaved>(
+                     ex, _M, _N, _alpha, _mA, _lda, _vx, _incx, _beta, _vy,
+                     _incy, batch_size)
+               : _gemv_batched_impl<transpose_type::Normal, strided>(
+                     ex, _M, _N, _alpha, _mA, _lda, _vx, _incx, _beta, _vy,
+                     _incy, batch_size);
+  }
+  return batch_type == gemm_batch_type_t::interleaved
+             ? _gemv_batched_impl<transpose_type::Transposed, interleaved>(
+                   ex, _M, _N, _alpha, _mA, _lda, _vx, _incx, _beta, _vy,
+                   _incy, batch_size)
+             : _gemv_batched_impl<transpose_type::Transposed, strided>(
+                   ex, _M, _N, _alpha, _mA, _lda, _vx, _incx, _beta, _vy,
+                   _incy, batch_size);
+}
+
 template <typename Executor, typename index_t, typename container_t0,
           typename container_t1, typename increment_t>
 typename Executor::policy_t::event_t inline _trmv(
@@ -598,6 +1168,19 @@ typename Executor::policy_t::event_t inline _trmv(
              : _trmv_impl<transpose_type::Transposed>(ex, _Uplo, _Diag, _N, _mA,
                                                       _lda, _vx, _incx);
 }
+template <typename Executor, typename index_t, typename container_t0,
+          typename container_t1, typename increment_t>
+typename Executor::policy_t::event_t inline _trsv(
+    Executor& ex, char _Uplo, char _trans, char _Diag, index_t _N,
+    container_t0 _mA, index_t _lda, container_t1 _vx, increment_t _incx) {
+  // Diagonal blocks of 32 x 32 elements, updates by work groups of 128 work
+  // items
+  return tolower(_trans) == 'n'
+             ? _trsv_impl<32, 128, transpose_type::Normal>(
+                   ex, _Uplo, _Diag, _N, _mA, _lda, _vx, _incx)
+             : _trsv_impl<32, 128, transpose_type::Transposed>(
+                   ex, _Uplo, _Diag, _N, _mA, _lda, _vx, _incx);
+}
 template <typename Executor, typename index_t, typename element_t,
           typename container_t0, typename container_t1, typename increment_t,
           typename container_t2>
@@ -605,10 +1188,9 @@ typename Executor::policy_t::event_t inline _symv(
     Executor& ex, char _Uplo, index_t _N, element_t _alpha, container_t0 _mA,
     index_t _lda, container_t1 _vx, increment_t _incx, element_t _beta,
     container_t2 _vy, increment_t _incy) {
-  // TODO: Here we can use some heuristics to select localn global, local, and
-  // scratch size per device
-  return _symv_impl(ex, _Uplo, _N, _alpha, _mA, _lda, _vx, _incx, _beta, _vy,
-                    _incy);
+  // Tiles of 32 x 32 elements, computed by work groups of 64 work items
+  return _symv_impl<32>(ex, _Uplo, _N, _alpha, _mA, _lda, _vx, _incx, _beta,
+                        _vy, _incy);
 }
 template <typename Executor, typename index_t, typename element_t,
           typename container_t0, typename increment_t, typename container_t1,
@@ -641,6 +1223,75 @@ typename Executor::policy_t::event_t inline _syr2(
   // scratch size per device
   return _syr2_impl(ex, _Uplo, _N, _alpha, _vx, _incx, _vy, _incy, _mA, _lda);
 }
+template <typename Executor, typename index_t, typename element_t,
+          typename container_t0, typename container_t1, typename increment_t,
+          typename container_t2>
+typename Executor::policy_t::event_t inline _gbmv(
+    Executor& ex, char _trans, index_t _M, index_t _N, index_t _KL, index_t _KU,
+    element_t _alpha, container_t0 _mA, index_t _lda, container_t1 _vx,
+    increment_t _incx, element_t _beta, container_t2 _vy, increment_t _incy) {
+  return tolower(_trans) == 'n'
+             ? _gbmv_impl<transpose_type::Normal>(ex, _M, _N, _KL, _KU, _alpha,
+                                                  _mA, _lda, _vx, _incx, _beta,
+                                                  _vy, _incy)
+             : _gbmv_impl<transpose_type::Transposed>(
+                   ex, _M, _N, _KL, _KU, _alpha, _mA, _lda, _vx, _incx, _beta,
+                   _vy, _incy);
+}
+template <typename Executor, typename index_t, typename element_t,
+          typename container_t0, typename container_t1, typename increment_t,
+          typename container_t2>
+typename Executor::policy_t::event_t inline _sbmv(
+    Executor& ex, char _Uplo, index_t _N, index_t _K, element_t _alpha,
+    container_t0 _mA, index_t _lda, container_t1 _vx, increment_t _incx,
+    element_t _beta, container_t2 _vy, increment_t _incy) {
+  return _sbmv_impl(ex, _Uplo, _N, _K, _alpha, _mA, _lda, _vx, _incx, _beta,
+                    _vy, _incy);
+}
+template <typename Executor, typename index_t, typename element_t,
+          typename container_t0, typename container_t1, typename increment_t,
+          typename container_t2>
+typename Executor::policy_t::event_t inline _spmv(
+    Executor& ex, char _Uplo, index_t _N, element_t _alpha, container_t0 _mAP,
+    container_t1 _vx, increment_t _incx, element_t _beta, container_t2 _vy,
+    increment_t _incy) {
+  return _spmv_impl(ex, _Uplo, _N, _alpha, _mAP, _vx, _incx, _beta, _vy,
+                    _incy);
+}
+template <typename Executor, typename index_t, typename container_t0,
+          typename container_t1, typename increment_t>
+typename Executor::policy_t::event_t inline _tbmv(
+    Executor& ex, char _Uplo, char _trans, char _Diag, index_t _N, index_t _K,
+    container_t0 _mA, index_t _lda, container_t1 _vx, increment_t _incx) {
+  return tolower(_trans) == 'n'
+             ? _tbmv_impl<transpose_type::Normal>(ex, _Uplo, _Diag, _N, _K,
+                                                  _mA, _lda, _vx, _incx)
+             : _tbmv_impl<transpose_type::Transposed>(ex, _Uplo, _Diag, _N, _K,
+                                                      _mA, _lda, _vx, _incx);
+}
+template <typename Executor, typename index_t, typename container_t0,
+          typename container_t1, typename increment_t>
+typename Executor::policy_t::event_t inline _tpmv(
+    Executor& ex, char _Uplo, char _trans, char _Diag, index_t _N,
+    container_t0 _mAP, container_t1 _vx, increment_t _incx) {
+  return tolower(_trans) == 'n'
+             ? _tpmv_impl<transpose_type::Normal>(ex, _Uplo, _Diag, _N, _mAP,
+                                                  _vx, _incx)
+             : _tpmv_impl<transpose_type::Transposed>(ex, _Uplo, _Diag, _N,
+                                                      _mAP, _vx, _incx);
+}
+template <typename Executor, typename index_t, typename container_t0,
+          typename container_t1, typename increment_t>
+typename Executor::policy_t::event_t inline _tbsv(
+    Executor& ex, char _Uplo, char _trans, char _Diag, index_t _N, index_t _K,
+    container_t0 _mA, index_t _lda, container_t1 _vx, increment_t _incx) {
+  // A single work group of 64 work items
+  return tolower(_trans) == 'n'
+             ? _tbsv_impl<64, transpose_type::Normal>(ex, _Uplo, _Diag, _N, _K,
+                                                      _mA, _lda, _vx, _incx)
+             : _tbsv_impl<64, transpose_type::Transposed>(
+                   ex, _Uplo, _Diag, _N, _K, _mA, _lda, _vx, _incx);
+}
 
 }  // namespace internal
 }  // namespace blas
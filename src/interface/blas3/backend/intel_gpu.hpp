@@ -29,6 +29,60 @@
 namespace blas {
 namespace gemm {
 namespace backend {
+static constexpr int num_gemm_candidates = 3;
+
+/*!
+ * @brief Launches one of the general purpose (strided, not tall and skinny)
+ * configurations of the backend. _gemm picks the candidate with a heuristic on
+ * the problem size, the runtime selection of _gemm_backend by timing them.
+ */
+template <bool _t_a, bool _t_b, bool is_beta_zero, typename executor_t,
+          typename container_0_t, typename container_1_t,
+          typename container_2_t, typename element_t, typename index_t>
+typename executor_t::policy_t::event_t _gemm_candidate(
+    int candidate, executor_t& ex, index_t _M, index_t _N, index_t _K,
+    element_t _alpha, container_0_t _a, index_t _lda, container_1_t _b,
+    index_t _ldb, element_t _beta, container_2_t _c, index_t _ldc,
+    index_t batch_size) {
+  if (candidate == 0) {
+    return blas::Gemm_Launcher<
+        64, true, false, false, 64, Tile<4, 4, 8, 8>, _t_a, _t_b,
+        static_cast<int>(gemm_memory_t::local),
+        static_cast<int>(gemm_algorithm_t::standard),
+        static_cast<int>(gemm_vectorization_t::full), is_beta_zero, 4,
+        static_cast<int>(
+            gemm_batch_type_t::strided)>::template _select_gemm(ex, _M, _N, _K,
+                                                                _alpha, _a,
+                                                                _lda, _b, _ldb,
+                                                                _beta, _c, _ldc,
+                                                                batch_size);
+  } else if (candidate == 1) {
+    return blas::Gemm_Launcher<
+        64, false, false, false, 64, Tile<8, 8, 8, 8>, _t_a, _t_b,
+        static_cast<int>(gemm_memory_t::no_local),
+        static_cast<int>(gemm_algorithm_t::standard),
+        static_cast<int>(gemm_vectorization_t::partial), is_beta_zero, 4,
+        static_cast<int>(
+            gemm_batch_type_t::strided)>::template _select_gemm(ex, _M, _N, _K,
+                                                                _alpha, _a,
+                                                                _lda, _b, _ldb,
+                                                                _beta, _c, _ldc,
+                                                                batch_size);
+  } else {
+    return blas::Gemm_Launcher<
+        64, false, false, false, 64, Tile<8, 8, 8, 8>, _t_a, _t_b,
+        static_cast<int>(gemm_memory_t::local),
+        static_cast<int>(gemm_algorithm_t::standard),
+        static_cast<int>(gemm_vectorization_t::full), is_beta_zero, 4,
+        static_cast<int>(
+            gemm_batch_type_t::strided)>::template _select_gemm(ex, _M, _N, _K,
+                                                                _alpha, _a,
+                                                                _lda, _b, _ldb,
+                                                                _beta, _c, _ldc,
+                                                                batch_size);
+  }
+}
+
 template <bool _t_a, bool _t_b, bool is_beta_zero, typename executor_t,
           typename container_0_t, typename container_1_t,
           typename container_2_t, typename element_t, typename index_t>
@@ -188,43 +242,12 @@ typename executor_t::policy_t::event_t _gemm(
     }
   }
 #endif
-  if (_M <= 128 && _N <= 128) {
-    return blas::Gemm_Launcher<
-        64, true, false, false, 64, Tile<4, 4, 8, 8>, _t_a, _t_b,
-        static_cast<int>(gemm_memory_t::local),
-        static_cast<int>(gemm_algorithm_t::standard),
-        static_cast<int>(gemm_vectorization_t::full), is_beta_zero, 4,
-        static_cast<int>(
-            gemm_batch_type_t::strided)>::template _select_gemm(ex, _M, _N, _K,
-                                                                _alpha, _a,
-                                                                _lda, _b, _ldb,
-                                                                _beta, _c, _ldc,
-                                                                batch_size);
-  } else if (_t_b && !_t_a) {
-    return blas::Gemm_Launcher<
-        64, false, false, false, 64, Tile<8, 8, 8, 8>, _t_a, _t_b,
-        static_cast<int>(gemm_memory_t::no_local),
-        static_cast<int>(gemm_algorithm_t::standard),
-        static_cast<int>(gemm_vectorization_t::partial), is_beta_zero, 4,
-        static_cast<int>(
-            gemm_batch_type_t::strided)>::template _select_gemm(ex, _M, _N, _K,
-                                                                _alpha, _a,
-                                                                _lda, _b, _ldb,
-                                                                _beta, _c, _ldc,
-                                                                batch_size);
-  } else {
-    return blas::Gemm_Launcher<
-        64, false, false, false, 64, Tile<8, 8, 8, 8>, _t_a, _t_b,
-        static_cast<int>(gemm_memory_t::local),
-        static_cast<int>(gemm_algorithm_t::standard),
-        static_cast<int>(gemm_vectorization_t::full), is_beta_zero, 4,
-        static_cast<int>(
-            gemm_batch_type_t::strided)>::template _select_gemm(ex, _M, _N, _K,
-                                                                _alpha, _a,
-                                                                _lda, _b, _ldb,
-                                                                _beta, _c, _ldc,
-                                                                batch_size);
-  }
+  const int candidate = (_M <= 128 && _N <= 128) ? 0
+                        : (_t_b && !_t_a)          ? 1
+                                                   : 2;
+  return _gemm_candidate<_t_a, _t_b, is_beta_zero>(
+      candidate, ex, _M, _N, _K, _alpha, _a, _lda, _b, _ldb, _beta, _c, _ldc,
+      batch_size);
 }
 }  // namespace backend
 }  // namespace gemm
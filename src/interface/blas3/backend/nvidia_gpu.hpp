@@ -30,30 +30,22 @@ namespace blas {
 namespace gemm {
 namespace backend {
 
+static constexpr int num_gemm_candidates = 2;
+
+/*!
+ * @brief Launches one of the general purpose (strided, not tall and skinny)
+ * configurations of the backend. _gemm picks the candidate with a heuristic on
+ * the problem size, the runtime selection of _gemm_backend by timing them.
+ */
 template <bool _t_a, bool _t_b, bool is_beta_zero, typename executor_t,
           typename container_0_t, typename container_1_t,
           typename container_2_t, typename element_t, typename index_t>
-typename executor_t::policy_t::event_t _gemm(
-    executor_t& ex, index_t _M, index_t _N, index_t _K, element_t _alpha,
-    container_0_t _a, index_t _lda, container_1_t _b, index_t _ldb,
-    element_t _beta, container_2_t _c, index_t _ldc, index_t batch_size,
-    gemm_batch_type_t batch_type) {
-  if (batch_type == gemm_batch_type_t::interleaved) {
-    return blas::Gemm_Launcher<
-        64, false, false, false, 64, Tile<2, 2, 4, 4, 1, 1, 1, 1, 4, 4>, _t_a,
-        _t_b, static_cast<int>(gemm_memory_t::no_local),
-        static_cast<int>(gemm_algorithm_t::standard),
-        static_cast<int>(gemm_vectorization_t::full), is_beta_zero, 4,
-        static_cast<int>(
-            gemm_batch_type_t::interleaved)>::template _select_gemm(ex, _M, _N,
-                                                                    _K, _alpha,
-                                                                    _a, _lda,
-                                                                    _b, _ldb,
-                                                                    _beta, _c,
-                                                                    _ldc,
-                                                                    batch_size);
-  }
-  if (_M < 512 && _N < 512 && _K < 512) {
+typename executor_t::policy_t::event_t _gemm_candidate(
+    int candidate, executor_t& ex, index_t _M, index_t _N, index_t _K,
+    element_t _alpha, container_0_t _a, index_t _lda, container_1_t _b,
+    index_t _ldb, element_t _beta, container_2_t _c, index_t _ldc,
+    index_t batch_size) {
+  if (candidate == 0) {
     return blas::Gemm_Launcher<
         128, false, false, true, 128, Tile<2, 2, 8, 8>, _t_a, _t_b,
         static_cast<int>(gemm_memory_t::local),
@@ -79,6 +71,35 @@ typename executor_t::policy_t::event_t _gemm(
                                                                 batch_size);
   }
 }
+
+template <bool _t_a, bool _t_b, bool is_beta_zero, typename executor_t,
+          typename container_0_t, typename container_1_t,
+          typename container_2_t, typename element_t, typename index_t>
+typename executor_t::policy_t::event_t _gemm(
+    executor_t& ex, index_t _M, index_t _N, index_t _K, element_t _alpha,
+    container_0_t _a, index_t _lda, container_1_t _b, index_t _ldb,
+    element_t _beta, container_2_t _c, index_t _ldc, index_t batch_size,
+    gemm_batch_type_t batch_type) {
+  if (batch_type == gemm_batch_type_t::interleaved) {
+    return blas::Gemm_Launcher<
+        64, false, false, false, 64, Tile<2, 2, 4, 4, 1, 1, 1, 1, 4, 4>, _t_a,
+        _t_b, static_cast<int>(gemm_memory_t::no_local),
+        static_cast<int>(gemm_algorithm_t::standard),
+        static_cast<int>(gemm_vectorization_t::full), is_beta_zero, 4,
+        static_cast<int>(
+            gemm_batch_type_t::interleaved)>::template _select_gemm(ex, _M, _N,
+                                                                    _K, _alpha,
+                                                                    _a, _lda,
+                                                                    _b, _ldb,
+                                                                    _beta, _c,
+                                                                    _ldc,
+                                                                    batch_size);
+  }
+  const int candidate = (_M < 512 && _N < 512 && _K < 512) ? 0 : 1;
+  return _gemm_candidate<_t_a, _t_b, is_beta_zero>(
+      candidate, ex, _M, _N, _K, _alpha, _a, _lda, _b, _ldb, _beta, _c, _ldc,
+      batch_size);
+}
 }  // namespace backend
 }  // namespace gemm
 }  // namespace blas
@@ -421,6 +421,22 @@ typename executor_t::policy_t::event_t _gemm(
   }
 #endif
 }
+
+// The configurations of this backend are picked per problem size by _gemm, so
+// the runtime selection of _gemm_backend has no alternative to time
+static constexpr int num_gemm_candidates = 1;
+
+template <bool _t_a, bool _t_b, bool is_beta_zero, typename executor_t,
+          typename container_0_t, typename container_1_t,
+          typename container_2_t, typename element_t, typename index_t>
+typename executor_t::policy_t::event_t _gemm_candidate(
+    int, executor_t& ex, index_t _M, index_t _N, index_t _K, element_t _alpha,
+    container_0_t _a, index_t _lda, container_1_t _b, index_t _ldb,
+    element_t _beta, container_2_t _c, index_t _ldc, index_t batch_size) {
+  return _gemm<_t_a, _t_b, is_beta_zero>(ex, _M, _N, _K, _alpha, _a, _lda, _b,
+                                         _ldb, _beta, _c, _ldc, batch_size,
+                                         gemm_batch_type_t::strided);
+}
 }  // namespace backend
 }  // namespace gemm
 }  // namespace blas
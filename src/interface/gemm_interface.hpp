@@ -29,12 +29,18 @@
 #include "interface/blas1_interface.h"
 #include "interface/blas3/backend/backend.hpp"
 #include "interface/blas3_interface.h"
+#include "operations/blas1_trees.h"
 #include "operations/blas3_trees.h"
 #include "policy/sycl_policy_handler.h"
+#ifdef SYCL_BLAS_GEMM_TUNED_TABLE
+#include "gemm_tuned_table.hpp"
+#endif
 
 #include <algorithm>
 #include <cctype>
+#include <chrono>
 #include <cmath>
+#include <memory>
 #include <stdexcept>
 #include <vector>
 
@@ -48,6 +54,109 @@ namespace blas {
  */
 namespace internal {
 
+/*!
+ * @brief Times each GEMM configuration of the backend on the problem and
+ * returns the fastest one. restore_c is called before each run, to give C
+ * back the value it had before the first one.
+ */
+template <bool _t_a, bool _t_b, bool is_beta_zero, typename executor_t,
+          typename container_0_t, typename container_1_t,
+          typename container_2_t, typename element_t, typename index_t,
+          typename restore_c_t>
+int _gemm_fastest_candidate(executor_t& ex, index_t _M, index_t _N,
+                            index_t _K, element_t _alpha, container_0_t a_,
+                            index_t _lda, container_1_t b_, index_t _ldb,
+                            element_t _beta, container_2_t _C, index_t _ldc,
+                            index_t batch_size, restore_c_t restore_c) {
+  using blas::gemm::backend::_gemm_candidate;
+  int best_candidate = 0;
+  auto best_time = std::chrono::steady_clock::duration::max();
+  for (int candidate = 0; candidate < blas::gemm::backend::num_gemm_candidates;
+       ++candidate) {
+    // The first run includes the compilation of the kernel, so it is not timed
+    for (int run = 0; run < 2; ++run) {
+      restore_c();
+      const auto start = std::chrono::steady_clock::now();
+      ex.get_policy_handler().wait(_gemm_candidate<_t_a, _t_b, is_beta_zero>(
+          candidate, ex, _M, _N, _K, _alpha, a_, _lda, b_, _ldb, _beta, _C,
+          _ldc, batch_size));
+      const auto time = std::chrono::steady_clock::now() - start;
+      if (run == 1 && time < best_time) {
+        best_time = time;
+        best_candidate = candidate;
+      }
+    }
+  }
+  return best_candidate;
+}
+
+/*!
+ * @brief Launches the GEMM configuration of the backend selected at runtime
+ * for the shape of the problem. The first time a shape is seen, each candidate
+ * of the backend is timed on the problem and the fastest one is recorded in
+ * the GemmSelectionCache of the policy handler.
+ *
+ * Since the candidates overwrite C, C is saved to a scratch buffer before
+ * timing them and restored before each run, so that the result is the one of
+ * a single GEMM. When beta is zero, C is not read and needs no backup.
+ * C must not be empty (_M, _N and batch_size greater than zero).
+ */
+template <bool _t_a, bool _t_b, bool is_beta_zero, typename executor_t,
+          typename container_0_t, typename container_1_t,
+          typename container_2_t, typename element_t, typename index_t>
+typename executor_t::policy_t::event_t _gemm_runtime_selection(
+    executor_t& ex, index_t _M, index_t _N, index_t _K, element_t _alpha,
+    container_0_t a_, index_t _lda, container_1_t b_, index_t _ldb,
+    element_t _beta, container_2_t _C, index_t _ldc, index_t batch_size) {
+  using blas::gemm::backend::_gemm_candidate;
+  auto& cache = ex.get_policy_handler().get_gemm_selection_cache();
+  const gemm_selection_key_t key{_M,
+                                 _N,
+                                 _K,
+                                 _lda,
+                                 _ldb,
+                                 _ldc,
+                                 batch_size,
+                                 _t_a,
+                                 _t_b,
+                                 is_beta_zero,
+                                 static_cast<int>(sizeof(element_t))};
+  const int cached = cache.find(key);
+  if (cached >= 0) {
+    return _gemm_candidate<_t_a, _t_b, is_beta_zero>(
+        cached, ex, _M, _N, _K, _alpha, a_, _lda, b_, _ldb, _beta, _C, _ldc,
+        batch_size);
+  }
+
+  int best_candidate;
+  if (is_beta_zero) {
+    best_candidate = _gemm_fastest_candidate<_t_a, _t_b, is_beta_zero>(
+        ex, _M, _N, _K, _alpha, a_, _lda, b_, _ldb, _beta, _C, _ldc,
+        batch_size, [] {});
+  } else {
+    // The last column of the last matrix of the batch may stop before _ldc
+    const index_t c_size = _ldc * _N * batch_size - _ldc + _M;
+    auto c_backup =
+        ex.get_policy_handler().template acquire_workspace<element_t>(c_size);
+    ex.get_policy_handler().wait(
+        ::blas::_copy(ex, c_size, _C, index_t{1}, c_backup, index_t{1}));
+    auto restore_c = [&]() {
+      ex.get_policy_handler().wait(
+          ::blas::_copy(ex, c_size, c_backup, index_t{1}, _C, index_t{1}));
+    };
+    best_candidate = _gemm_fastest_candidate<_t_a, _t_b, is_beta_zero>(
+        ex, _M, _N, _K, _alpha, a_, _lda, b_, _ldb, _beta, _C, _ldc,
+        batch_size, restore_c);
+    restore_c();
+    ex.get_policy_handler().release_workspace(c_backup);
+  }
+  cache.insert(key, best_candidate);
+
+  return _gemm_candidate<_t_a, _t_b, is_beta_zero>(
+      best_candidate, ex, _M, _N, _K, _alpha, a_, _lda, b_, _ldb, _beta, _C,
+      _ldc, batch_size);
+}
+
 template <bool _t_a, bool _t_b, bool is_beta_zero, typename executor_t,
           typename container_0_t, typename container_1_t,
           typename container_2_t, typename element_t, typename index_t>
@@ -56,6 +165,26 @@ typename executor_t::policy_t::event_t _gemm_platform_specific(
     container_0_t a_, index_t _lda, container_1_t b_, index_t _ldb,
     element_t _beta, container_2_t _C, index_t _ldc, index_t batch_size,
     gemm_batch_type_t batch_type) {
+#ifdef SYCL_BLAS_GEMM_TUNED_TABLE
+  // Problems covered by the auto-tuner results use the configuration tuned
+  // for their size, the others fall back to the backend defaults
+  auto tuned_events =
+      blas::gemm::backend::TunedGemm<_t_a, _t_b, is_beta_zero, element_t>::
+          _gemm(ex, _M, _N, _K, _alpha, a_, _lda, b_, _ldb, _beta, _C, _ldc,
+                batch_size, batch_type);
+  if (!tuned_events.empty()) {
+    return tuned_events;
+  }
+#endif
+  // An empty C leaves nothing to time the candidates on
+  if (blas::gemm::backend::num_gemm_candidates > 1 &&
+      batch_type == gemm_batch_type_t::strided && _M > 0 && _N > 0 &&
+      batch_size > 0 &&
+      ex.get_policy_handler().get_gemm_selection_cache().is_enabled()) {
+    return _gemm_runtime_selection<_t_a, _t_b, is_beta_zero>(
+        ex, _M, _N, _K, _alpha, a_, _lda, b_, _ldb, _beta, _C, _ldc,
+        batch_size);
+  }
   return blas::gemm::backend::_gemm<_t_a, _t_b, is_beta_zero>(
       ex, _M, _N, _K, _alpha, a_, _lda, b_, _ldb, _beta, _C, _ldc, batch_size,
       batch_type);
@@ -133,6 +262,167 @@ typename executor_t::policy_t::event_t _gemm_backend(
   }
 }
 
+/*!
+ * @brief GEMM with alpha and beta stored in device memory.
+ *
+ * The product of A and B is computed by the backend GEMM into a scratch
+ * matrix, and the scalars are applied by a second kernel that reads them from
+ * the device, so no copy to the host is needed. Since beta is not known on the
+ * host, C is always read, but its values are ignored when beta is zero.
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename element_t, typename index_t>
+typename executor_t::policy_t::event_t _gemm(
+    executor_t& ex, char _TransA, char _TransB, index_t _M, index_t _N,
+    index_t _K, BufferIterator<element_t, typename executor_t::policy_t> _alpha,
+    container_0_t a_, index_t _lda, container_1_t b_, index_t _ldb,
+    BufferIterator<element_t, typename executor_t::policy_t> _beta,
+    container_2_t _C, index_t _ldc) {
+  auto product_buffer =
+      ex.get_policy_handler().template acquire_workspace<element_t>(_M * _N);
+  auto gemmEvent = _gemm_backend(ex, _TransA, _TransB, _M, _N, _K,
+                                 element_t{1}, a_, _lda, b_, _ldb, element_t{0},
+                                 product_buffer, _M, index_t(1),
+                                 gemm_batch_type_t::strided);
+
+  auto mC = make_matrix_view<col_major>(ex, _C, _M, _N, _ldc);
+  auto mProduct = make_matrix_view<col_major>(ex, product_buffer, _M, _N, _M);
+  auto valpha = make_vector_view(ex, _alpha, index_t{1}, index_t{1});
+  auto vbeta = make_vector_view(ex, _beta, index_t{1}, index_t{1});
+
+  // C = beta * C + alpha * (A * B)
+  auto alpha = make_op<DeviceScalar>(valpha);
+  auto beta = make_op<DeviceScalar>(vbeta);
+  auto betaMulCOp = make_op<ScalarOp, ScalarProductOrZeroOperator>(beta, mC);
+  auto alphaMulProductOp = make_op<ScalarOp, ProductOperator>(alpha, mProduct);
+  auto addOp = make_op<BinaryOp, AddOperator>(betaMulCOp, alphaMulProductOp);
+  auto assignOp = make_op<Assign>(mC, addOp);
+  auto ret = concatenate_vectors(gemmEvent, ex.execute(assignOp));
+
+  ex.get_policy_handler().release_workspace(product_buffer);
+  return ret;
+}
+
+/*!
+ * @brief Launches a GEMM which applies the given epilogue to C before storing
+ * it. Rather than the tuned configurations of the backend, which are only
+ * instantiated without epilogue, it uses the local memory kernel of the GPU
+ * backends when the device has local memory, and the no local memory kernel
+ * of the CPU backend otherwise.
+ */
+template <bool _t_a, bool _t_b, bool is_beta_zero, typename executor_t,
+          typename container_0_t, typename container_1_t,
+          typename container_2_t, typename element_t, typename index_t,
+          typename epilogue_t>
+typename executor_t::policy_t::event_t _gemm_epilogue_impl(
+    executor_t& ex, index_t _M, index_t _N, index_t _K, element_t _alpha,
+    container_0_t a_, index_t _lda, container_1_t b_, index_t _ldb,
+    element_t _beta, container_2_t _C, index_t _ldc, epilogue_t epilogue) {
+  auto buffer_a = make_matrix_view<col_major>(ex, a_, _M, _K, _lda);
+  auto buffer_b = make_matrix_view<col_major>(ex, b_, _K, _N, _ldb);
+  auto buffer_c = make_matrix_view<col_major>(ex, _C, _M, _N, _ldc);
+  if (ex.get_policy_handler().has_local_memory()) {
+    auto gemm =
+        make_gemm<true, false, false, 64, Tile<4, 4, 8, 8>, _t_a, _t_b,
+                  static_cast<int>(gemm_memory_t::local),
+                  static_cast<int>(gemm_algorithm_t::standard),
+                  static_cast<int>(gemm_vectorization_t::full), is_beta_zero,
+                  4, static_cast<int>(gemm_batch_type_t::strided)>(
+            buffer_a, buffer_b, buffer_c, _alpha, _beta, index_t{1},
+            epilogue);
+    return ex.execute(gemm);
+  }
+  auto gemm =
+      make_gemm<false, false, false, 64, Tile<8, 8, 8, 8>, _t_a, _t_b,
+                static_cast<int>(gemm_memory_t::no_local),
+                static_cast<int>(gemm_algorithm_t::standard),
+                static_cast<int>(gemm_vectorization_t::partial), is_beta_zero,
+                1, static_cast<int>(gemm_batch_type_t::strided)>(
+          buffer_a, buffer_b, buffer_c, _alpha, _beta, index_t{1}, epilogue);
+  return ex.execute(gemm);
+}
+
+template <bool _t_a, bool _t_b, typename executor_t, typename container_0_t,
+          typename container_1_t, typename container_2_t, typename element_t,
+          typename index_t>
+typename executor_t::policy_t::event_t _gemm_mixed_precision_is_beta_zero(
+    executor_t& ex, index_t _M, index_t _N, index_t _K, element_t _alpha,
+    container_0_t a_, index_t _lda, container_1_t b_, index_t _ldb,
+    element_t _beta, container_2_t _C, index_t _ldc) {
+  return ((_beta == static_cast<element_t>(0))
+              ? _gemm_epilogue_impl<_t_a, _t_b, true>(
+                    ex, _M, _N, _K, _alpha, a_, _lda, b_, _ldb, _beta, _C, _ldc,
+                    GemmNoEpilogue())
+              : _gemm_epilogue_impl<_t_a, _t_b, false>(
+                    ex, _M, _N, _K, _alpha, a_, _lda, b_, _ldb, _beta, _C, _ldc,
+                    GemmNoEpilogue()));
+}
+
+/*!
+ * @brief GEMM whose matrices are all stored in the type of alpha and beta,
+ * which the products are accumulated in. It is run by the backend.
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename element_t, typename index_t>
+typename executor_t::policy_t::event_t _gemm_precision(
+    executor_t& ex, char _TransA, char _TransB, index_t _M, index_t _N,
+    index_t _K, element_t _alpha, container_0_t a_, index_t _lda,
+    container_1_t b_, index_t _ldb, element_t _beta, container_2_t _C,
+    index_t _ldc, std::true_type) {
+  return _gemm_backend(ex, _TransA, _TransB, _M, _N, _K, _alpha, a_, _lda, b_,
+                       _ldb, _beta, _C, _ldc, index_t(1),
+                       gemm_batch_type_t::strided);
+}
+
+/*!
+ * @brief Mixed-precision GEMM, whose products are accumulated in the type of
+ * alpha and beta while A, B or C are stored in another type, e.g. half
+ * matrices accumulated in float. The configurations of the backend only exist
+ * for a single type, so it uses the ones of _gemm_epilogue.
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename element_t, typename index_t>
+typename executor_t::policy_t::event_t _gemm_precision(
+    executor_t& ex, char _TransA, char _TransB, index_t _M, index_t _N,
+    index_t _K, element_t _alpha, container_0_t a_, index_t _lda,
+    container_1_t b_, index_t _ldb, element_t _beta, container_2_t _C,
+    index_t _ldc, std::false_type) {
+  if (_alpha == element_t{0}) {
+    // When alpha = 0, GEMM is equivalent to C = beta * C. C may be stored in
+    // a narrower type than beta, so it is scaled by an expression rather than
+    // by _scal, which is only instantiated for a single type.
+    auto mC = make_matrix_view<col_major>(ex, _C, _M, _N, _ldc);
+    auto scalOp = make_op<ScalarOp, ProductOperator>(_beta, mC);
+    auto assignOp = make_op<Assign>(mC, scalOp);
+    return ex.execute(assignOp);
+  }
+  // The kernels store beta / alpha, and scale the result by alpha
+  _TransA = tolower(_TransA);
+  _TransB = tolower(_TransB);
+
+  if (_TransA != 'n' && _TransA != 't' && _TransA != 'c') {
+    throw std::invalid_argument("invalid _TransA");
+  } else if (_TransB != 'n' && _TransB != 't' && _TransB != 'c') {
+    throw std::invalid_argument("invalid _TransB");
+  }
+
+  bool _TrA = _TransA != 'n';
+  bool _TrB = _TransB != 'n';
+  if (_TrA && _TrB) {
+    return _gemm_mixed_precision_is_beta_zero<true, true>(
+        ex, _M, _N, _K, _alpha, a_, _lda, b_, _ldb, _beta, _C, _ldc);
+  } else if (!_TrA && _TrB) {
+    return _gemm_mixed_precision_is_beta_zero<false, true>(
+        ex, _M, _N, _K, _alpha, a_, _lda, b_, _ldb, _beta, _C, _ldc);
+  } else if (_TrA && !_TrB) {
+    return _gemm_mixed_precision_is_beta_zero<true, false>(
+        ex, _M, _N, _K, _alpha, a_, _lda, b_, _ldb, _beta, _C, _ldc);
+  } else {
+    return _gemm_mixed_precision_is_beta_zero<false, false>(
+        ex, _M, _N, _K, _alpha, a_, _lda, b_, _ldb, _beta, _C, _ldc);
+  }
+}
+
 template <typename executor_t, typename container_0_t, typename container_1_t,
           typename container_2_t, typename element_t, typename index_t>
 typename executor_t::policy_t::event_t _gemm(executor_t& ex, char _TransA,
@@ -142,9 +432,208 @@ typename executor_t::policy_t::event_t _gemm(executor_t& ex, char _TransA,
                                              index_t _lda, container_1_t b_,
                                              index_t _ldb, element_t _beta,
                                              container_2_t _C, index_t _ldc) {
-  return _gemm_backend(ex, _TransA, _TransB, _M, _N, _K, _alpha, a_, _lda, b_,
-                       _ldb, _beta, _C, _ldc, index_t(1),
-                       gemm_batch_type_t::strided);
+  using is_same_precision = std::integral_constant<
+      bool,
+      std::is_same<typename ValueType<container_0_t>::type, element_t>::value &&
+          std::is_same<typename ValueType<container_1_t>::type,
+                       element_t>::value &&
+          std::is_same<typename ValueType<container_2_t>::type,
+                       element_t>::value>;
+  return _gemm_precision(ex, _TransA, _TransB, _M, _N, _K, _alpha, a_, _lda,
+                         b_, _ldb, _beta, _C, _ldc, is_same_precision{});
+}
+
+template <bool _t_a, bool _t_b, bool is_beta_zero, typename executor_t,
+          typename container_0_t, typename container_1_t,
+          typename container_2_t, typename vector_t, typename matrix_t,
+          typename element_t, typename index_t>
+typename executor_t::policy_t::event_t _gemm_epilogue_activation(
+    executor_t& ex, index_t _M, index_t _N, index_t _K, element_t _alpha,
+    container_0_t a_, index_t _lda, container_1_t b_, index_t _ldb,
+    element_t _beta, container_2_t _C, index_t _ldc, gemm_bias_t _bias_type,
+    vector_t bias, element_t _residual_scale, matrix_t residual,
+    gemm_activation_t _activation, element_t _lower, element_t _upper) {
+  switch (_activation) {
+    case gemm_activation_t::relu:
+      return _gemm_epilogue_impl<_t_a, _t_b, is_beta_zero>(
+          ex, _M, _N, _K, _alpha, a_, _lda, b_, _ldb, _beta, _C, _ldc,
+          make_gemm_epilogue<gemm_activation_t::relu>(
+              bias, residual, _bias_type, _residual_scale, _lower, _upper));
+    case gemm_activation_t::clamp:
+      return _gemm_epilogue_impl<_t_a, _t_b, is_beta_zero>(
+          ex, _M, _N, _K, _alpha, a_, _lda, b_, _ldb, _beta, _C, _ldc,
+          make_gemm_epilogue<gemm_activation_t::clamp>(
+              bias, residual, _bias_type, _residual_scale, _lower, _upper));
+    case gemm_activation_t::gelu:
+      return _gemm_epilogue_impl<_t_a, _t_b, is_beta_zero>(
+          ex, _M, _N, _K, _alpha, a_, _lda, b_, _ldb, _beta, _C, _ldc,
+          make_gemm_epilogue<gemm_activation_t::gelu>(
+              bias, residual, _bias_type, _residual_scale, _lower, _upper));
+    default:
+      return _gemm_epilogue_impl<_t_a, _t_b, is_beta_zero>(
+          ex, _M, _N, _K, _alpha, a_, _lda, b_, _ldb, _beta, _C, _ldc,
+          make_gemm_epilogue<gemm_activation_t::none>(
+              bias, residual, _bias_type, _residual_scale, _lower, _upper));
+  }
+}
+
+template <bool _t_a, bool _t_b, typename executor_t, typename container_0_t,
+          typename container_1_t, typename container_2_t, typename vector_t,
+          typename matrix_t, typename element_t, typename index_t>
+typename executor_t::policy_t::event_t _gemm_epilogue_is_beta_zero(
+    executor_t& ex, index_t _M, index_t _N, index_t _K, element_t _alpha,
+    container_0_t a_, index_t _lda, container_1_t b_, index_t _ldb,
+    element_t _beta, container_2_t _C, index_t _ldc, gemm_bias_t _bias_type,
+    vector_t bias, element_t _residual_scale, matrix_t residual,
+    gemm_activation_t _activation, element_t _lower, element_t _upper) {
+  return ((_beta == static_cast<element_t>(0))
+              ? _gemm_epilogue_activation<_t_a, _t_b, true>(
+                    ex, _M, _N, _K, _alpha, a_, _lda, b_, _ldb, _beta, _C, _ldc,
+                    _bias_type, bias, _residual_scale, residual, _activation,
+                    _lower, _upper)
+              : _gemm_epilogue_activation<_t_a, _t_b, false>(
+                    ex, _M, _N, _K, _alpha, a_, _lda, b_, _ldb, _beta, _C, _ldc,
+                    _bias_type, bias, _residual_scale, residual, _activation,
+                    _lower, _upper));
+}
+
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename container_3_t,
+          typename container_4_t, typename element_t, typename index_t>
+typename executor_t::policy_t::event_t _gemm_epilogue(
+    executor_t& ex, char _TransA, char _TransB, index_t _M, index_t _N,
+    index_t _K, element_t _alpha, container_0_t a_, index_t _lda,
+    container_1_t b_, index_t _ldb, element_t _beta, container_2_t _C,
+    index_t _ldc, gemm_bias_t _bias_type, container_3_t _bias,
+    element_t _residual_scale, container_4_t _residual, index_t _ldr,
+    gemm_activation_t _activation, element_t _lower, element_t _upper) {
+  // The kernels store beta / alpha, and scale the result by alpha. When
+  // alpha = 0, C = beta * C before the epilogue, which is the product of an
+  // empty K with alpha = 1, so A and B are not read.
+  if (_alpha == element_t{0}) {
+    _K = index_t{0};
+    _alpha = element_t{1};
+  }
+  _TransA = tolower(_TransA);
+  _TransB = tolower(_TransB);
+
+  if (_TransA != 'n' && _TransA != 't' && _TransA != 'c') {
+    throw std::invalid_argument("invalid _TransA");
+  } else if (_TransB != 'n' && _TransB != 't' && _TransB != 'c') {
+    throw std::invalid_argument("invalid _TransB");
+  }
+
+  const index_t bias_size = _bias_type == gemm_bias_t::row
+                                ? _M
+                                : (_bias_type == gemm_bias_t::column ? _N : 1);
+  auto bias = make_vector_view(ex, _bias, index_t{1}, bias_size);
+  auto residual = make_matrix_view<col_major>(ex, _residual, _M, _N, _ldr);
+
+  bool _TrA = _TransA != 'n';
+  bool _TrB = _TransB != 'n';
+  if (_TrA && _TrB) {
+    return _gemm_epilogue_is_beta_zero<true, true>(
+        ex, _M, _N, _K, _alpha, a_, _lda, b_, _ldb, _beta, _C, _ldc,
+        _bias_type, bias, _residual_scale, residual, _activation, _lower,
+        _upper);
+  } else if (!_TrA && _TrB) {
+    return _gemm_epilogue_is_beta_zero<false, true>(
+        ex, _M, _N, _K, _alpha, a_, _lda, b_, _ldb, _beta, _C, _ldc,
+        _bias_type, bias, _residual_scale, residual, _activation, _lower,
+        _upper);
+  } else if (_TrA && !_TrB) {
+    return _gemm_epilogue_is_beta_zero<true, false>(
+        ex, _M, _N, _K, _alpha, a_, _lda, b_, _ldb, _beta, _C, _ldc,
+        _bias_type, bias, _residual_scale, residual, _activation, _lower,
+        _upper);
+  } else {
+    return _gemm_epilogue_is_beta_zero<false, false>(
+        ex, _M, _N, _K, _alpha, a_, _lda, b_, _ldb, _beta, _C, _ldc,
+        _bias_type, bias, _residual_scale, residual, _activation, _lower,
+        _upper);
+  }
+}
+
+/*!
+ * @brief Launches the int8 GEMM into an int32 C, which stores the accumulators
+ * unchanged unless they are rescaled. The integer accumulators cannot hold
+ * beta / alpha, so the kernels always run with alpha one and beta zero.
+ */
+template <bool _t_a, bool _t_b, typename executor_t, typename container_0_t,
+          typename container_1_t, typename container_2_t, typename index_t>
+typename executor_t::policy_t::event_t _gemm_int8_output(
+    executor_t& ex, index_t _M, index_t _N, index_t _K, container_0_t a_,
+    index_t _lda, container_1_t b_, index_t _ldb, container_2_t _C,
+    index_t _ldc, float _scale, int32_t _zero_point, std::true_type) {
+  if (_scale == 1.f && _zero_point == 0) {
+    return _gemm_epilogue_impl<_t_a, _t_b, true>(
+        ex, _M, _N, _K, int32_t{1}, a_, _lda, b_, _ldb, int32_t{0}, _C, _ldc,
+        GemmNoEpilogue());
+  }
+  return _gemm_epilogue_impl<_t_a, _t_b, true>(
+      ex, _M, _N, _K, int32_t{1}, a_, _lda, b_, _ldb, int32_t{0}, _C, _ldc,
+      make_gemm_requantize<int32_t>(_scale, _zero_point));
+}
+
+/*!
+ * @brief Launches the int8 GEMM into an 8-bit C, which is always requantized.
+ */
+template <bool _t_a, bool _t_b, typename executor_t, typename container_0_t,
+          typename container_1_t, typename container_2_t, typename index_t>
+typename executor_t::policy_t::event_t _gemm_int8_output(
+    executor_t& ex, index_t _M, index_t _N, index_t _K, container_0_t a_,
+    index_t _lda, container_1_t b_, index_t _ldb, container_2_t _C,
+    index_t _ldc, float _scale, int32_t _zero_point, std::false_type) {
+  using out_value_t = typename ValueType<container_2_t>::type;
+  return _gemm_epilogue_impl<_t_a, _t_b, true>(
+      ex, _M, _N, _K, int32_t{1}, a_, _lda, b_, _ldb, int32_t{0}, _C, _ldc,
+      make_gemm_requantize<out_value_t>(_scale, _zero_point));
+}
+
+template <bool _t_a, bool _t_b, typename executor_t, typename container_0_t,
+          typename container_1_t, typename container_2_t, typename index_t>
+typename executor_t::policy_t::event_t _gemm_int8_trans(
+    executor_t& ex, index_t _M, index_t _N, index_t _K, container_0_t a_,
+    index_t _lda, container_1_t b_, index_t _ldb, container_2_t _C,
+    index_t _ldc, float _scale, int32_t _zero_point) {
+  using is_int32_output =
+      std::is_same<typename ValueType<container_2_t>::type, int32_t>;
+  return _gemm_int8_output<_t_a, _t_b>(ex, _M, _N, _K, a_, _lda, b_, _ldb, _C,
+                                       _ldc, _scale, _zero_point,
+                                       is_int32_output{});
+}
+
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename index_t>
+typename executor_t::policy_t::event_t _gemm_int8(
+    executor_t& ex, char _TransA, char _TransB, index_t _M, index_t _N,
+    index_t _K, container_0_t a_, index_t _lda, container_1_t b_,
+    index_t _ldb, container_2_t _C, index_t _ldc, float _scale,
+    int32_t _zero_point) {
+  _TransA = tolower(_TransA);
+  _TransB = tolower(_TransB);
+
+  if (_TransA != 'n' && _TransA != 't' && _TransA != 'c') {
+    throw std::invalid_argument("invalid _TransA");
+  } else if (_TransB != 'n' && _TransB != 't' && _TransB != 'c') {
+    throw std::invalid_argument("invalid _TransB");
+  }
+
+  bool _TrA = _TransA != 'n';
+  bool _TrB = _TransB != 'n';
+  if (_TrA && _TrB) {
+    return _gemm_int8_trans<true, true>(ex, _M, _N, _K, a_, _lda, b_, _ldb,
+                                        _C, _ldc, _scale, _zero_point);
+  } else if (!_TrA && _TrB) {
+    return _gemm_int8_trans<false, true>(ex, _M, _N, _K, a_, _lda, b_, _ldb,
+                                         _C, _ldc, _scale, _zero_point);
+  } else if (_TrA && !_TrB) {
+    return _gemm_int8_trans<true, false>(ex, _M, _N, _K, a_, _lda, b_, _ldb,
+                                         _C, _ldc, _scale, _zero_point);
+  } else {
+    return _gemm_int8_trans<false, false>(ex, _M, _N, _K, a_, _lda, b_, _ldb,
+                                          _C, _ldc, _scale, _zero_point);
+  }
 }
 
 template <typename executor_t, typename container_0_t, typename container_1_t,
@@ -158,6 +647,135 @@ typename executor_t::policy_t::event_t _gemm_batched(
                        _ldb, _beta, _C, _ldc, batch_size, batch_type);
 }
 
+/*!
+ * @brief Tile of C computed by each work-group of a grouped GEMM.
+ */
+using gemm_grouped_tile_t = Tile<4, 4, 8, 8>;
+
+template <bool _t_a, bool _t_b, bool is_beta_zero, typename executor_t,
+          typename container_0_t, typename container_1_t,
+          typename container_2_t, typename container_3_t, typename element_t,
+          typename index_t>
+typename executor_t::policy_t::event_t _gemm_grouped_impl(
+    executor_t& ex, index_t _group_count, index_t _num_tiles,
+    container_3_t _schedule, index_t _schedule_size, element_t _alpha,
+    container_0_t a_, container_1_t b_, element_t _beta, container_2_t _C) {
+  auto buffer_a = make_vector_view(ex, a_, index_t{1},
+                                   static_cast<index_t>(a_.get_size()));
+  auto buffer_b = make_vector_view(ex, b_, index_t{1},
+                                   static_cast<index_t>(b_.get_size()));
+  auto buffer_c = make_vector_view(ex, _C, index_t{1},
+                                   static_cast<index_t>(_C.get_size()));
+  auto schedule = make_vector_view(ex, _schedule, index_t{1}, _schedule_size);
+  auto gemm = make_gemm_grouped<gemm_grouped_tile_t, _t_a, _t_b, is_beta_zero>(
+      buffer_a, buffer_b, buffer_c, schedule, _alpha, _beta, _group_count,
+      _num_tiles);
+  return ex.execute(gemm);
+}
+
+template <bool _t_a, bool _t_b, typename executor_t, typename container_0_t,
+          typename container_1_t, typename container_2_t,
+          typename container_3_t, typename element_t, typename index_t>
+typename executor_t::policy_t::event_t _gemm_grouped_is_beta_zero(
+    executor_t& ex, index_t _group_count, index_t _num_tiles,
+    container_3_t _schedule, index_t _schedule_size, element_t _alpha,
+    container_0_t a_, container_1_t b_, element_t _beta, container_2_t _C) {
+  return (_beta == element_t{0})
+             ? _gemm_grouped_impl<_t_a, _t_b, true>(
+                   ex, _group_count, _num_tiles, _schedule, _schedule_size,
+                   _alpha, a_, b_, _beta, _C)
+             : _gemm_grouped_impl<_t_a, _t_b, false>(
+                   ex, _group_count, _num_tiles, _schedule, _schedule_size,
+                   _alpha, a_, b_, _beta, _C);
+}
+
+/*!
+ * @brief Grouped GEMM, see GemmGrouped. The schedule is built on the host and
+ * moved into a buffer which owns it, so that the call does not wait for the
+ * kernel to read it.
+ */
+template <typename executor_t, typename container_0_t, typename container_1_t,
+          typename container_2_t, typename element_t, typename index_t>
+typename executor_t::policy_t::event_t _gemm_grouped(
+    executor_t& ex, char _TransA, char _TransB, index_t _group_count,
+    const index_t* _M, const index_t* _N, const index_t* _K, element_t _alpha,
+    container_0_t a_, const index_t* _lda, const index_t* _offset_a,
+    container_1_t b_, const index_t* _ldb, const index_t* _offset_b,
+    element_t _beta, container_2_t _C, const index_t* _ldc,
+    const index_t* _offset_c) {
+  _TransA = tolower(_TransA);
+  _TransB = tolower(_TransB);
+
+  if (_TransA != 'n' && _TransA != 't' && _TransA != 'c') {
+    throw std::invalid_argument("invalid _TransA");
+  } else if (_TransB != 'n' && _TransB != 't' && _TransB != 'c') {
+    throw std::invalid_argument("invalid _TransB");
+  } else if (_group_count < 0) {
+    throw std::invalid_argument("invalid _group_count");
+  }
+
+  // The prefix sum of the tiles of the problems, then their fields
+  constexpr index_t block_rows =
+      gemm_grouped_tile_t::item_rows * gemm_grouped_tile_t::wg_rows;
+  constexpr index_t block_cols =
+      gemm_grouped_tile_t::item_cols * gemm_grouped_tile_t::wg_cols;
+  constexpr index_t num_fields =
+      static_cast<index_t>(gemm_grouped_field_t::count);
+  const index_t schedule_size = _group_count + 1 + _group_count * num_fields;
+  std::shared_ptr<index_t> schedule(new index_t[schedule_size],
+                                    std::default_delete<index_t[]>());
+  index_t* tiles = schedule.get();
+  index_t* fields = tiles + _group_count + 1;
+  tiles[0] = 0;
+  for (index_t g = 0; g < _group_count; ++g) {
+    if (_M[g] < 0 || _N[g] < 0 || _K[g] < 0) {
+      throw std::invalid_argument("invalid size of a grouped GEMM problem");
+    }
+    const index_t tiles_per_col = (_M[g] + block_rows - 1) / block_rows;
+    const index_t tiles_per_row = (_N[g] + block_cols - 1) / block_cols;
+    tiles[g + 1] = tiles[g] + tiles_per_col * tiles_per_row;
+    index_t* problem = fields + g * num_fields;
+    problem[static_cast<int>(gemm_grouped_field_t::m)] = _M[g];
+    problem[static_cast<int>(gemm_grouped_field_t::n)] = _N[g];
+    problem[static_cast<int>(gemm_grouped_field_t::k)] = _K[g];
+    problem[static_cast<int>(gemm_grouped_field_t::lda)] = _lda[g];
+    problem[static_cast<int>(gemm_grouped_field_t::ldb)] = _ldb[g];
+    problem[static_cast<int>(gemm_grouped_field_t::ldc)] = _ldc[g];
+    problem[static_cast<int>(gemm_grouped_field_t::offset_a)] = _offset_a[g];
+    problem[static_cast<int>(gemm_grouped_field_t::offset_b)] = _offset_b[g];
+    problem[static_cast<int>(gemm_grouped_field_t::offset_c)] = _offset_c[g];
+  }
+  const index_t num_tiles = tiles[_group_count];
+  if (num_tiles == 0) {
+    return {};
+  }
+
+  using schedule_buffer_t =
+      typename executor_t::policy_t::template buffer_t<index_t, 1>;
+  auto schedule_buffer = make_sycl_iterator_buffer<index_t>(
+      schedule_buffer_t{schedule, cl::sycl::range<1>(schedule_size)});
+
+  bool _TrA = _TransA != 'n';
+  bool _TrB = _TransB != 'n';
+  if (_TrA && _TrB) {
+    return _gemm_grouped_is_beta_zero<true, true>(
+        ex, _group_count, num_tiles, schedule_buffer, schedule_size, _alpha,
+        a_, b_, _beta, _C);
+  } else if (!_TrA && _TrB) {
+    return _gemm_grouped_is_beta_zero<false, true>(
+        ex, _group_count, num_tiles, schedule_buffer, schedule_size, _alpha,
+        a_, b_, _beta, _C);
+  } else if (_TrA && !_TrB) {
+    return _gemm_grouped_is_beta_zero<true, false>(
+        ex, _group_count, num_tiles, schedule_buffer, schedule_size, _alpha,
+        a_, b_, _beta, _C);
+  } else {
+    return _gemm_grouped_is_beta_zero<false, false>(
+        ex, _group_count, num_tiles, schedule_buffer, schedule_size, _alpha,
+        a_, b_, _beta, _C);
+  }
+}
+
 }  // namespace internal
 }  // namespace blas
 
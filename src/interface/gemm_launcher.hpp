@@ -56,9 +56,109 @@ typename Executor::policy_t::event_t Gemm_Launcher<
                         GemmVectorization, is_beta_zero, VectorSize, BatchType>(
       buffer_a, buffer_b, buffer_c, element_t(_alpha), element_t(_beta),
       batch_size);
+  // Split-K accumulates in C with float atomics, so it is limited to the
+  // strided kernels computing and storing single precision
+  using split_k_t = std::integral_constant<
+      bool,
+      gemm_split_k_supported &&
+          GemmAlgorithm == static_cast<int>(gemm_algorithm_t::standard) &&
+          BatchType == static_cast<int>(gemm_batch_type_t::strided) &&
+          std::is_same<element_t, float>::value &&
+          std::is_same<typename ValueType<container_t2>::type,
+                       float>::value>;
+  return _launch_gemm(ex, gemm, _M, _N, _K, _alpha, a_, _lda, b_, _ldb, _beta,
+                      _C, _ldc, batch_size, split_k_t{});
+}
+
+template <int WgSize, bool DoubleBuffer, bool ConflictA, bool ConflictB,
+          int ClSize, typename TileT, bool TransA, bool TransB,
+          int GemmMemoryType, int GemmAlgorithm, int GemmVectorization,
+          bool is_beta_zero, int VectorSize, int BatchType>
+template <typename Executor, typename gemm_t, typename container_t0,
+          typename container_t1, typename container_t2, typename element_t,
+          typename index_t>
+typename Executor::policy_t::event_t Gemm_Launcher<
+    WgSize, DoubleBuffer, ConflictA, ConflictB, ClSize, TileT, TransA, TransB,
+    GemmMemoryType, GemmAlgorithm, GemmVectorization, is_beta_zero, VectorSize,
+    BatchType>::_launch_gemm(Executor& ex, gemm_t gemm, index_t, index_t,
+                             index_t, element_t, container_t0, index_t,
+                             container_t1, index_t, element_t, container_t2,
+                             index_t, index_t, std::false_type) {
   return ex.execute(gemm);
 }
 
+/*!
+ * @brief Launches the GEMM, splitting K across the work-groups left idle when
+ * the tiles of C are fewer than the compute units of the device. The slices
+ * of K are the batches of a GemmSplitK kernel, which adds them to C once it
+ * has been scaled by beta.
+ */
+template <int WgSize, bool DoubleBuffer, bool ConflictA, bool ConflictB,
+          int ClSize, typename TileT, bool TransA, bool TransB,
+          int GemmMemoryType, int GemmAlgorithm, int GemmVectorization,
+          bool is_beta_zero, int VectorSize, int BatchType>
+template <typename Executor, typename gemm_t, typename container_t0,
+          typename container_t1, typename container_t2, typename element_t,
+          typename index_t>
+typename Executor::policy_t::event_t Gemm_Launcher<
+    WgSize, DoubleBuffer, ConflictA, ConflictB, ClSize, TileT, TransA, TransB,
+    GemmMemoryType, GemmAlgorithm, GemmVectorization, is_beta_zero, VectorSize,
+    BatchType>::_launch_gemm(Executor& ex, gemm_t gemm, index_t _M, index_t _N,
+                             index_t _K, element_t _alpha, container_t0 a_,
+                             index_t _lda, container_t1 b_, index_t _ldb,
+                             element_t _beta, container_t2 _C, index_t _ldc,
+                             index_t batch_size, std::true_type) {
+  const index_t compute_units =
+      ex.get_policy_handler().get_num_compute_units();
+  // The kernel is launched with this many copies of the tiles of C anyway
+  const index_t split_k =
+      std::min<index_t>(gemm.get_num_workgroup_cluster(compute_units),
+                        _K / split_k_min_depth);
+  // Clearing C when beta is zero is a single fill only if C is contiguous
+  if (batch_size != 1 || gemm.get_workgroup_cluster() >= compute_units ||
+      split_k < 2 || (is_beta_zero && _ldc != _M)) {
+    return ex.execute(gemm);
+  }
+
+  auto buffer_c = make_matrix_view<col_major>(ex, _C, _M, _N, _ldc);
+  typename Executor::policy_t::event_t events;
+  if (is_beta_zero) {
+    events = ex.get_policy_handler().fill(_C, element_t{0}, _M * _N);
+  } else if (_beta != element_t{1}) {
+    auto scal_op = make_op<ScalarOp, ProductOperator>(_beta, buffer_c);
+    auto assign_op = make_op<Assign>(buffer_c, scal_op);
+    events = ex.execute(assign_op);
+  }
+
+  const index_t depth = _K / split_k;
+  auto slices_a = make_matrix_view<col_major>(ex, a_, _M, depth, _lda);
+  auto slices_b = make_matrix_view<col_major>(ex, b_, depth, _N, _ldb);
+  auto split_gemm =
+      make_gemm<DoubleBuffer, ConflictA, ConflictB, ClSize, TileT, TransA,
+                TransB, GemmMemoryType, GemmAlgorithm, GemmVectorization, true,
+                VectorSize, BatchType>(slices_a, slices_b, buffer_c, _alpha,
+                                       element_t{0}, split_k, GemmSplitK{});
+  events = concatenate_vectors(events, ex.execute(split_gemm));
+
+  // The remainder of K, shorter than a slice, is accumulated by its own launch
+  const index_t tail = _K - split_k * depth;
+  if (tail > 0) {
+    const index_t offset = split_k * depth;
+    auto tail_a = make_matrix_view<col_major>(
+        ex, a_ + (TransA ? offset : offset * _lda), _M, tail, _lda);
+    auto tail_b = make_matrix_view<col_major>(
+        ex, b_ + (TransB ? offset * _ldb : offset), tail, _N, _ldb);
+    auto tail_gemm =
+        make_gemm<DoubleBuffer, ConflictA, ConflictB, ClSize, TileT, TransA,
+                  TransB, GemmMemoryType, GemmAlgorithm, GemmVectorization,
+                  true, VectorSize, BatchType>(tail_a, tail_b, buffer_c,
+                                               _alpha, element_t{0},
+                                               index_t{1}, GemmSplitK{});
+    events = concatenate_vectors(events, ex.execute(tail_gemm));
+  }
+  return events;
+}
+
 }  // namespace blas
 
 #endif  // SYCL_BLAS_BLAS3_LAUNCHER_HPP
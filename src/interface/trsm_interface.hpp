@@ -145,7 +145,8 @@ typename executor_t::policy_t::event_t _trsm(executor_t& ex, char side,
   // Temporary buffer for the inverse of the diagonal blocks of the matrix A
   // filled with zeroes
   const index_t invASize = roundUp<index_t>(K, blockSize) * blockSize;
-  auto invA = make_sycl_iterator_buffer<element_t>(invASize);
+  auto invA =
+      ex.get_policy_handler().template acquire_workspace<element_t>(invASize);
   trsmEvents = concatenate_vectors(
       trsmEvents, ex.get_policy_handler().fill(invA, element_t{0}, invASize));
 
@@ -192,7 +193,7 @@ typename executor_t::policy_t::event_t _trsm(executor_t& ex, char side,
   // output X will hold the TRSM result and will be copied to B at the end
   const index_t BSize = ldb * (N - 1) + M;
   const index_t ldx = ldb;
-  auto X = make_sycl_iterator_buffer<element_t>(BSize);
+  auto X = ex.get_policy_handler().template acquire_workspace<element_t>(BSize);
   trsmEvents =
       concatenate_vectors(trsmEvents, internal::_copy(ex, BSize, B, 1, X, 1));
 
@@ -360,6 +361,10 @@ typename executor_t::policy_t::event_t _trsm(executor_t& ex, char side,
   trsmEvents =
       concatenate_vectors(trsmEvents, internal::_copy(ex, BSize, X, 1, B, 1));
 
+  // All the kernels using the temporary buffers have been submitted
+  ex.get_policy_handler().release_workspace(invA);
+  ex.get_policy_handler().release_workspace(X);
+
   return trsmEvents;
 }
 
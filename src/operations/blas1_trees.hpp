@@ -112,6 +112,56 @@ auto get_scalar(element_t &scalar_)
     -> decltype(DetectScalar<element_t>::get_scalar(scalar_)) {
   return DetectScalar<element_t>::get_scalar(scalar_);
 }
+
+/*! bind_scalar.
+ * @brief Host scalars are captured by value, so there is nothing to bind.
+ */
+template <typename element_t>
+SYCL_BLAS_INLINE void bind_scalar(element_t &, cl::sycl::handler &) {}
+
+/*! bind_scalar.
+ * @brief Binds the buffer of a scalar stored in device memory.
+ */
+template <typename view_t>
+SYCL_BLAS_INLINE void bind_scalar(DeviceScalar<view_t> &scalar,
+                                  cl::sycl::handler &h) {
+  scalar.bind(h);
+}
+
+/*! adjust_scalar_access_displacement.
+ * @brief See bind_scalar.
+ */
+template <typename element_t>
+SYCL_BLAS_INLINE void adjust_scalar_access_displacement(element_t &) {}
+
+/*! adjust_scalar_access_displacement.
+ * @brief See bind_scalar.
+ */
+template <typename view_t>
+SYCL_BLAS_INLINE void adjust_scalar_access_displacement(
+    DeviceScalar<view_t> &scalar) {
+  scalar.adjust_access_displacement();
+}
+
+/*! batch_local_index.
+ * @brief Reduced values other than index-value tuples do not depend on the
+ * position of the vector in the batch.
+ */
+template <typename value_t, typename index_t>
+SYCL_BLAS_INLINE value_t batch_local_index(value_t val, index_t) {
+  return val;
+}
+
+/*! batch_local_index.
+ * @brief Makes the index found by a batched iamax/iamin relative to the
+ * first element of its vector.
+ */
+template <typename ix_t, typename val_t, typename index_t>
+SYCL_BLAS_INLINE IndexValueTuple<ix_t, val_t> batch_local_index(
+    IndexValueTuple<ix_t, val_t> val, index_t offset) {
+  return IndexValueTuple<ix_t, val_t>(val.ind - static_cast<ix_t>(offset),
+                                      val.val);
+}
 }  // namespace internal
 
 /** Join.
@@ -197,6 +247,63 @@ SYCL_BLAS_INLINE void Assign<lhs_t, rhs_t>::adjust_access_displacement() {
   rhs_.adjust_access_displacement();
 }
 
+/*! PacketAssign.
+ * @brief See PacketAssign in blas1_trees.h.
+ */
+template <int packet_size, typename lhs_t, typename rhs_t>
+PacketAssign<packet_size, lhs_t, rhs_t>::PacketAssign(lhs_t &_l, rhs_t _r)
+    : lhs_(_l), rhs_(_r){};
+
+template <int packet_size, typename lhs_t, typename rhs_t>
+SYCL_BLAS_INLINE typename PacketAssign<packet_size, lhs_t, rhs_t>::index_t
+PacketAssign<packet_size, lhs_t, rhs_t>::get_size() const {
+  return (rhs_.get_size() + packet_size - 1) / packet_size;
+}
+
+template <int packet_size, typename lhs_t, typename rhs_t>
+SYCL_BLAS_INLINE bool PacketAssign<packet_size, lhs_t, rhs_t>::valid_thread(
+    cl::sycl::nd_item<1> ndItem) const {
+  return ((ndItem.get_global_id(0) < get_size()));
+}
+
+template <int packet_size, typename lhs_t, typename rhs_t>
+SYCL_BLAS_INLINE typename PacketAssign<packet_size, lhs_t, rhs_t>::value_t
+PacketAssign<packet_size, lhs_t, rhs_t>::eval(
+    typename PacketAssign<packet_size, lhs_t, rhs_t>::index_t i) {
+  const index_t size = rhs_.get_size();
+  const index_t first = i * packet_size;
+  if (first + packet_size <= size) {
+    packet_t val = rhs_.template eval_packet<packet_size>(first);
+    lhs_.template store_packet<packet_size>(first, val);
+    return reinterpret_cast<value_t *>(&val)[0];
+  }
+  value_t val{};
+  for (index_t j = first; j < size; j++) {
+    val = lhs_.eval(j) = rhs_.eval(j);
+  }
+  return val;
+}
+
+template <int packet_size, typename lhs_t, typename rhs_t>
+SYCL_BLAS_INLINE typename PacketAssign<packet_size, lhs_t, rhs_t>::value_t
+PacketAssign<packet_size, lhs_t, rhs_t>::eval(cl::sycl::nd_item<1> ndItem) {
+  return PacketAssign<packet_size, lhs_t, rhs_t>::eval(ndItem.get_global_id(0));
+}
+
+template <int packet_size, typename lhs_t, typename rhs_t>
+SYCL_BLAS_INLINE void PacketAssign<packet_size, lhs_t, rhs_t>::bind(
+    cl::sycl::handler &h) {
+  lhs_.bind(h);
+  rhs_.bind(h);
+}
+
+template <int packet_size, typename lhs_t, typename rhs_t>
+SYCL_BLAS_INLINE void
+PacketAssign<packet_size, lhs_t, rhs_t>::adjust_access_displacement() {
+  lhs_.adjust_access_displacement();
+  rhs_.adjust_access_displacement();
+}
+
 /*! DoubleAssign.
  */
 template <typename lhs_1_t, typename lhs_2_t, typename rhs_1_t,
@@ -263,6 +370,28 @@ DoubleAssign<lhs_1_t, lhs_2_t, rhs_1_t, rhs_2_t>::adjust_access_displacement() {
   rhs_2_.adjust_access_displacement();
 }
 
+/*!DeviceScalar.
+ * @brief Leaf holding a scalar stored in device memory.
+ */
+template <typename view_t>
+DeviceScalar<view_t>::DeviceScalar(view_t &_v) : view_(_v) {}
+
+template <typename view_t>
+SYCL_BLAS_INLINE typename DeviceScalar<view_t>::value_t
+DeviceScalar<view_t>::eval(typename DeviceScalar<view_t>::index_t) {
+  return view_.eval(0);
+}
+
+template <typename view_t>
+SYCL_BLAS_INLINE void DeviceScalar<view_t>::bind(cl::sycl::handler &h) {
+  view_.bind(h);
+}
+
+template <typename view_t>
+SYCL_BLAS_INLINE void DeviceScalar<view_t>::adjust_access_displacement() {
+  view_.adjust_access_displacement();
+}
+
 /*!ScalarOp.
  * @brief Implements an scalar operation.
  * (e.g alpha OP x, with alpha scalar and x vector)
@@ -294,14 +423,25 @@ ScalarOp<operator_t, scalar_t, rhs_t>::eval(cl::sycl::nd_item<1> ndItem) {
   return ScalarOp<operator_t, scalar_t, rhs_t>::eval(ndItem.get_global_id(0));
 }
 template <typename operator_t, typename scalar_t, typename rhs_t>
+template <int packet_size>
+SYCL_BLAS_INLINE cl::sycl::vec<
+    typename ScalarOp<operator_t, scalar_t, rhs_t>::value_t, packet_size>
+ScalarOp<operator_t, scalar_t, rhs_t>::eval_packet(
+    typename ScalarOp<operator_t, scalar_t, rhs_t>::index_t i) {
+  return operator_t::eval(internal::get_scalar(scalar_),
+                          rhs_.template eval_packet<packet_size>(i));
+}
+template <typename operator_t, typename scalar_t, typename rhs_t>
 SYCL_BLAS_INLINE void ScalarOp<operator_t, scalar_t, rhs_t>::bind(
     cl::sycl::handler &h) {
+  internal::bind_scalar(scalar_, h);
   rhs_.bind(h);
 }
 
 template <typename operator_t, typename scalar_t, typename rhs_t>
 SYCL_BLAS_INLINE void
 ScalarOp<operator_t, scalar_t, rhs_t>::adjust_access_displacement() {
+  internal::adjust_scalar_access_displacement(scalar_);
   rhs_.adjust_access_displacement();
 }
 /*! UnaryOp.
@@ -334,6 +474,15 @@ SYCL_BLAS_INLINE typename UnaryOp<operator_t, rhs_t>::value_t
 UnaryOp<operator_t, rhs_t>::eval(cl::sycl::nd_item<1> ndItem) {
   return UnaryOp<operator_t, rhs_t>::eval(ndItem.get_global_id(0));
 }
+
+template <typename operator_t, typename rhs_t>
+template <int packet_size>
+SYCL_BLAS_INLINE
+    cl::sycl::vec<typename UnaryOp<operator_t, rhs_t>::value_t, packet_size>
+    UnaryOp<operator_t, rhs_t>::eval_packet(
+        typename UnaryOp<operator_t, rhs_t>::index_t i) {
+  return operator_t::eval(rhs_.template eval_packet<packet_size>(i));
+}
 template <typename operator_t, typename rhs_t>
 SYCL_BLAS_INLINE void UnaryOp<operator_t, rhs_t>::bind(cl::sycl::handler &h) {
   rhs_.bind(h);
@@ -373,6 +522,15 @@ BinaryOp<operator_t, lhs_t, rhs_t>::eval(cl::sycl::nd_item<1> ndItem) {
   return BinaryOp<operator_t, lhs_t, rhs_t>::eval(ndItem.get_global_id(0));
 }
 template <typename operator_t, typename lhs_t, typename rhs_t>
+template <int packet_size>
+SYCL_BLAS_INLINE cl::sycl::vec<
+    typename BinaryOp<operator_t, lhs_t, rhs_t>::value_t, packet_size>
+BinaryOp<operator_t, lhs_t, rhs_t>::eval_packet(
+    typename BinaryOp<operator_t, lhs_t, rhs_t>::index_t i) {
+  return operator_t::eval(lhs_.template eval_packet<packet_size>(i),
+                          rhs_.template eval_packet<packet_size>(i));
+}
+template <typename operator_t, typename lhs_t, typename rhs_t>
 SYCL_BLAS_INLINE void BinaryOp<operator_t, lhs_t, rhs_t>::bind(
     cl::sycl::handler &h) {
   lhs_.bind(h);
@@ -423,6 +581,203 @@ SYCL_BLAS_INLINE void TupleOp<rhs_t>::adjust_access_displacement() {
   rhs_.adjust_access_displacement();
 }
 
+/*! ScaledSquaresOp.
+ * @brief Maps each element of a vector to the ScaledSquaresTuple of its
+ * square (map (\x -> [|x|, 1]) vector).
+ */
+template <typename rhs_t>
+ScaledSquaresOp<rhs_t>::ScaledSquaresOp(rhs_t &_r) : rhs_(_r) {}
+
+template <typename rhs_t>
+SYCL_BLAS_INLINE typename ScaledSquaresOp<rhs_t>::index_t
+ScaledSquaresOp<rhs_t>::get_size() const {
+  return rhs_.get_size();
+}
+
+template <typename rhs_t>
+SYCL_BLAS_INLINE bool ScaledSquaresOp<rhs_t>::valid_thread(
+    cl::sycl::nd_item<1> ndItem) const {
+  return ((ndItem.get_global_id(0) < get_size()));
+}
+template <typename rhs_t>
+SYCL_BLAS_INLINE typename ScaledSquaresOp<rhs_t>::value_t
+ScaledSquaresOp<rhs_t>::eval(typename ScaledSquaresOp<rhs_t>::index_t i) {
+  return ScaledSquaresOperator::eval(rhs_.eval(i));
+}
+
+template <typename rhs_t>
+SYCL_BLAS_INLINE typename ScaledSquaresOp<rhs_t>::value_t
+ScaledSquaresOp<rhs_t>::eval(cl::sycl::nd_item<1> ndItem) {
+  return ScaledSquaresOp<rhs_t>::eval(ndItem.get_global_id(0));
+}
+template <typename rhs_t>
+SYCL_BLAS_INLINE void ScaledSquaresOp<rhs_t>::bind(cl::sycl::handler &h) {
+  rhs_.bind(h);
+}
+template <typename rhs_t>
+SYCL_BLAS_INLINE void ScaledSquaresOp<rhs_t>::adjust_access_displacement() {
+  rhs_.adjust_access_displacement();
+}
+
+/*! TypeCastOp.
+ * @brief Converts each element of a vector (map (\x -> cast_t(x)) vector).
+ */
+template <typename cast_t, typename rhs_t>
+TypeCastOp<cast_t, rhs_t>::TypeCastOp(rhs_t &_r) : rhs_(_r) {}
+
+template <typename cast_t, typename rhs_t>
+SYCL_BLAS_INLINE typename TypeCastOp<cast_t, rhs_t>::index_t
+TypeCastOp<cast_t, rhs_t>::get_size() const {
+  return rhs_.get_size();
+}
+
+template <typename cast_t, typename rhs_t>
+SYCL_BLAS_INLINE bool TypeCastOp<cast_t, rhs_t>::valid_thread(
+    cl::sycl::nd_item<1> ndItem) const {
+  return ((ndItem.get_global_id(0) < get_size()));
+}
+
+template <typename cast_t, typename rhs_t>
+SYCL_BLAS_INLINE typename TypeCastOp<cast_t, rhs_t>::value_t
+TypeCastOp<cast_t, rhs_t>::eval(typename TypeCastOp<cast_t, rhs_t>::index_t i) {
+  return static_cast<value_t>(rhs_.eval(i));
+}
+
+template <typename cast_t, typename rhs_t>
+SYCL_BLAS_INLINE typename TypeCastOp<cast_t, rhs_t>::value_t
+TypeCastOp<cast_t, rhs_t>::eval(cl::sycl::nd_item<1> ndItem) {
+  return TypeCastOp<cast_t, rhs_t>::eval(ndItem.get_global_id(0));
+}
+template <typename cast_t, typename rhs_t>
+template <int packet_size>
+SYCL_BLAS_INLINE cl::sycl::vec<typename TypeCastOp<cast_t, rhs_t>::value_t,
+                               packet_size>
+TypeCastOp<cast_t, rhs_t>::eval_packet(
+    typename TypeCastOp<cast_t, rhs_t>::index_t i) {
+  return rhs_.template eval_packet<packet_size>(i).template convert<value_t>();
+}
+template <typename cast_t, typename rhs_t>
+SYCL_BLAS_INLINE void TypeCastOp<cast_t, rhs_t>::bind(cl::sycl::handler &h) {
+  rhs_.bind(h);
+}
+template <typename cast_t, typename rhs_t>
+SYCL_BLAS_INLINE void TypeCastOp<cast_t, rhs_t>::adjust_access_displacement() {
+  rhs_.adjust_access_displacement();
+}
+
+/*! PacketReduceOp.
+ * @brief See PacketReduceOp in blas1_trees.h.
+ */
+template <typename operator_t, int packet_size, typename rhs_t>
+PacketReduceOp<operator_t, packet_size, rhs_t>::PacketReduceOp(rhs_t &_r)
+    : rhs_(_r) {}
+
+template <typename operator_t, int packet_size, typename rhs_t>
+SYCL_BLAS_INLINE
+    typename PacketReduceOp<operator_t, packet_size, rhs_t>::index_t
+    PacketReduceOp<operator_t, packet_size, rhs_t>::get_size() const {
+  return (rhs_.get_size() + packet_size - 1) / packet_size;
+}
+
+template <typename operator_t, int packet_size, typename rhs_t>
+SYCL_BLAS_INLINE bool
+PacketReduceOp<operator_t, packet_size, rhs_t>::valid_thread(
+    cl::sycl::nd_item<1> ndItem) const {
+  return ((ndItem.get_global_id(0) < get_size()));
+}
+
+template <typename operator_t, int packet_size, typename rhs_t>
+SYCL_BLAS_INLINE
+    typename PacketReduceOp<operator_t, packet_size, rhs_t>::value_t
+    PacketReduceOp<operator_t, packet_size, rhs_t>::eval(
+        typename PacketReduceOp<operator_t, packet_size, rhs_t>::index_t i) {
+  const index_t size = rhs_.get_size();
+  const index_t first = i * packet_size;
+  value_t val = operator_t::template init<rhs_t>();
+  if (first + packet_size <= size) {
+    packet_t packet = rhs_.template eval_packet<packet_size>(first);
+#pragma unroll
+    for (int j = 0; j < packet_size; j++) {
+      val = operator_t::eval(val, reinterpret_cast<value_t *>(&packet)[j]);
+    }
+    return val;
+  }
+  for (index_t j = first; j < size; j++) {
+    val = operator_t::eval(val, rhs_.eval(j));
+  }
+  return val;
+}
+
+template <typename operator_t, int packet_size, typename rhs_t>
+SYCL_BLAS_INLINE
+    typename PacketReduceOp<operator_t, packet_size, rhs_t>::value_t
+    PacketReduceOp<operator_t, packet_size, rhs_t>::eval(
+        cl::sycl::nd_item<1> ndItem) {
+  return PacketReduceOp<operator_t, packet_size, rhs_t>::eval(
+      ndItem.get_global_id(0));
+}
+
+template <typename operator_t, int packet_size, typename rhs_t>
+SYCL_BLAS_INLINE void PacketReduceOp<operator_t, packet_size, rhs_t>::bind(
+    cl::sycl::handler &h) {
+  rhs_.bind(h);
+}
+
+template <typename operator_t, int packet_size, typename rhs_t>
+SYCL_BLAS_INLINE void
+PacketReduceOp<operator_t, packet_size, rhs_t>::adjust_access_displacement() {
+  rhs_.adjust_access_displacement();
+}
+
+/*! StridedBatchOp.
+ * @brief Concatenates a batch of strided vectors.
+ */
+template <typename rhs_t>
+StridedBatchOp<rhs_t>::StridedBatchOp(rhs_t &_r, index_t _vecS, index_t _inc,
+                                      index_t _stride, index_t _batchS)
+    : rhs_(_r),
+      vector_size_(_vecS),
+      inc_(_inc),
+      batch_stride_(_stride),
+      batch_size_(_batchS) {}
+
+template <typename rhs_t>
+SYCL_BLAS_INLINE typename StridedBatchOp<rhs_t>::index_t
+StridedBatchOp<rhs_t>::get_size() const {
+  return vector_size_ * batch_size_;
+}
+
+template <typename rhs_t>
+SYCL_BLAS_INLINE bool StridedBatchOp<rhs_t>::valid_thread(
+    cl::sycl::nd_item<1> ndItem) const {
+  return ((ndItem.get_global_id(0) < get_size()));
+}
+
+template <typename rhs_t>
+SYCL_BLAS_INLINE typename StridedBatchOp<rhs_t>::value_t
+StridedBatchOp<rhs_t>::eval(typename StridedBatchOp<rhs_t>::index_t i) {
+  const index_t batch = i / vector_size_;
+  const index_t j = i - batch * vector_size_;
+  // A negative increment walks the vector backwards from its last element
+  const index_t pos =
+      (inc_ > 0) ? j * inc_ : (vector_size_ - 1 - j) * (-inc_);
+  return rhs_.eval(batch * batch_stride_ + pos);
+}
+
+template <typename rhs_t>
+SYCL_BLAS_INLINE typename StridedBatchOp<rhs_t>::value_t
+StridedBatchOp<rhs_t>::eval(cl::sycl::nd_item<1> ndItem) {
+  return StridedBatchOp<rhs_t>::eval(ndItem.get_global_id(0));
+}
+template <typename rhs_t>
+SYCL_BLAS_INLINE void StridedBatchOp<rhs_t>::bind(cl::sycl::handler &h) {
+  rhs_.bind(h);
+}
+template <typename rhs_t>
+SYCL_BLAS_INLINE void StridedBatchOp<rhs_t>::adjust_access_displacement() {
+  rhs_.adjust_access_displacement();
+}
+
 /*! AssignReduction.
  * @brief Implements the reduction operation for assignments (in the form y
  * = x) with y a scalar and x a subexpression tree.
@@ -536,6 +891,661 @@ AssignReduction<operator_t, lhs_t, rhs_t>::adjust_access_displacement() {
   rhs_.adjust_access_displacement();
 }
 
+/*! SinglePassAssignReduction.
+ * @brief Implements the reduction operation for assignments (in the form y
+ * = x) with y a scalar and x a subexpression tree, in a single kernel.
+ */
+template <typename operator_t, typename lhs_t, typename rhs_t,
+          typename counter_t>
+SinglePassAssignReduction<operator_t, lhs_t, rhs_t, counter_t>::
+    SinglePassAssignReduction(lhs_t &_l, rhs_t &_r, lhs_t &_partials,
+                              counter_t &_counter, index_t _blqS,
+                              index_t _grdS)
+    : lhs_(_l),
+      rhs_(_r),
+      partials_(_partials),
+      counter_(_counter),
+      local_num_thread_(_blqS),
+      global_num_thread_(_grdS){};
+
+template <typename operator_t, typename lhs_t, typename rhs_t,
+          typename counter_t>
+SYCL_BLAS_INLINE typename SinglePassAssignReduction<operator_t, lhs_t, rhs_t,
+                                                    counter_t>::index_t
+SinglePassAssignReduction<operator_t, lhs_t, rhs_t, counter_t>::get_size()
+    const {
+  return rhs_.get_size();
+}
+
+template <typename operator_t, typename lhs_t, typename rhs_t,
+          typename counter_t>
+SYCL_BLAS_INLINE bool
+SinglePassAssignReduction<operator_t, lhs_t, rhs_t, counter_t>::valid_thread(
+    cl::sycl::nd_item<1> ndItem) const {
+  return true;
+}
+
+template <typename operator_t, typename lhs_t, typename rhs_t,
+          typename counter_t>
+template <typename sharedT>
+SYCL_BLAS_INLINE typename SinglePassAssignReduction<operator_t, lhs_t, rhs_t,
+                                                    counter_t>::value_t
+SinglePassAssignReduction<operator_t, lhs_t, rhs_t, counter_t>::eval(
+    sharedT scratch, cl::sycl::nd_item<1> ndItem) {
+  using counter_value_t = typename counter_t::value_t;
+  index_t localid = ndItem.get_local_id(0);
+  index_t localSz = ndItem.get_local_range(0);
+  index_t groupid = ndItem.get_group(0);
+  index_t groupSz = ndItem.get_group_range(0);
+
+  index_t vecS = rhs_.get_size();
+  index_t frs_thrd = 2 * groupid * localSz + localid;
+
+  // Reduction across the grid
+  static const value_t init_val = operator_t::template init<rhs_t>();
+  value_t val = init_val;
+  for (index_t k = frs_thrd; k < vecS; k += 2 * global_num_thread_) {
+    val = operator_t::eval(val, rhs_.eval(k));
+    if ((k + local_num_thread_ < vecS)) {
+      val = operator_t::eval(val, rhs_.eval(k + local_num_thread_));
+    }
+  }
+
+  scratch[localid] = val;
+  // This barrier is mandatory to be sure the data is on the shared memory
+  ndItem.barrier(cl::sycl::access::fence_space::local_space);
+
+  // Reduction inside the block
+  for (index_t offset = localSz >> 1; offset > 0; offset >>= 1) {
+    if (localid < offset) {
+      scratch[localid] =
+          operator_t::eval(scratch[localid], scratch[localid + offset]);
+    }
+    // This barrier is mandatory to be sure the data are on the shared memory
+    ndItem.barrier(cl::sycl::access::fence_space::local_space);
+  }
+
+  // Reduction across the blocks, done by the last block to finish. The
+  // number of blocks is at most the block size, so a single work item can
+  // combine all the partial results.
+  if (localid == 0) {
+    partials_.eval(groupid) = scratch[localid];
+    // The partial result must be visible to the other blocks before the
+    // counter is incremented. SYCL 1.2.1 only orders this across work groups
+    // in practice, see single_pass_reduction_supported.
+    ndItem.mem_fence(cl::sycl::access::fence_space::global_space);
+    cl::sycl::atomic<counter_value_t> done(
+        counter_.get_data().get_pointer() + counter_.get_access_displacement());
+    if (done.fetch_add(counter_value_t(1)) ==
+        static_cast<counter_value_t>(groupSz - 1)) {
+      ndItem.mem_fence(cl::sycl::access::fence_space::global_space);
+      val = init_val;
+      for (index_t i = 0; i < groupSz; i++) {
+        val = operator_t::eval(val, partials_.eval(i));
+      }
+      lhs_.eval(0) = val;
+      // Leave the counter ready for the next reduction
+      done.store(counter_value_t(0));
+    }
+  }
+  return val;
+}
+
+template <typename operator_t, typename lhs_t, typename rhs_t,
+          typename counter_t>
+SYCL_BLAS_INLINE void
+SinglePassAssignReduction<operator_t, lhs_t, rhs_t, counter_t>::bind(
+    cl::sycl::handler &h) {
+  lhs_.bind(h);
+  rhs_.bind(h);
+  partials_.bind(h);
+  counter_.bind(h);
+}
+
+template <typename operator_t, typename lhs_t, typename rhs_t,
+          typename counter_t>
+SYCL_BLAS_INLINE void SinglePassAssignReduction<
+    operator_t, lhs_t, rhs_t, counter_t>::adjust_access_displacement() {
+  lhs_.adjust_access_displacement();
+  rhs_.adjust_access_displacement();
+  partials_.adjust_access_displacement();
+  counter_.adjust_access_displacement();
+}
+
+/*! BatchedAssignReduction.
+ * @brief Implements the reduction of a batch of vectors, one vector per work
+ * group.
+ */
+template <typename operator_t, typename lhs_t, typename rhs_t,
+          typename post_op_t>
+BatchedAssignReduction<operator_t, lhs_t, rhs_t, post_op_t>::
+    BatchedAssignReduction(lhs_t &_l, rhs_t &_r, index_t _vecS, index_t _blqS)
+    : lhs_(_l), rhs_(_r), vector_size_(_vecS), local_num_thread_(_blqS){};
+
+template <typename operator_t, typename lhs_t, typename rhs_t,
+          typename post_op_t>
+SYCL_BLAS_INLINE typename BatchedAssignReduction<operator_t, lhs_t, rhs_t,
+                                                 post_op_t>::index_t
+BatchedAssignReduction<operator_t, lhs_t, rhs_t, post_op_t>::get_size() const {
+  return lhs_.get_size();
+}
+
+template <typename operator_t, typename lhs_t, typename rhs_t,
+          typename post_op_t>
+SYCL_BLAS_INLINE bool
+BatchedAssignReduction<operator_t, lhs_t, rhs_t, post_op_t>::valid_thread(
+    cl::sycl::nd_item<1> ndItem) const {
+  return true;
+}
+
+template <typename operator_t, typename lhs_t, typename rhs_t,
+          typename post_op_t>
+template <typename sharedT>
+SYCL_BLAS_INLINE typename BatchedAssignReduction<operator_t, lhs_t, rhs_t,
+                                                 post_op_t>::value_t
+BatchedAssignReduction<operator_t, lhs_t, rhs_t, post_op_t>::eval(
+    sharedT scratch, cl::sycl::nd_item<1> ndItem) {
+  index_t localid = ndItem.get_local_id(0);
+  index_t localSz = ndItem.get_local_range(0);
+  index_t groupid = ndItem.get_group(0);
+
+  // The work group reduces the vector of the batch matching its id
+  const index_t offset = groupid * vector_size_;
+  static const value_t init_val = operator_t::template init<rhs_t>();
+  value_t val = init_val;
+  for (index_t k = localid; k < vector_size_; k += local_num_thread_) {
+    val = operator_t::eval(val, rhs_.eval(offset + k));
+  }
+
+  scratch[localid] = val;
+  // This barrier is mandatory to be sure the data is on the shared memory
+  ndItem.barrier(cl::sycl::access::fence_space::local_space);
+
+  // Reduction inside the block
+  for (index_t stride = localSz >> 1; stride > 0; stride >>= 1) {
+    if (localid < stride) {
+      scratch[localid] =
+          operator_t::eval(scratch[localid], scratch[localid + stride]);
+    }
+    // This barrier is mandatory to be sure the data are on the shared memory
+    ndItem.barrier(cl::sycl::access::fence_space::local_space);
+  }
+  if (localid == 0) {
+    lhs_.eval(groupid) =
+        post_op_t::eval(internal::batch_local_index(scratch[localid], offset));
+  }
+  return scratch[localid];
+}
+
+template <typename operator_t, typename lhs_t, typename rhs_t,
+          typename post_op_t>
+SYCL_BLAS_INLINE void
+BatchedAssignReduction<operator_t, lhs_t, rhs_t, post_op_t>::bind(
+    cl::sycl::handler &h) {
+  lhs_.bind(h);
+  rhs_.bind(h);
+}
+
+template <typename operator_t, typename lhs_t, typename rhs_t,
+          typename post_op_t>
+SYCL_BLAS_INLINE void BatchedAssignReduction<
+    operator_t, lhs_t, rhs_t, post_op_t>::adjust_access_displacement() {
+  lhs_.adjust_access_displacement();
+  rhs_.adjust_access_displacement();
+}
+
+/*! ReductionSlots.
+ * @brief A plain accumulator is its single slot.
+ */
+template <typename acc_t>
+template <typename slot_t>
+SYCL_BLAS_INLINE acc_t ReductionSlots<acc_t>::load(slot_t slot) {
+  return slot(0);
+}
+
+template <typename acc_t>
+template <typename slot_t>
+SYCL_BLAS_INLINE void ReductionSlots<acc_t>::store(slot_t slot,
+                                                    const acc_t &acc) {
+  slot(0) = acc;
+}
+
+template <typename val_t>
+template <typename slot_t>
+SYCL_BLAS_INLINE ScaledSquaresTuple<val_t>
+ReductionSlots<ScaledSquaresTuple<val_t>>::load(slot_t slot) {
+  return ScaledSquaresTuple<val_t>(slot(0), slot(1));
+}
+
+template <typename val_t>
+template <typename slot_t>
+SYCL_BLAS_INLINE void ReductionSlots<ScaledSquaresTuple<val_t>>::store(
+    slot_t slot, const ScaledSquaresTuple<val_t> &acc) {
+  slot(0) = acc.get_scale();
+  slot(1) = acc.get_ssq();
+}
+
+/*! ReductionOperands.
+ * @brief The empty list of operands passes the values of the operands to the
+ * reductions.
+ */
+template <typename... operand_t>
+template <typename reductions_t, typename val_t, typename index_t,
+          typename... value_t>
+SYCL_BLAS_INLINE void ReductionOperands<operand_t...>::accumulate(
+    const reductions_t &reductions, val_t *val, index_t i,
+    const value_t &... values) {
+  reductions.accumulate(val, values...);
+}
+
+template <typename... operand_t>
+SYCL_BLAS_INLINE void ReductionOperands<operand_t...>::bind(
+    cl::sycl::handler &h) {}
+
+template <typename... operand_t>
+SYCL_BLAS_INLINE void
+ReductionOperands<operand_t...>::adjust_access_displacement() {}
+
+template <typename head_operand_t, typename... operand_t>
+ReductionOperands<head_operand_t, operand_t...>::ReductionOperands(
+    head_operand_t &_h, operand_t &... _t)
+    : head_(_h), tail_(_t...){};
+
+template <typename head_operand_t, typename... operand_t>
+SYCL_BLAS_INLINE
+    typename ReductionOperands<head_operand_t, operand_t...>::index_t
+    ReductionOperands<head_operand_t, operand_t...>::get_size() const {
+  return head_.get_size();
+}
+
+template <typename head_operand_t, typename... operand_t>
+template <typename reductions_t, typename val_t, typename... value_t>
+SYCL_BLAS_INLINE void
+ReductionOperands<head_operand_t, operand_t...>::accumulate(
+    const reductions_t &reductions, val_t *val, index_t i,
+    const value_t &... values) {
+  tail_.accumulate(reductions, val, i, values..., head_.eval(i));
+}
+
+template <typename head_operand_t, typename... operand_t>
+SYCL_BLAS_INLINE void ReductionOperands<head_operand_t, operand_t...>::bind(
+    cl::sycl::handler &h) {
+  head_.bind(h);
+  tail_.bind(h);
+}
+
+template <typename head_operand_t, typename... operand_t>
+SYCL_BLAS_INLINE void ReductionOperands<
+    head_operand_t, operand_t...>::adjust_access_displacement() {
+  head_.adjust_access_displacement();
+  tail_.adjust_access_displacement();
+}
+
+/*! ReductionList.
+ * @brief The empty list ends the recursion over the reductions.
+ */
+template <int offset, int slot, typename operands_t, typename... entry_t>
+template <typename value_t>
+SYCL_BLAS_INLINE void ReductionList<offset, slot, operands_t, entry_t...>::init(
+    value_t *val) const {}
+
+template <int offset, int slot, typename operands_t, typename... entry_t>
+template <typename value_t, typename... operand_value_t>
+SYCL_BLAS_INLINE void
+ReductionList<offset, slot, operands_t, entry_t...>::accumulate(
+    value_t *val, const operand_value_t &... values) const {}
+
+template <int offset, int slot, typename operands_t, typename... entry_t>
+template <typename sharedT, typename index_t>
+SYCL_BLAS_INLINE void
+ReductionList<offset, slot, operands_t, entry_t...>::combine(
+    sharedT scratch, index_t stride, index_t dst, index_t src) const {}
+
+template <int offset, int slot, typename operands_t, typename... entry_t>
+template <typename value_t, typename partials_t, typename index_t>
+SYCL_BLAS_INLINE void
+ReductionList<offset, slot, operands_t, entry_t...>::combine_partials(
+    value_t *val, partials_t &partials, index_t stride, index_t i) const {}
+
+template <int offset, int slot, typename operands_t, typename... entry_t>
+template <typename value_t, typename lhs_t>
+SYCL_BLAS_INLINE void
+ReductionList<offset, slot, operands_t, entry_t...>::finalize(
+    value_t *val, lhs_t &lhs) const {}
+
+template <int offset, int slot, typename operands_t, typename operator_t,
+          typename map_t, typename post_op_t, typename... entry_t>
+template <typename val_t>
+SYCL_BLAS_INLINE void
+ReductionList<offset, slot, operands_t,
+              ReductionEntry<operator_t, map_t, post_op_t>,
+              entry_t...>::init(val_t *val) const {
+  slots_t::store([&](int j) -> val_t & { return val[slot + j]; },
+                 operator_t::template init<mapped_t>());
+  tail_t().init(val);
+}
+
+template <int offset, int slot, typename operands_t, typename operator_t,
+          typename map_t, typename post_op_t, typename... entry_t>
+template <typename val_t, typename... operand_value_t>
+SYCL_BLAS_INLINE void
+ReductionList<offset, slot, operands_t,
+              ReductionEntry<operator_t, map_t, post_op_t>,
+              entry_t...>::accumulate(val_t *val,
+                                      const operand_value_t &... values) const {
+  auto acc_slot = [&](int j) -> val_t & { return val[slot + j]; };
+  slots_t::store(acc_slot, operator_t::eval(slots_t::load(acc_slot),
+                                            map_t::eval(values...)));
+  tail_t().accumulate(val, values...);
+}
+
+template <int offset, int slot, typename operands_t, typename operator_t,
+          typename map_t, typename post_op_t, typename... entry_t>
+template <typename sharedT, typename index_t>
+SYCL_BLAS_INLINE void
+ReductionList<offset, slot, operands_t,
+              ReductionEntry<operator_t, map_t, post_op_t>,
+              entry_t...>::combine(sharedT scratch, index_t stride,
+                                   index_t dst, index_t src) const {
+  auto dst_slot = [&](int j) -> value_t & {
+    return scratch[(slot + j) * stride + dst];
+  };
+  auto src_slot = [&](int j) -> value_t {
+    return scratch[(slot + j) * stride + src];
+  };
+  slots_t::store(dst_slot, operator_t::eval(slots_t::load(dst_slot),
+                                            slots_t::load(src_slot)));
+  tail_t().combine(scratch, stride, dst, src);
+}
+
+template <int offset, int slot, typename operands_t, typename operator_t,
+          typename map_t, typename post_op_t, typename... entry_t>
+template <typename val_t, typename partials_t, typename index_t>
+SYCL_BLAS_INLINE void
+ReductionList<offset, slot, operands_t,
+              ReductionEntry<operator_t, map_t, post_op_t>,
+              entry_t...>::combine_partials(val_t *val, partials_t &partials,
+                                            index_t stride, index_t i) const {
+  auto acc_slot = [&](int j) -> val_t & { return val[slot + j]; };
+  auto partial_slot = [&](int j) -> val_t {
+    return partials.eval((slot + j) * stride + i);
+  };
+  slots_t::store(acc_slot, operator_t::eval(slots_t::load(acc_slot),
+                                            slots_t::load(partial_slot)));
+  tail_t().combine_partials(val, partials, stride, i);
+}
+
+template <int offset, int slot, typename operands_t, typename operator_t,
+          typename map_t, typename post_op_t, typename... entry_t>
+template <typename val_t, typename lhs_t>
+SYCL_BLAS_INLINE void
+ReductionList<offset, slot, operands_t,
+              ReductionEntry<operator_t, map_t, post_op_t>,
+              entry_t...>::finalize(val_t *val, lhs_t &lhs) const {
+  lhs.eval(offset) = post_op_t::eval(
+      slots_t::load([&](int j) -> val_t { return val[slot + j]; }));
+  tail_t().finalize(val, lhs);
+}
+
+/*! MultiAssignReduction.
+ * @brief Implements several reductions over the same range in a single
+ * traversal. The executor runs it as a SinglePassMultiAssignReduction, or as
+ * a sequence of MultiPassMultiAssignReduction steps.
+ */
+template <typename lhs_t, typename operands_t, typename reductions_t>
+MultiAssignReduction<lhs_t, operands_t, reductions_t>::MultiAssignReduction(
+    lhs_t &_l, operands_t &_o, reductions_t &_r, index_t _blqS, index_t _grdS)
+    : lhs_(_l),
+      operands_(_o),
+      reductions_(_r),
+      local_num_thread_(_blqS),
+      global_num_thread_(_grdS){};
+
+template <typename lhs_t, typename operands_t, typename reductions_t>
+SYCL_BLAS_INLINE
+    typename MultiAssignReduction<lhs_t, operands_t, reductions_t>::index_t
+    MultiAssignReduction<lhs_t, operands_t, reductions_t>::get_size() const {
+  return operands_.get_size();
+}
+
+/*! SinglePassMultiAssignReduction.
+ * @brief Kernel of a MultiAssignReduction.
+ */
+template <typename lhs_t, typename operands_t, typename reductions_t,
+          typename counter_t>
+SinglePassMultiAssignReduction<lhs_t, operands_t, reductions_t, counter_t>::
+    SinglePassMultiAssignReduction(lhs_t &_l, operands_t &_o,
+                                   reductions_t &_r, lhs_t &_partials,
+                                   counter_t &_counter, index_t _blqS,
+                                   index_t _grdS)
+    : lhs_(_l),
+      operands_(_o),
+      reductions_(_r),
+      partials_(_partials),
+      counter_(_counter),
+      local_num_thread_(_blqS),
+      global_num_thread_(_grdS){};
+
+template <typename lhs_t, typename operands_t, typename reductions_t,
+          typename counter_t>
+SYCL_BLAS_INLINE typename SinglePassMultiAssignReduction<
+    lhs_t, operands_t, reductions_t, counter_t>::index_t
+SinglePassMultiAssignReduction<lhs_t, operands_t, reductions_t,
+                               counter_t>::get_size() const {
+  return operands_.get_size();
+}
+
+template <typename lhs_t, typename operands_t, typename reductions_t,
+          typename counter_t>
+SYCL_BLAS_INLINE bool
+SinglePassMultiAssignReduction<lhs_t, operands_t, reductions_t,
+                               counter_t>::valid_thread(cl::sycl::nd_item<1>
+                                                            ndItem) const {
+  return true;
+}
+
+template <typename lhs_t, typename operands_t, typename reductions_t,
+          typename counter_t>
+template <typename sharedT>
+SYCL_BLAS_INLINE typename SinglePassMultiAssignReduction<
+    lhs_t, operands_t, reductions_t, counter_t>::value_t
+SinglePassMultiAssignReduction<lhs_t, operands_t, reductions_t,
+                               counter_t>::eval(sharedT scratch,
+                                                cl::sycl::nd_item<1> ndItem) {
+  using counter_value_t = typename counter_t::value_t;
+  index_t localid = ndItem.get_local_id(0);
+  index_t localSz = ndItem.get_local_range(0);
+  index_t groupid = ndItem.get_group(0);
+  index_t groupSz = ndItem.get_group_range(0);
+
+  index_t vecS = operands_.get_size();
+  index_t frs_thrd = 2 * groupid * localSz + localid;
+
+  // Reduction across the grid
+  value_t val[num_slots];
+  reductions_.init(val);
+  for (index_t k = frs_thrd; k < vecS; k += 2 * global_num_thread_) {
+    operands_.accumulate(reductions_, val, k);
+    if ((k + local_num_thread_ < vecS)) {
+      operands_.accumulate(reductions_, val, k + local_num_thread_);
+    }
+  }
+
+  for (int r = 0; r < num_slots; r++) {
+    scratch[r * localSz + localid] = val[r];
+  }
+  // This barrier is mandatory to be sure the data is on the shared memory
+  ndItem.barrier(cl::sycl::access::fence_space::local_space);
+
+  // Reduction inside the block
+  for (index_t offset = localSz >> 1; offset > 0; offset >>= 1) {
+    if (localid < offset) {
+      reductions_.combine(scratch, localSz, localid, localid + offset);
+    }
+    // This barrier is mandatory to be sure the data are on the shared memory
+    ndItem.barrier(cl::sycl::access::fence_space::local_space);
+  }
+
+  // Reduction across the blocks, done by the last block to finish
+  if (localid == 0) {
+    for (int r = 0; r < num_slots; r++) {
+      partials_.eval(r * groupSz + groupid) = scratch[r * localSz];
+    }
+    // The partial results must be visible to the other blocks before the
+    // counter is incremented. SYCL 1.2.1 only orders this across work groups
+    // in practice, see single_pass_reduction_supported.
+    ndItem.mem_fence(cl::sycl::access::fence_space::global_space);
+    cl::sycl::atomic<counter_value_t> done(
+        counter_.get_data().get_pointer() + counter_.get_access_displacement());
+    if (done.fetch_add(counter_value_t(1)) ==
+        static_cast<counter_value_t>(groupSz - 1)) {
+      ndItem.mem_fence(cl::sycl::access::fence_space::global_space);
+      reductions_.init(val);
+      for (index_t i = 0; i < groupSz; i++) {
+        reductions_.combine_partials(val, partials_, groupSz, i);
+      }
+      reductions_.finalize(val, lhs_);
+      // Leave the counter ready for the next reduction
+      done.store(counter_value_t(0));
+    }
+  }
+  return val[0];
+}
+
+template <typename lhs_t, typename operands_t, typename reductions_t,
+          typename counter_t>
+SYCL_BLAS_INLINE void
+SinglePassMultiAssignReduction<lhs_t, operands_t, reductions_t,
+                               counter_t>::bind(cl::sycl::handler &h) {
+  lhs_.bind(h);
+  operands_.bind(h);
+  partials_.bind(h);
+  counter_.bind(h);
+}
+
+template <typename lhs_t, typename operands_t, typename reductions_t,
+          typename counter_t>
+SYCL_BLAS_INLINE void SinglePassMultiAssignReduction<
+    lhs_t, operands_t, reductions_t, counter_t>::adjust_access_displacement() {
+  lhs_.adjust_access_displacement();
+  operands_.adjust_access_displacement();
+  partials_.adjust_access_displacement();
+  counter_.adjust_access_displacement();
+}
+
+/*! MultiPassMultiAssignReduction.
+ * @brief Step of a MultiAssignReduction without single pass reductions.
+ */
+template <typename lhs_t, typename operands_t, typename reductions_t>
+MultiPassMultiAssignReduction<lhs_t, operands_t, reductions_t>::
+    MultiPassMultiAssignReduction(lhs_t &_l, operands_t &_o, reductions_t &_r,
+                                  lhs_t &_in, lhs_t &_out, index_t _in_size,
+                                  index_t _blqS, index_t _grdS)
+    : lhs_(_l),
+      operands_(_o),
+      reductions_(_r),
+      in_(_in),
+      out_(_out),
+      in_size_(_in_size),
+      local_num_thread_(_blqS),
+      global_num_thread_(_grdS){};
+
+template <typename lhs_t, typename operands_t, typename reductions_t>
+SYCL_BLAS_INLINE typename MultiPassMultiAssignReduction<lhs_t, operands_t,
+                                                        reductions_t>::index_t
+MultiPassMultiAssignReduction<lhs_t, operands_t, reductions_t>::get_size()
+    const {
+  return (in_size_ == 0) ? operands_.get_size() : in_size_;
+}
+
+template <typename lhs_t, typename operands_t, typename reductions_t>
+SYCL_BLAS_INLINE bool
+MultiPassMultiAssignReduction<lhs_t, operands_t, reductions_t>::valid_thread(
+    cl::sycl::nd_item<1> ndItem) const {
+  return true;
+}
+
+template <typename lhs_t, typename operands_t, typename reductions_t>
+template <typename sharedT>
+SYCL_BLAS_INLINE typename MultiPassMultiAssignReduction<lhs_t, operands_t,
+                                                        reductions_t>::value_t
+MultiPassMultiAssignReduction<lhs_t, operands_t, reductions_t>::eval(
+    sharedT scratch, cl::sycl::nd_item<1> ndItem) {
+  index_t localid = ndItem.get_local_id(0);
+  index_t localSz = ndItem.get_local_range(0);
+  index_t groupid = ndItem.get_group(0);
+  index_t groupSz = ndItem.get_group_range(0);
+
+  index_t vecS = get_size();
+  index_t frs_thrd = 2 * groupid * localSz + localid;
+
+  // Reduction across the grid, of the operands in the first step and of the
+  // partial results of the previous step in the next ones
+  value_t val[num_slots];
+  reductions_.init(val);
+  auto accumulate = [&](index_t i) {
+    if (in_size_ == 0) {
+      operands_.accumulate(reductions_, val, i);
+    } else {
+      reductions_.combine_partials(val, in_, in_size_, i);
+    }
+  };
+  for (index_t k = frs_thrd; k < vecS; k += 2 * global_num_thread_) {
+    accumulate(k);
+    if ((k + local_num_thread_ < vecS)) {
+      accumulate(k + local_num_thread_);
+    }
+  }
+
+  for (int r = 0; r < num_slots; r++) {
+    scratch[r * localSz + localid] = val[r];
+  }
+  // This barrier is mandatory to be sure the data is on the shared memory
+  ndItem.barrier(cl::sycl::access::fence_space::local_space);
+
+  // Reduction inside the block
+  for (index_t offset = localSz >> 1; offset > 0; offset >>= 1) {
+    if (localid < offset) {
+      reductions_.combine(scratch, localSz, localid, localid + offset);
+    }
+    // This barrier is mandatory to be sure the data are on the shared memory
+    ndItem.barrier(cl::sycl::access::fence_space::local_space);
+  }
+
+  if (localid == 0) {
+    if (groupSz == 1) {
+      for (int r = 0; r < num_slots; r++) {
+        val[r] = scratch[r * localSz];
+      }
+      reductions_.finalize(val, lhs_);
+    } else {
+      for (int r = 0; r < num_slots; r++) {
+        out_.eval(r * groupSz + groupid) = scratch[r * localSz];
+      }
+    }
+  }
+  return val[0];
+}
+
+template <typename lhs_t, typename operands_t, typename reductions_t>
+SYCL_BLAS_INLINE void
+MultiPassMultiAssignReduction<lhs_t, operands_t, reductions_t>::bind(
+    cl::sycl::handler &h) {
+  lhs_.bind(h);
+  operands_.bind(h);
+  in_.bind(h);
+  out_.bind(h);
+}
+
+template <typename lhs_t, typename operands_t, typename reductions_t>
+SYCL_BLAS_INLINE void MultiPassMultiAssignReduction<
+    lhs_t, operands_t, reductions_t>::adjust_access_displacement() {
+  lhs_.adjust_access_displacement();
+  operands_.adjust_access_displacement();
+  in_.adjust_access_displacement();
+  out_.adjust_access_displacement();
+}
+
 }  // namespace blas
 
 #endif  // BLAS1_TREES_HPP
@@ -0,0 +1,391 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename banded.hpp
+ *
+ **************************************************************************/
+
+#ifndef BANDED_HPP
+#define BANDED_HPP
+#include "operations/blas2_trees.h"
+#include "views/view_sycl.hpp"
+namespace blas {
+
+/**** GBMV ****/
+
+/*!
+ * @brief Constructor for the Gbmv class. See blas2_trees.h for details on the
+ * parameters.
+ */
+template <typename lhs_t, typename matrix_t, typename vector_t,
+          bool is_transposed>
+SYCL_BLAS_INLINE Gbmv<lhs_t, matrix_t, vector_t, is_transposed>::Gbmv(
+    lhs_t &_l, matrix_t &_matrix_a, vector_t &_vector_x, index_t _kl,
+    index_t _ku, value_t _alpha, value_t _beta)
+    : lhs_(_l),
+      matrix_a_(_matrix_a),
+      vector_x_(_vector_x),
+      kl_(_kl),
+      ku_(_ku),
+      alpha_(_alpha),
+      beta_(_beta) {}
+
+template <typename lhs_t, typename matrix_t, typename vector_t,
+          bool is_transposed>
+SYCL_BLAS_INLINE
+    typename Gbmv<lhs_t, matrix_t, vector_t, is_transposed>::index_t
+    Gbmv<lhs_t, matrix_t, vector_t, is_transposed>::get_size() const {
+  return lhs_.get_size();
+}
+
+template <typename lhs_t, typename matrix_t, typename vector_t,
+          bool is_transposed>
+SYCL_BLAS_INLINE bool
+Gbmv<lhs_t, matrix_t, vector_t, is_transposed>::valid_thread(
+    cl::sycl::nd_item<1> ndItem) const {
+  return ndItem.get_global_id(0) < get_size();
+}
+
+/*!
+ * @brief Computes the element i of y from the band of the row i of op(A)
+ */
+template <typename lhs_t, typename matrix_t, typename vector_t,
+          bool is_transposed>
+SYCL_BLAS_INLINE
+    typename Gbmv<lhs_t, matrix_t, vector_t, is_transposed>::value_t
+    Gbmv<lhs_t, matrix_t, vector_t, is_transposed>::eval(index_t i) {
+  // The band of the row i of A^T is the band of the column i of A, i.e. the
+  // band of a matrix with the number of sub- and super-diagonals swapped
+  const index_t lower = is_transposed ? ku_ : kl_;
+  const index_t upper = is_transposed ? kl_ : ku_;
+  const index_t c_dim = vector_x_.get_size();
+  const index_t first = (i > lower) ? i - lower : 0;
+  const index_t last = (i + upper < c_dim - 1) ? i + upper : c_dim - 1;
+
+  value_t sum = value_t{0};
+  for (index_t j = first; j <= last; j++) {
+    // The element (i, j) of A is stored at (ku + i - j, j)
+    const value_t a_elem = is_transposed ? matrix_a_.eval(ku_ + j - i, i)
+                                         : matrix_a_.eval(ku_ + i - j, j);
+    sum = cl::sycl::mad(a_elem, vector_x_.eval(j), sum);
+  }
+
+  // y is only read when beta is not zero, as in the reference BLAS
+  const value_t alpha_sum = alpha_ * sum;
+  lhs_.eval(i) = (beta_ == value_t{0})
+                     ? alpha_sum
+                     : cl::sycl::mad(beta_, lhs_.eval(i), alpha_sum);
+  return sum;
+}
+
+template <typename lhs_t, typename matrix_t, typename vector_t,
+          bool is_transposed>
+SYCL_BLAS_INLINE
+    typename Gbmv<lhs_t, matrix_t, vector_t, is_transposed>::value_t
+    Gbmv<lhs_t, matrix_t, vector_t, is_transposed>::eval(
+        cl::sycl::nd_item<1> ndItem) {
+  return eval(ndItem.get_global_id(0));
+}
+
+template <typename lhs_t, typename matrix_t, typename vector_t,
+          bool is_transposed>
+SYCL_BLAS_INLINE void Gbmv<lhs_t, matrix_t, vector_t, is_transposed>::bind(
+    cl::sycl::handler &h) {
+  lhs_.bind(h);
+  matrix_a_.bind(h);
+  vector_x_.bind(h);
+}
+
+template <typename lhs_t, typename matrix_t, typename vector_t,
+          bool is_transposed>
+SYCL_BLAS_INLINE void Gbmv<lhs_t, matrix_t, vector_t,
+                           is_transposed>::adjust_access_displacement() {
+  lhs_.adjust_access_displacement();
+  matrix_a_.adjust_access_displacement();
+  vector_x_.adjust_access_displacement();
+}
+
+/**** SBMV ****/
+
+/*!
+ * @brief Constructor for the Sbmv class. See blas2_trees.h for details on the
+ * parameters.
+ */
+template <typename lhs_t, typename matrix_t, typename vector_t, bool is_upper>
+SYCL_BLAS_INLINE Sbmv<lhs_t, matrix_t, vector_t, is_upper>::Sbmv(
+    lhs_t &_l, matrix_t &_matrix_a, vector_t &_vector_x, index_t _k,
+    value_t _alpha, value_t _beta)
+    : lhs_(_l),
+      matrix_a_(_matrix_a),
+      vector_x_(_vector_x),
+      k_(_k),
+      alpha_(_alpha),
+      beta_(_beta) {}
+
+template <typename lhs_t, typename matrix_t, typename vector_t, bool is_upper>
+SYCL_BLAS_INLINE typename Sbmv<lhs_t, matrix_t, vector_t, is_upper>::index_t
+Sbmv<lhs_t, matrix_t, vector_t, is_upper>::get_size() const {
+  return lhs_.get_size();
+}
+
+template <typename lhs_t, typename matrix_t, typename vector_t, bool is_upper>
+SYCL_BLAS_INLINE bool Sbmv<lhs_t, matrix_t, vector_t, is_upper>::valid_thread(
+    cl::sycl::nd_item<1> ndItem) const {
+  return ndItem.get_global_id(0) < get_size();
+}
+
+/*!
+ * @brief Computes the element i of y. The elements of the row i of A outside
+ * the stored triangle are read from their symmetric counterpart.
+ */
+template <typename lhs_t, typename matrix_t, typename vector_t, bool is_upper>
+SYCL_BLAS_INLINE typename Sbmv<lhs_t, matrix_t, vector_t, is_upper>::value_t
+Sbmv<lhs_t, matrix_t, vector_t, is_upper>::eval(index_t i) {
+  const index_t n = lhs_.get_size();
+  const index_t first = (i > k_) ? i - k_ : 0;
+  const index_t last = (i + k_ < n - 1) ? i + k_ : n - 1;
+
+  value_t sum = value_t{0};
+  for (index_t j = first; j <= last; j++) {
+    // (r, c) is the position of A(i, j) or A(j, i) in the stored triangle
+    const index_t r = is_upper ? cl::sycl::min(i, j) : cl::sycl::max(i, j);
+    const index_t c = is_upper ? cl::sycl::max(i, j) : cl::sycl::min(i, j);
+    const value_t a_elem =
+        is_upper ? matrix_a_.eval(k_ + r - c, c) : matrix_a_.eval(r - c, c);
+    sum = cl::sycl::mad(a_elem, vector_x_.eval(j), sum);
+  }
+
+  const value_t alpha_sum = alpha_ * sum;
+  lhs_.eval(i) = (beta_ == value_t{0})
+                     ? alpha_sum
+                     : cl::sycl::mad(beta_, lhs_.eval(i), alpha_sum);
+  return sum;
+}
+
+template <typename lhs_t, typename matrix_t, typename vector_t, bool is_upper>
+SYCL_BLAS_INLINE typename Sbmv<lhs_t, matrix_t, vector_t, is_upper>::value_t
+Sbmv<lhs_t, matrix_t, vector_t, is_upper>::eval(cl::sycl::nd_item<1> ndItem) {
+  return eval(ndItem.get_global_id(0));
+}
+
+template <typename lhs_t, typename matrix_t, typename vector_t, bool is_upper>
+SYCL_BLAS_INLINE void Sbmv<lhs_t, matrix_t, vector_t, is_upper>::bind(
+    cl::sycl::handler &h) {
+  lhs_.bind(h);
+  matrix_a_.bind(h);
+  vector_x_.bind(h);
+}
+
+template <typename lhs_t, typename matrix_t, typename vector_t, bool is_upper>
+SYCL_BLAS_INLINE void
+Sbmv<lhs_t, matrix_t, vector_t, is_upper>::adjust_access_displacement() {
+  lhs_.adjust_access_displacement();
+  matrix_a_.adjust_access_displacement();
+  vector_x_.adjust_access_displacement();
+}
+
+/**** TBMV ****/
+
+/*!
+ * @brief Constructor for the Tbmv class. See blas2_trees.h for details on the
+ * parameters.
+ */
+template <typename lhs_t, typename matrix_t, typename vector_t, bool is_upper,
+          bool is_transposed>
+SYCL_BLAS_INLINE
+Tbmv<lhs_t, matrix_t, vector_t, is_upper, is_transposed>::Tbmv(
+    lhs_t &_l, matrix_t &_matrix_a, vector_t &_vector_x, index_t _k,
+    bool _unit_diag)
+    : lhs_(_l),
+      matrix_a_(_matrix_a),
+      vector_x_(_vector_x),
+      k_(_k),
+      unit_diag_(_unit_diag) {}
+
+template <typename lhs_t, typename matrix_t, typename vector_t, bool is_upper,
+          bool is_transposed>
+SYCL_BLAS_INLINE typename Tbmv<lhs_t, matrix_t, vector_t, is_upper,
+                               is_transposed>::index_t
+Tbmv<lhs_t, matrix_t, vector_t, is_upper, is_transposed>::get_size() const {
+  return lhs_.get_size();
+}
+
+template <typename lhs_t, typename matrix_t, typename vector_t, bool is_upper,
+          bool is_transposed>
+SYCL_BLAS_INLINE bool
+Tbmv<lhs_t, matrix_t, vector_t, is_upper, is_transposed>::valid_thread(
+    cl::sycl::nd_item<1> ndItem) const {
+  return ndItem.get_global_id(0) < get_size();
+}
+
+/*!
+ * @brief Computes the element i of x from the copy of x. The row i of op(A)
+ * spans the k elements after the diagonal when op(A) is upper triangular, and
+ * the k elements before it otherwise.
+ */
+template <typename lhs_t, typename matrix_t, typename vector_t, bool is_upper,
+          bool is_transposed>
+SYCL_BLAS_INLINE typename Tbmv<lhs_t, matrix_t, vector_t, is_upper,
+                               is_transposed>::value_t
+Tbmv<lhs_t, matrix_t, vector_t, is_upper, is_transposed>::eval(index_t i) {
+  constexpr bool is_op_upper = is_upper != is_transposed;
+  const index_t n = lhs_.get_size();
+  const index_t first =
+      is_op_upper ? i + 1 : ((i > k_) ? i - k_ : index_t{0});
+  const index_t end = is_op_upper ? ((i + k_ < n) ? i + k_ + 1 : n) : i;
+
+  // Band storage row of the diagonal
+  const index_t diag_row = is_upper ? k_ : index_t{0};
+  value_t sum = unit_diag_ ? vector_x_.eval(i)
+                           : matrix_a_.eval(diag_row, i) * vector_x_.eval(i);
+  for (index_t j = first; j < end; j++) {
+    // (r, c) is the position of op(A)(i, j) in A
+    const index_t r = is_transposed ? j : i;
+    const index_t c = is_transposed ? i : j;
+    sum = cl::sycl::mad(matrix_a_.eval(diag_row + r - c, c), vector_x_.eval(j),
+                        sum);
+  }
+  lhs_.eval(i) = sum;
+  return sum;
+}
+
+template <typename lhs_t, typename matrix_t, typename vector_t, bool is_upper,
+          bool is_transposed>
+SYCL_BLAS_INLINE typename Tbmv<lhs_t, matrix_t, vector_t, is_upper,
+                               is_transposed>::value_t
+Tbmv<lhs_t, matrix_t, vector_t, is_upper, is_transposed>::eval(
+    cl::sycl::nd_item<1> ndItem) {
+  return eval(ndItem.get_global_id(0));
+}
+
+template <typename lhs_t, typename matrix_t, typename vector_t, bool is_upper,
+          bool is_transposed>
+SYCL_BLAS_INLINE void
+Tbmv<lhs_t, matrix_t, vector_t, is_upper, is_transposed>::bind(
+    cl::sycl::handler &h) {
+  lhs_.bind(h);
+  matrix_a_.bind(h);
+  vector_x_.bind(h);
+}
+
+template <typename lhs_t, typename matrix_t, typename vector_t, bool is_upper,
+          bool is_transposed>
+SYCL_BLAS_INLINE void Tbmv<lhs_t, matrix_t, vector_t, is_upper,
+                           is_transposed>::adjust_access_displacement() {
+  lhs_.adjust_access_displacement();
+  matrix_a_.adjust_access_displacement();
+  vector_x_.adjust_access_displacement();
+}
+
+/**** TBSV ****/
+
+/*!
+ * @brief Constructor for the Tbsv class. See blas2_trees.h for details on the
+ * parameters.
+ */
+template <typename lhs_t, typename matrix_t, uint32_t local_range,
+          bool is_upper, bool is_transposed>
+SYCL_BLAS_INLINE
+Tbsv<lhs_t, matrix_t, local_range, is_upper, is_transposed>::Tbsv(
+    lhs_t &_l, matrix_t &_matrix_a, index_t _k, bool _unit_diag)
+    : lhs_(_l), matrix_a_(_matrix_a), k_(_k), unit_diag_(_unit_diag) {}
+
+/*!
+ * @brief All the work items of the single work group take part in every row
+ */
+template <typename lhs_t, typename matrix_t, uint32_t local_range,
+          bool is_upper, bool is_transposed>
+SYCL_BLAS_INLINE bool
+Tbsv<lhs_t, matrix_t, local_range, is_upper, is_transposed>::valid_thread(
+    cl::sycl::nd_item<1>) const {
+  return true;
+}
+
+/*!
+ * @brief Solves the rows one after the other, by forward substitution when
+ * op(A) is lower triangular and by backward substitution otherwise.
+ */
+template <typename lhs_t, typename matrix_t, uint32_t local_range,
+          bool is_upper, bool is_transposed>
+template <typename local_memory_t>
+SYCL_BLAS_INLINE typename Tbsv<lhs_t, matrix_t, local_range, is_upper,
+                               is_transposed>::value_t
+Tbsv<lhs_t, matrix_t, local_range, is_upper, is_transposed>::eval(
+    local_memory_t local_mem, cl::sycl::nd_item<1> ndItem) {
+  constexpr bool is_op_upper = is_upper != is_transposed;
+  const index_t local_id = ndItem.get_local_id(0);
+  const index_t n = lhs_.get_size();
+  const index_t diag_row = is_upper ? k_ : index_t{0};
+  value_t *scratch = local_mem.localAcc.get_pointer();
+
+  for (index_t step = 0; step < n; step++) {
+    const index_t i = is_op_upper ? n - 1 - step : step;
+    // The already solved elements of x in the band of the row i of op(A)
+    const index_t first =
+        is_op_upper ? i + 1 : ((i > k_) ? i - k_ : index_t{0});
+    const index_t end = is_op_upper ? ((i + k_ < n) ? i + k_ + 1 : n) : i;
+
+    value_t sum = value_t{0};
+    for (index_t j = first + local_id; j < end; j += local_range) {
+      const index_t r = is_transposed ? j : i;
+      const index_t c = is_transposed ? i : j;
+      sum = cl::sycl::mad(matrix_a_.eval(diag_row + r - c, c), lhs_.eval(j),
+                          sum);
+    }
+    scratch[local_id] = sum;
+    ndItem.barrier(cl::sycl::access::fence_space::local_space);
+    for (index_t offset = local_range >> 1; offset > 0; offset >>= 1) {
+      if (local_id < offset) {
+        scratch[local_id] += scratch[local_id + offset];
+      }
+      ndItem.barrier(cl::sycl::access::fence_space::local_space);
+    }
+
+    // The element of the row is written to global memory, from which the
+    // other work items read it in the next rows
+    if (local_id == 0) {
+      const value_t rhs = lhs_.eval(i) - scratch[0];
+      lhs_.eval(i) = unit_diag_ ? rhs : rhs / matrix_a_.eval(diag_row, i);
+    }
+    ndItem.barrier(cl::sycl::access::fence_space::global_and_local);
+  }
+  return value_t{0};
+}
+
+template <typename lhs_t, typename matrix_t, uint32_t local_range,
+          bool is_upper, bool is_transposed>
+SYCL_BLAS_INLINE void
+Tbsv<lhs_t, matrix_t, local_range, is_upper, is_transposed>::bind(
+    cl::sycl::handler &h) {
+  lhs_.bind(h);
+  matrix_a_.bind(h);
+}
+
+template <typename lhs_t, typename matrix_t, uint32_t local_range,
+          bool is_upper, bool is_transposed>
+SYCL_BLAS_INLINE void Tbsv<lhs_t, matrix_t, local_range, is_upper,
+                           is_transposed>::adjust_access_displacement() {
+  lhs_.adjust_access_displacement();
+  matrix_a_.adjust_access_displacement();
+}
+
+}  // namespace blas
+#endif
@@ -26,6 +26,7 @@
 #ifndef GEMV_HPP
 #define GEMV_HPP
 #include "operations/blas2_trees.h"
+#include "operations/blas3_trees.h"
 #include "operations/blas_operators.hpp"
 #include "views/view_sycl.hpp"
 #include <stdexcept>
@@ -369,6 +370,419 @@ Gemv<lhs_t, matrix_t, vector_t, local_range, is_transposed, cache_line_size,
   vector_x_.adjust_access_displacement();
 }
 
+/*!
+ * @brief Constructor for the GemvSingleKernel class. See blas2_trees.h for
+ * details on the parameters.
+ */
+template <typename lhs_t, typename matrix_t, typename vector_t,
+          uint32_t local_range, uint32_t c_lanes, bool is_transposed>
+SYCL_BLAS_INLINE GemvSingleKernel<lhs_t, matrix_t, vector_t, local_range,
+                                  c_lanes, is_transposed>::
+    GemvSingleKernel(lhs_t &_l, matrix_t &_matrix_a, vector_t &_vector_x,
+                     value_t _alpha, value_t _beta)
+    : lhs_(_l),
+      matrix_a_(_matrix_a),
+      vector_x_(_vector_x),
+      alpha_(_alpha),
+      beta_(_beta) {}
+
+/*!
+ * @brief Number of work groups needed to cover the output vector
+ */
+template <typename lhs_t, typename matrix_t, typename vector_t,
+          uint32_t local_range, uint32_t c_lanes, bool is_transposed>
+SYCL_BLAS_INLINE typename GemvSingleKernel<lhs_t, matrix_t, vector_t,
+                                           local_range, c_lanes,
+                                           is_transposed>::index_t
+GemvSingleKernel<lhs_t, matrix_t, vector_t, local_range, c_lanes,
+                 is_transposed>::get_num_workgroups() const {
+  const index_t nc_dim =
+      is_transposed ? matrix_a_.get_size_col() : matrix_a_.get_size_row();
+  return (nc_dim + nc_per_wg - 1) / nc_per_wg;
+}
+
+/*!
+ * @brief All the work items take part in the reduction, the bounds are
+ * checked in the kernel itself
+ */
+template <typename lhs_t, typename matrix_t, typename vector_t,
+          uint32_t local_range, uint32_t c_lanes, bool is_transposed>
+SYCL_BLAS_INLINE bool
+GemvSingleKernel<lhs_t, matrix_t, vector_t, local_range, c_lanes,
+                 is_transposed>::valid_thread(cl::sycl::nd_item<1>) const {
+  return true;
+}
+
+/*!
+ * @brief The GEMV kernel, including the reduction of the partial dot products
+ * and the scaling by alpha and beta.
+ */
+template <typename lhs_t, typename matrix_t, typename vector_t,
+          uint32_t local_range, uint32_t c_lanes, bool is_transposed>
+template <typename local_memory_t>
+SYCL_BLAS_INLINE typename GemvSingleKernel<lhs_t, matrix_t, vector_t,
+                                           local_range, c_lanes,
+                                           is_transposed>::value_t
+GemvSingleKernel<lhs_t, matrix_t, vector_t, local_range, c_lanes,
+                 is_transposed>::eval(local_memory_t local_mem,
+                                      cl::sycl::nd_item<1> ndItem) {
+  const index_t local_id = ndItem.get_local_id(0);
+  const index_t group_id = ndItem.get_group(0);
+  const index_t lda = matrix_a_.getSizeL();
+  const index_t nc_dim =
+      is_transposed ? matrix_a_.get_size_col() : matrix_a_.get_size_row();
+  const index_t c_dim =
+      is_transposed ? matrix_a_.get_size_row() : matrix_a_.get_size_col();
+
+  // Neighbouring work items read neighbouring elements of the matrix: rows of
+  // the same column in the non transposed case, and elements of the same
+  // column (i.e. lanes of the same dot product) in the transposed case
+  const index_t nc_local_id =
+      is_transposed ? local_id / c_lanes : local_id % nc_per_wg;
+  const index_t lane_id =
+      is_transposed ? local_id % c_lanes : local_id / nc_per_wg;
+  const index_t nc_dim_index = nc_local_id + group_id * nc_per_wg;
+
+  // Partial dot product of the lane
+  value_t sum = value_t{0};
+  if (nc_dim_index < nc_dim) {
+    const index_t nc_stride = is_transposed ? lda : 1;
+    const index_t c_stride = is_transposed ? 1 : lda;
+    index_t mat_index = nc_dim_index * nc_stride + lane_id * c_stride;
+    for (index_t c_dim_index = lane_id; c_dim_index < c_dim;
+         c_dim_index += c_lanes) {
+      sum = cl::sycl::mad(matrix_a_.template eval<true>(mat_index),
+                          vector_x_.eval(c_dim_index), sum);
+      mat_index += c_lanes * c_stride;
+    }
+  }
+
+  // Tree reduction of the lanes of each dot product in local memory
+  value_t *scratch = local_mem.localAcc.get_pointer();
+  const index_t scratch_index = nc_local_id + lane_id * nc_per_wg;
+  scratch[scratch_index] = sum;
+#pragma unroll
+  for (index_t offset = c_lanes / 2; offset > 0; offset /= 2) {
+    ndItem.barrier(cl::sycl::access::fence_space::local_space);
+    if (lane_id < offset) {
+      sum = sum + scratch[scratch_index + offset * nc_per_wg];
+      scratch[scratch_index] = sum;
+    }
+  }
+
+  // y is only read when beta is not zero, as in the reference BLAS
+  if (lane_id == 0 && nc_dim_index < nc_dim) {
+    const value_t alpha_sum = alpha_ * sum;
+    lhs_.eval(nc_dim_index) =
+        (beta_ == value_t{0})
+            ? alpha_sum
+            : cl::sycl::mad(beta_, lhs_.eval(nc_dim_index), alpha_sum);
+  }
+  return sum;
+}
+
+template <typename lhs_t, typename matrix_t, typename vector_t,
+          uint32_t local_range, uint32_t c_lanes, bool is_transposed>
+SYCL_BLAS_INLINE void
+GemvSingleKernel<lhs_t, matrix_t, vector_t, local_range, c_lanes,
+                 is_transposed>::bind(cl::sycl::handler &h) {
+  lhs_.bind(h);
+  matrix_a_.bind(h);
+  vector_x_.bind(h);
+}
+
+template <typename lhs_t, typename matrix_t, typename vector_t,
+          uint32_t local_range, uint32_t c_lanes, bool is_transposed>
+SYCL_BLAS_INLINE void
+GemvSingleKernel<lhs_t, matrix_t, vector_t, local_range, c_lanes,
+                 is_transposed>::adjust_access_displacement() {
+  lhs_.adjust_access_displacement();
+  matrix_a_.adjust_access_displacement();
+  vector_x_.adjust_access_displacement();
+}
+
+/*!
+ * @brief Constructor for the GemvMultiRhs class. See blas2_trees.h for details
+ * on the parameters.
+ */
+template <typename lhs_t, typename matrix_t, typename rhs_t,
+          uint32_t local_range, uint32_t c_lanes, uint32_t n_rhs,
+          bool is_transposed>
+SYCL_BLAS_INLINE GemvMultiRhs<lhs_t, matrix_t, rhs_t, local_range, c_lanes,
+                              n_rhs, is_transposed>::
+    GemvMultiRhs(lhs_t &_l, matrix_t &_matrix_a, rhs_t &_matrix_x,
+                 value_t _alpha, value_t _beta)
+    : lhs_(_l),
+      matrix_a_(_matrix_a),
+      matrix_x_(_matrix_x),
+      alpha_(_alpha),
+      beta_(_beta) {}
+
+/*!
+ * @brief Number of work groups needed to cover the rows of Y
+ */
+template <typename lhs_t, typename matrix_t, typename rhs_t,
+          uint32_t local_range, uint32_t c_lanes, uint32_t n_rhs,
+          bool is_transposed>
+SYCL_BLAS_INLINE typename GemvMultiRhs<lhs_t, matrix_t, rhs_t, local_range,
+                                       c_lanes, n_rhs, is_transposed>::index_t
+GemvMultiRhs<lhs_t, matrix_t, rhs_t, local_range, c_lanes, n_rhs,
+             is_transposed>::get_num_workgroups() const {
+  const index_t nc_dim =
+      is_transposed ? matrix_a_.get_size_col() : matrix_a_.get_size_row();
+  return (nc_dim + nc_per_wg - 1) / nc_per_wg;
+}
+
+/*!
+ * @brief All the work items take part in the reduction, the bounds are
+ * checked in the kernel itself
+ */
+template <typename lhs_t, typename matrix_t, typename rhs_t,
+          uint32_t local_range, uint32_t c_lanes, uint32_t n_rhs,
+          bool is_transposed>
+SYCL_BLAS_INLINE bool
+GemvMultiRhs<lhs_t, matrix_t, rhs_t, local_range, c_lanes, n_rhs,
+             is_transposed>::valid_thread(cl::sycl::nd_item<1>) const {
+  return true;
+}
+
+/*!
+ * @brief The multi vector GEMV kernel. Each element of A is loaded once and
+ * multiplied by the matching element of every column of X.
+ */
+template <typename lhs_t, typename matrix_t, typename rhs_t,
+          uint32_t local_range, uint32_t c_lanes, uint32_t n_rhs,
+          bool is_transposed>
+template <typename local_memory_t>
+SYCL_BLAS_INLINE typename GemvMultiRhs<lhs_t, matrix_t, rhs_t, local_range,
+                                       c_lanes, n_rhs, is_transposed>::value_t
+GemvMultiRhs<lhs_t, matrix_t, rhs_t, local_range, c_lanes, n_rhs,
+             is_transposed>::eval(local_memory_t local_mem,
+                                  cl::sycl::nd_item<1> ndItem) {
+  const index_t local_id = ndItem.get_local_id(0);
+  const index_t group_id = ndItem.get_group(0);
+  const index_t lda = matrix_a_.getSizeL();
+  const index_t nc_dim =
+      is_transposed ? matrix_a_.get_size_col() : matrix_a_.get_size_row();
+  const index_t c_dim =
+      is_transposed ? matrix_a_.get_size_row() : matrix_a_.get_size_col();
+
+  // Same mapping of the work items as in GemvSingleKernel
+  const index_t nc_local_id =
+      is_transposed ? local_id / c_lanes : local_id % nc_per_wg;
+  const index_t lane_id =
+      is_transposed ? local_id % c_lanes : local_id / nc_per_wg;
+  const index_t nc_dim_index = nc_local_id + group_id * nc_per_wg;
+
+  // Partial dot products of the lane, one per vector
+  value_t sum[n_rhs];
+#pragma unroll
+  for (uint32_t r = 0; r < n_rhs; r++) {
+    sum[r] = value_t{0};
+  }
+  if (nc_dim_index < nc_dim) {
+    const index_t nc_stride = is_transposed ? lda : 1;
+    const index_t c_stride = is_transposed ? 1 : lda;
+    index_t mat_index = nc_dim_index * nc_stride + lane_id * c_stride;
+    for (index_t c_dim_index = lane_id; c_dim_index < c_dim;
+         c_dim_index += c_lanes) {
+      const value_t a = matrix_a_.template eval<true>(mat_index);
+#pragma unroll
+      for (uint32_t r = 0; r < n_rhs; r++) {
+        sum[r] = cl::sycl::mad(a, matrix_x_.eval(c_dim_index, r), sum[r]);
+      }
+      mat_index += c_lanes * c_stride;
+    }
+  }
+
+  // Tree reduction of the lanes in local memory, the partial sums of the
+  // vector r being stored at r * local_range
+  value_t *scratch = local_mem.localAcc.get_pointer();
+  const index_t scratch_index = nc_local_id + lane_id * nc_per_wg;
+#pragma unroll
+  for (uint32_t r = 0; r < n_rhs; r++) {
+    scratch[scratch_index + r * local_range] = sum[r];
+  }
+#pragma unroll
+  for (index_t offset = c_lanes / 2; offset > 0; offset /= 2) {
+    ndItem.barrier(cl::sycl::access::fence_space::local_space);
+    if (lane_id < offset) {
+#pragma unroll
+      for (uint32_t r = 0; r < n_rhs; r++) {
+        const index_t index = scratch_index + r * local_range;
+        sum[r] = sum[r] + scratch[index + offset * nc_per_wg];
+        scratch[index] = sum[r];
+      }
+    }
+  }
+
+  // Y is only read when beta is not zero, as in the reference BLAS
+  if (lane_id == 0 && nc_dim_index < nc_dim) {
+#pragma unroll
+    for (uint32_t r = 0; r < n_rhs; r++) {
+      const value_t alpha_sum = alpha_ * sum[r];
+      lhs_.eval(nc_dim_index, r) =
+          (beta_ == value_t{0})
+              ? alpha_sum
+              : cl::sycl::mad(beta_, lhs_.eval(nc_dim_index, r), alpha_sum);
+    }
+  }
+  return sum[0];
+}
+
+template <typename lhs_t, typename matrix_t, typename rhs_t,
+          uint32_t local_range, uint32_t c_lanes, uint32_t n_rhs,
+          bool is_transposed>
+SYCL_BLAS_INLINE void
+GemvMultiRhs<lhs_t, matrix_t, rhs_t, local_range, c_lanes, n_rhs,
+             is_transposed>::bind(cl::sycl::handler &h) {
+  lhs_.bind(h);
+  matrix_a_.bind(h);
+  matrix_x_.bind(h);
+}
+
+template <typename lhs_t, typename matrix_t, typename rhs_t,
+          uint32_t local_range, uint32_t c_lanes, uint32_t n_rhs,
+          bool is_transposed>
+SYCL_BLAS_INLINE void
+GemvMultiRhs<lhs_t, matrix_t, rhs_t, local_range, c_lanes, n_rhs,
+             is_transposed>::adjust_access_displacement() {
+  lhs_.adjust_access_displacement();
+  matrix_a_.adjust_access_displacement();
+  matrix_x_.adjust_access_displacement();
+}
+
+/*!
+ * @brief Constructor for the GemvBatched class. See blas2_trees.h for details
+ * on the parameters.
+ */
+template <typename lhs_t, typename matrix_t, typename vector_t,
+          bool is_transposed, int batch_type>
+SYCL_BLAS_INLINE
+GemvBatched<lhs_t, matrix_t, vector_t, is_transposed, batch_type>::GemvBatched(
+    lhs_t &_l, matrix_t &_matrix_a, vector_t &_vector_x, value_t _alpha,
+    value_t _beta, index_t _inc_x, index_t _inc_y, index_t _batch_size)
+    : lhs_(_l),
+      matrix_a_(_matrix_a),
+      vector_x_(_vector_x),
+      alpha_(_alpha),
+      beta_(_beta),
+      inc_x_(_inc_x),
+      inc_y_(_inc_y),
+      batch_size_(_batch_size) {}
+
+/*!
+ * @brief The number of elements of y in the whole batch, one per work item
+ */
+template <typename lhs_t, typename matrix_t, typename vector_t,
+          bool is_transposed, int batch_type>
+SYCL_BLAS_INLINE typename GemvBatched<lhs_t, matrix_t, vector_t, is_transposed,
+                                      batch_type>::index_t
+GemvBatched<lhs_t, matrix_t, vector_t, is_transposed, batch_type>::get_size()
+    const {
+  const index_t nc_dim =
+      is_transposed ? matrix_a_.get_size_col() : matrix_a_.get_size_row();
+  return nc_dim * batch_size_;
+}
+
+template <typename lhs_t, typename matrix_t, typename vector_t,
+          bool is_transposed, int batch_type>
+SYCL_BLAS_INLINE bool
+GemvBatched<lhs_t, matrix_t, vector_t, is_transposed, batch_type>::valid_thread(
+    cl::sycl::nd_item<1> ndItem) const {
+  return ndItem.get_global_id(0) < get_size();
+}
+
+/*!
+ * @brief Computes the element of y given by the index i, which enumerates the
+ * elements of the batch in memory order.
+ */
+template <typename lhs_t, typename matrix_t, typename vector_t,
+          bool is_transposed, int batch_type>
+SYCL_BLAS_INLINE typename GemvBatched<lhs_t, matrix_t, vector_t, is_transposed,
+                                      batch_type>::value_t
+GemvBatched<lhs_t, matrix_t, vector_t, is_transposed, batch_type>::eval(
+    index_t i) {
+  constexpr bool is_interleaved =
+      batch_type == static_cast<int>(gemm_batch_type_t::interleaved);
+  const index_t lda = matrix_a_.getSizeL();
+  const index_t rows = matrix_a_.get_size_row();
+  const index_t cols = matrix_a_.get_size_col();
+  const index_t nc_dim = is_transposed ? cols : rows;
+  const index_t c_dim = is_transposed ? rows : cols;
+
+  const index_t batch = is_interleaved ? i % batch_size_ : i / nc_dim;
+  const index_t nc_dim_index = is_interleaved ? i / batch_size_ : i % nc_dim;
+
+  // Element k of an item of the batch is stored at k * elem_stride, and the
+  // item b starts at b * batch_stride
+  const index_t elem_stride = is_interleaved ? batch_size_ : 1;
+  const index_t abs_inc_x = inc_x_ > 0 ? inc_x_ : -inc_x_;
+  const index_t abs_inc_y = inc_y_ > 0 ? inc_y_ : -inc_y_;
+  const index_t mat_batch_stride = is_interleaved ? 1 : lda * cols;
+  const index_t x_batch_stride = is_interleaved ? 1 : c_dim * abs_inc_x;
+  const index_t y_batch_stride = is_interleaved ? 1 : nc_dim * abs_inc_y;
+
+  // A negative increment walks the vector backwards from its last element
+  const index_t y_pos =
+      (inc_y_ > 0) ? nc_dim_index * inc_y_
+                   : (nc_dim - 1 - nc_dim_index) * abs_inc_y;
+  const index_t x_first = (inc_x_ > 0) ? 0 : (c_dim - 1) * abs_inc_x;
+
+  const index_t nc_stride = is_transposed ? lda : 1;
+  const index_t c_stride = is_transposed ? 1 : lda;
+  index_t mat_index =
+      nc_dim_index * nc_stride * elem_stride + batch * mat_batch_stride;
+  index_t x_index = x_first * elem_stride + batch * x_batch_stride;
+  const index_t mat_step = c_stride * elem_stride;
+  const index_t x_step = inc_x_ * elem_stride;
+
+  value_t sum = value_t{0};
+  for (index_t c_dim_index = 0; c_dim_index < c_dim; c_dim_index++) {
+    sum = cl::sycl::mad(matrix_a_.template eval<true>(mat_index),
+                        vector_x_.template eval<true>(x_index), sum);
+    mat_index += mat_step;
+    x_index += x_step;
+  }
+
+  // y is only read when beta is not zero, as in the reference BLAS
+  const index_t y_index = y_pos * elem_stride + batch * y_batch_stride;
+  const value_t alpha_sum = alpha_ * sum;
+  lhs_.template eval<true>(y_index) =
+      (beta_ == value_t{0})
+          ? alpha_sum
+          : cl::sycl::mad(beta_, lhs_.template eval<true>(y_index), alpha_sum);
+  return sum;
+}
+
+template <typename lhs_t, typename matrix_t, typename vector_t,
+          bool is_transposed, int batch_type>
+SYCL_BLAS_INLINE typename GemvBatched<lhs_t, matrix_t, vector_t, is_transposed,
+                                      batch_type>::value_t
+GemvBatched<lhs_t, matrix_t, vector_t, is_transposed, batch_type>::eval(
+    cl::sycl::nd_item<1> ndItem) {
+  return eval(ndItem.get_global_id(0));
+}
+
+template <typename lhs_t, typename matrix_t, typename vector_t,
+          bool is_transposed, int batch_type>
+SYCL_BLAS_INLINE void
+GemvBatched<lhs_t, matrix_t, vector_t, is_transposed, batch_type>::bind(
+    cl::sycl::handler &h) {
+  lhs_.bind(h);
+  matrix_a_.bind(h);
+  vector_x_.bind(h);
+}
+
+template <typename lhs_t, typename matrix_t, typename vector_t,
+          bool is_transposed, int batch_type>
+SYCL_BLAS_INLINE void GemvBatched<lhs_t, matrix_t, vector_t, is_transposed,
+                                  batch_type>::adjust_access_displacement() {
+  lhs_.adjust_access_displacement();
+  matrix_a_.adjust_access_displacement();
+  vector_x_.adjust_access_displacement();
+}
+
 /**** GEMV BY ROWS M ROWS x N BLOCK ****/
 /**
  * @struct GemvRow
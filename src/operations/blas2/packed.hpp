@@ -0,0 +1,205 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename packed.hpp
+ *
+ **************************************************************************/
+
+#ifndef PACKED_HPP
+#define PACKED_HPP
+#include "operations/blas2_trees.h"
+#include "views/view_sycl.hpp"
+namespace blas {
+
+/*!
+ * @brief Position of the element (r, c) of the stored triangle of an n x n
+ * matrix in packed format, with r <= c for the upper triangle and r >= c for
+ * the lower one.
+ */
+template <bool is_upper, typename index_t>
+SYCL_BLAS_INLINE index_t packed_index(index_t r, index_t c, index_t n) {
+  return is_upper ? r + (c * (c + 1)) / 2 : r + (c * (2 * n - c - 1)) / 2;
+}
+
+/**** SPMV ****/
+
+/*!
+ * @brief Constructor for the Spmv class. See blas2_trees.h for details on the
+ * parameters.
+ */
+template <typename lhs_t, typename matrix_t, typename vector_t, bool is_upper>
+SYCL_BLAS_INLINE Spmv<lhs_t, matrix_t, vector_t, is_upper>::Spmv(
+    lhs_t &_l, matrix_t &_matrix_a, vector_t &_vector_x, value_t _alpha,
+    value_t _beta)
+    : lhs_(_l),
+      matrix_a_(_matrix_a),
+      vector_x_(_vector_x),
+      alpha_(_alpha),
+      beta_(_beta) {}
+
+template <typename lhs_t, typename matrix_t, typename vector_t, bool is_upper>
+SYCL_BLAS_INLINE typename Spmv<lhs_t, matrix_t, vector_t, is_upper>::index_t
+Spmv<lhs_t, matrix_t, vector_t, is_upper>::get_size() const {
+  return lhs_.get_size();
+}
+
+template <typename lhs_t, typename matrix_t, typename vector_t, bool is_upper>
+SYCL_BLAS_INLINE bool Spmv<lhs_t, matrix_t, vector_t, is_upper>::valid_thread(
+    cl::sycl::nd_item<1> ndItem) const {
+  return ndItem.get_global_id(0) < get_size();
+}
+
+/*!
+ * @brief Computes the element i of y. The elements of the row i of A outside
+ * the stored triangle are read from their symmetric counterpart.
+ */
+template <typename lhs_t, typename matrix_t, typename vector_t, bool is_upper>
+SYCL_BLAS_INLINE typename Spmv<lhs_t, matrix_t, vector_t, is_upper>::value_t
+Spmv<lhs_t, matrix_t, vector_t, is_upper>::eval(index_t i) {
+  const index_t n = lhs_.get_size();
+  value_t sum = value_t{0};
+  for (index_t j = 0; j < n; j++) {
+    const index_t r = is_upper ? cl::sycl::min(i, j) : cl::sycl::max(i, j);
+    const index_t c = is_upper ? cl::sycl::max(i, j) : cl::sycl::min(i, j);
+    sum = cl::sycl::mad(matrix_a_.eval(packed_index<is_upper>(r, c, n)),
+                        vector_x_.eval(j), sum);
+  }
+
+  // y is only read when beta is not zero, as in the reference BLAS
+  const value_t alpha_sum = alpha_ * sum;
+  lhs_.eval(i) = (beta_ == value_t{0})
+                     ? alpha_sum
+                     : cl::sycl::mad(beta_, lhs_.eval(i), alpha_sum);
+  return sum;
+}
+
+template <typename lhs_t, typename matrix_t, typename vector_t, bool is_upper>
+SYCL_BLAS_INLINE typename Spmv<lhs_t, matrix_t, vector_t, is_upper>::value_t
+Spmv<lhs_t, matrix_t, vector_t, is_upper>::eval(cl::sycl::nd_item<1> ndItem) {
+  return eval(ndItem.get_global_id(0));
+}
+
+template <typename lhs_t, typename matrix_t, typename vector_t, bool is_upper>
+SYCL_BLAS_INLINE void Spmv<lhs_t, matrix_t, vector_t, is_upper>::bind(
+    cl::sycl::handler &h) {
+  lhs_.bind(h);
+  matrix_a_.bind(h);
+  vector_x_.bind(h);
+}
+
+template <typename lhs_t, typename matrix_t, typename vector_t, bool is_upper>
+SYCL_BLAS_INLINE void
+Spmv<lhs_t, matrix_t, vector_t, is_upper>::adjust_access_displacement() {
+  lhs_.adjust_access_displacement();
+  matrix_a_.adjust_access_displacement();
+  vector_x_.adjust_access_displacement();
+}
+
+/**** TPMV ****/
+
+/*!
+ * @brief Constructor for the Tpmv class. See blas2_trees.h for details on the
+ * parameters.
+ */
+template <typename lhs_t, typename matrix_t, typename vector_t, bool is_upper,
+          bool is_transposed>
+SYCL_BLAS_INLINE
+Tpmv<lhs_t, matrix_t, vector_t, is_upper, is_transposed>::Tpmv(
+    lhs_t &_l, matrix_t &_matrix_a, vector_t &_vector_x, bool _unit_diag)
+    : lhs_(_l),
+      matrix_a_(_matrix_a),
+      vector_x_(_vector_x),
+      unit_diag_(_unit_diag) {}
+
+template <typename lhs_t, typename matrix_t, typename vector_t, bool is_upper,
+          bool is_transposed>
+SYCL_BLAS_INLINE typename Tpmv<lhs_t, matrix_t, vector_t, is_upper,
+                               is_transposed>::index_t
+Tpmv<lhs_t, matrix_t, vector_t, is_upper, is_transposed>::get_size() const {
+  return lhs_.get_size();
+}
+
+template <typename lhs_t, typename matrix_t, typename vector_t, bool is_upper,
+          bool is_transposed>
+SYCL_BLAS_INLINE bool
+Tpmv<lhs_t, matrix_t, vector_t, is_upper, is_transposed>::valid_thread(
+    cl::sycl::nd_item<1> ndItem) const {
+  return ndItem.get_global_id(0) < get_size();
+}
+
+/*!
+ * @brief Computes the element i of x from the copy of x, over the part of the
+ * row i of op(A) inside the triangle.
+ */
+template <typename lhs_t, typename matrix_t, typename vector_t, bool is_upper,
+          bool is_transposed>
+SYCL_BLAS_INLINE typename Tpmv<lhs_t, matrix_t, vector_t, is_upper,
+                               is_transposed>::value_t
+Tpmv<lhs_t, matrix_t, vector_t, is_upper, is_transposed>::eval(index_t i) {
+  constexpr bool is_op_upper = is_upper != is_transposed;
+  const index_t n = lhs_.get_size();
+  const index_t first = is_op_upper ? i + 1 : index_t{0};
+  const index_t end = is_op_upper ? n : i;
+
+  value_t sum = unit_diag_ ? vector_x_.eval(i)
+                           : matrix_a_.eval(packed_index<is_upper>(i, i, n)) *
+                                 vector_x_.eval(i);
+  for (index_t j = first; j < end; j++) {
+    // (r, c) is the position of op(A)(i, j) in A
+    const index_t r = is_transposed ? j : i;
+    const index_t c = is_transposed ? i : j;
+    sum = cl::sycl::mad(matrix_a_.eval(packed_index<is_upper>(r, c, n)),
+                        vector_x_.eval(j), sum);
+  }
+  lhs_.eval(i) = sum;
+  return sum;
+}
+
+template <typename lhs_t, typename matrix_t, typename vector_t, bool is_upper,
+          bool is_transposed>
+SYCL_BLAS_INLINE typename Tpmv<lhs_t, matrix_t, vector_t, is_upper,
+                               is_transposed>::value_t
+Tpmv<lhs_t, matrix_t, vector_t, is_upper, is_transposed>::eval(
+    cl::sycl::nd_item<1> ndItem) {
+  return eval(ndItem.get_global_id(0));
+}
+
+template <typename lhs_t, typename matrix_t, typename vector_t, bool is_upper,
+          bool is_transposed>
+SYCL_BLAS_INLINE void
+Tpmv<lhs_t, matrix_t, vector_t, is_upper, is_transposed>::bind(
+    cl::sycl::handler &h) {
+  lhs_.bind(h);
+  matrix_a_.bind(h);
+  vector_x_.bind(h);
+}
+
+template <typename lhs_t, typename matrix_t, typename vector_t, bool is_upper,
+          bool is_transposed>
+SYCL_BLAS_INLINE void Tpmv<lhs_t, matrix_t, vector_t, is_upper,
+                           is_transposed>::adjust_access_displacement() {
+  lhs_.adjust_access_displacement();
+  matrix_a_.adjust_access_displacement();
+  vector_x_.adjust_access_displacement();
+}
+
+}  // namespace blas
+#endif
@@ -0,0 +1,178 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename symv.hpp
+ *
+ **************************************************************************/
+
+#ifndef SYMV_HPP
+#define SYMV_HPP
+#include "operations/blas2_trees.h"
+#include "views/view_sycl.hpp"
+namespace blas {
+
+/*!
+ * @brief Constructor for the Symv class. See blas2_trees.h for details on the
+ * parameters.
+ */
+template <typename lhs_t, typename matrix_t, typename vector_t,
+          uint32_t tile_size, bool is_upper>
+SYCL_BLAS_INLINE Symv<lhs_t, matrix_t, vector_t, tile_size, is_upper>::Symv(
+    lhs_t &_l, matrix_t &_matrix_a, vector_t &_vector_x)
+    : lhs_(_l), matrix_a_(_matrix_a), vector_x_(_vector_x) {}
+
+/*!
+ * @brief Number of tiles in each dimension of the matrix. The kernel is
+ * launched with one work group per tile of the whole matrix, and the work
+ * groups of the tiles outside the stored triangle exit immediately.
+ */
+template <typename lhs_t, typename matrix_t, typename vector_t,
+          uint32_t tile_size, bool is_upper>
+SYCL_BLAS_INLINE
+    typename Symv<lhs_t, matrix_t, vector_t, tile_size, is_upper>::index_t
+    Symv<lhs_t, matrix_t, vector_t, tile_size, is_upper>::get_num_tiles()
+        const {
+  return (matrix_a_.get_size_row() + tile_size - 1) / tile_size;
+}
+
+/*!
+ * @brief All the work items take part in the load of the tile, the bounds are
+ * checked in the kernel itself
+ */
+template <typename lhs_t, typename matrix_t, typename vector_t,
+          uint32_t tile_size, bool is_upper>
+SYCL_BLAS_INLINE bool
+Symv<lhs_t, matrix_t, vector_t, tile_size, is_upper>::valid_thread(
+    cl::sycl::nd_item<1>) const {
+  return true;
+}
+
+/*!
+ * @brief Loads a tile of the stored triangle and the two matching blocks of x
+ * in local memory, and writes the row and transposed products of the tile.
+ */
+template <typename lhs_t, typename matrix_t, typename vector_t,
+          uint32_t tile_size, bool is_upper>
+template <typename local_memory_t>
+SYCL_BLAS_INLINE
+    typename Symv<lhs_t, matrix_t, vector_t, tile_size, is_upper>::value_t
+    Symv<lhs_t, matrix_t, vector_t, tile_size, is_upper>::eval(
+        local_memory_t local_mem, cl::sycl::nd_item<1> ndItem) {
+  const index_t local_id = ndItem.get_local_id(0);
+  const index_t group_id = ndItem.get_group(0);
+  const index_t n = matrix_a_.get_size_row();
+  const index_t num_tiles = get_num_tiles();
+  const index_t tile_row = group_id % num_tiles;
+  const index_t tile_col = group_id / num_tiles;
+
+  // The condition is uniform across the work group
+  if (is_upper ? tile_row > tile_col : tile_row < tile_col) {
+    return value_t{0};
+  }
+  const bool is_diagonal = tile_row == tile_col;
+  const index_t row_offset = tile_row * tile_size;
+  const index_t col_offset = tile_col * tile_size;
+
+  // The tile is padded by one element per column to avoid bank conflicts when
+  // it is read by rows
+  constexpr index_t ld_tile = tile_size + 1;
+  value_t *tile = local_mem.localAcc.get_pointer();
+  value_t *x_row = tile + tile_size * ld_tile;
+  value_t *x_col = x_row + tile_size;
+
+  // Neighbouring work items load neighbouring rows of the same column. Out of
+  // bounds elements and the unstored half of a diagonal tile are set to zero
+  for (index_t idx = local_id; idx < tile_size * tile_size;
+       idx += local_range) {
+    const index_t r = idx % tile_size;
+    const index_t c = idx / tile_size;
+    const index_t row = row_offset + r;
+    const index_t col = col_offset + c;
+    const bool is_stored = !is_diagonal || (is_upper ? r <= c : r >= c);
+    tile[r + c * ld_tile] = (row < n && col < n && is_stored)
+                                ? matrix_a_.eval(row, col)
+                                : value_t{0};
+  }
+  {
+    const bool loads_row_block = local_id < tile_size;
+    const index_t idx = loads_row_block ? local_id : local_id - tile_size;
+    const index_t pos = (loads_row_block ? row_offset : col_offset) + idx;
+    (loads_row_block ? x_row : x_col)[idx] =
+        pos < n ? vector_x_.eval(pos) : value_t{0};
+  }
+  ndItem.barrier(cl::sycl::access::fence_space::local_space);
+
+  // A diagonal tile is mirrored to hold the full symmetric block
+  if (is_diagonal) {
+    for (index_t idx = local_id; idx < tile_size * tile_size;
+         idx += local_range) {
+      const index_t r = idx % tile_size;
+      const index_t c = idx / tile_size;
+      if (is_upper ? r > c : r < c) {
+        tile[r + c * ld_tile] = tile[c + r * ld_tile];
+      }
+    }
+    ndItem.barrier(cl::sycl::access::fence_space::local_space);
+  }
+
+  value_t sum = value_t{0};
+  if (local_id < tile_size) {
+    // Row product, written to the column tile_col of the block tile_row
+    const index_t r = local_id;
+    for (index_t c = 0; c < tile_size; c++) {
+      sum = cl::sycl::mad(tile[r + c * ld_tile], x_col[c], sum);
+    }
+    if (row_offset + r < n) {
+      lhs_.eval(row_offset + r, tile_col) = sum;
+    }
+  } else if (!is_diagonal) {
+    // Transposed product, written to the column tile_row of the block tile_col
+    const index_t c = local_id - tile_size;
+    for (index_t r = 0; r < tile_size; r++) {
+      sum = cl::sycl::mad(tile[r + c * ld_tile], x_row[r], sum);
+    }
+    if (col_offset + c < n) {
+      lhs_.eval(col_offset + c, tile_row) = sum;
+    }
+  }
+  return sum;
+}
+
+template <typename lhs_t, typename matrix_t, typename vector_t,
+          uint32_t tile_size, bool is_upper>
+SYCL_BLAS_INLINE void Symv<lhs_t, matrix_t, vector_t, tile_size,
+                           is_upper>::bind(cl::sycl::handler &h) {
+  lhs_.bind(h);
+  matrix_a_.bind(h);
+  vector_x_.bind(h);
+}
+
+template <typename lhs_t, typename matrix_t, typename vector_t,
+          uint32_t tile_size, bool is_upper>
+SYCL_BLAS_INLINE void Symv<lhs_t, matrix_t, vector_t, tile_size,
+                           is_upper>::adjust_access_displacement() {
+  lhs_.adjust_access_displacement();
+  matrix_a_.adjust_access_displacement();
+  vector_x_.adjust_access_displacement();
+}
+
+}  // namespace blas
+#endif
@@ -0,0 +1,180 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename trsv.hpp
+ *
+ **************************************************************************/
+
+#ifndef TRSV_HPP
+#define TRSV_HPP
+#include "operations/blas2_trees.h"
+#include "views/view_sycl.hpp"
+namespace blas {
+
+/*!
+ * @brief Constructor for the TrsvBlock class. See blas2_trees.h for details on
+ * the parameters.
+ */
+template <typename lhs_t, typename matrix_t, typename vector_t,
+          uint32_t block_size, uint32_t local_range, bool is_upper,
+          bool is_transposed>
+SYCL_BLAS_INLINE TrsvBlock<lhs_t, matrix_t, vector_t, block_size, local_range,
+                           is_upper, is_transposed>::
+    TrsvBlock(lhs_t &_l, matrix_t &_matrix_a, matrix_t &_inv_a,
+              vector_t &_vector_b, index_t _block)
+    : lhs_(_l),
+      matrix_a_(_matrix_a),
+      inv_a_(_inv_a),
+      vector_b_(_vector_b),
+      block_(_block) {}
+
+/*!
+ * @brief Rows of the right hand side updated with the solution of the block.
+ * They follow the block when op(A) is lower triangular, and precede it
+ * otherwise.
+ */
+template <typename lhs_t, typename matrix_t, typename vector_t,
+          uint32_t block_size, uint32_t local_range, bool is_upper,
+          bool is_transposed>
+SYCL_BLAS_INLINE void
+TrsvBlock<lhs_t, matrix_t, vector_t, block_size, local_range, is_upper,
+          is_transposed>::get_update_range(index_t &first, index_t &end) const {
+  constexpr bool is_op_upper = is_upper != is_transposed;
+  const index_t n = vector_b_.get_size();
+  const index_t block_first = block_ * static_cast<index_t>(block_size);
+  const index_t block_end =
+      cl::sycl::min(block_first + static_cast<index_t>(block_size), n);
+  first = is_op_upper ? index_t{0} : block_end;
+  end = is_op_upper ? block_first : n;
+}
+
+/*!
+ * @brief Number of work groups to launch, at least one to solve the block even
+ * when no row is left to update.
+ */
+template <typename lhs_t, typename matrix_t, typename vector_t,
+          uint32_t block_size, uint32_t local_range, bool is_upper,
+          bool is_transposed>
+SYCL_BLAS_INLINE typename TrsvBlock<lhs_t, matrix_t, vector_t, block_size,
+                                    local_range, is_upper,
+                                    is_transposed>::index_t
+TrsvBlock<lhs_t, matrix_t, vector_t, block_size, local_range, is_upper,
+          is_transposed>::get_num_workgroups() const {
+  index_t first;
+  index_t end;
+  get_update_range(first, end);
+  const index_t num_rows = end - first;
+  const index_t wg_size = static_cast<index_t>(local_range);
+  return num_rows > 0 ? (num_rows + wg_size - 1) / wg_size : index_t{1};
+}
+
+/*!
+ * @brief All the work items take part in the solve of the block, the bounds
+ * of the update are checked in the kernel itself
+ */
+template <typename lhs_t, typename matrix_t, typename vector_t,
+          uint32_t block_size, uint32_t local_range, bool is_upper,
+          bool is_transposed>
+SYCL_BLAS_INLINE bool
+TrsvBlock<lhs_t, matrix_t, vector_t, block_size, local_range, is_upper,
+          is_transposed>::valid_thread(cl::sycl::nd_item<1>) const {
+  return true;
+}
+
+template <typename lhs_t, typename matrix_t, typename vector_t,
+          uint32_t block_size, uint32_t local_range, bool is_upper,
+          bool is_transposed>
+template <typename local_memory_t>
+SYCL_BLAS_INLINE typename TrsvBlock<lhs_t, matrix_t, vector_t, block_size,
+                                    local_range, is_upper,
+                                    is_transposed>::value_t
+TrsvBlock<lhs_t, matrix_t, vector_t, block_size, local_range, is_upper,
+          is_transposed>::eval(local_memory_t local_mem,
+                               cl::sycl::nd_item<1> ndItem) {
+  const index_t local_id = ndItem.get_local_id(0);
+  const index_t n = vector_b_.get_size();
+  const index_t block_first = block_ * static_cast<index_t>(block_size);
+  const index_t current_block_size =
+      cl::sycl::min(static_cast<index_t>(block_size), n - block_first);
+  value_t *x_block = local_mem.localAcc.get_pointer();
+
+  // Solution of the block: x = inv(op(A_bb)) * b, with
+  // inv(A_bb^T) = inv(A_bb)^T. The inverse of the diagonal block is stored in
+  // the columns block_first to block_first + block_size of inv_a_
+  if (local_id < block_size) {
+    value_t sum = value_t{0};
+    for (index_t j = 0; j < current_block_size; j++) {
+      const value_t inv_elem =
+          is_transposed ? inv_a_.eval(j, block_first + local_id)
+                        : inv_a_.eval(local_id, block_first + j);
+      sum = cl::sycl::mad(inv_elem, vector_b_.eval(block_first + j), sum);
+    }
+    x_block[local_id] = sum;
+    if (ndItem.get_group(0) == 0 && local_id < current_block_size) {
+      lhs_.eval(block_first + local_id) = sum;
+    }
+  }
+  ndItem.barrier(cl::sycl::access::fence_space::local_space);
+
+  // GEMV update of the rows of the right hand side that remain to be solved
+  index_t first;
+  index_t end;
+  get_update_range(first, end);
+  const index_t row = first + ndItem.get_global_id(0);
+  value_t sum = value_t{0};
+  if (row < end) {
+    for (index_t j = 0; j < current_block_size; j++) {
+      const value_t a_elem = is_transposed
+                                 ? matrix_a_.eval(block_first + j, row)
+                                 : matrix_a_.eval(row, block_first + j);
+      sum = cl::sycl::mad(a_elem, x_block[j], sum);
+    }
+    vector_b_.eval(row) -= sum;
+  }
+  return sum;
+}
+
+template <typename lhs_t, typename matrix_t, typename vector_t,
+          uint32_t block_size, uint32_t local_range, bool is_upper,
+          bool is_transposed>
+SYCL_BLAS_INLINE void
+TrsvBlock<lhs_t, matrix_t, vector_t, block_size, local_range, is_upper,
+          is_transposed>::bind(cl::sycl::handler &h) {
+  lhs_.bind(h);
+  matrix_a_.bind(h);
+  inv_a_.bind(h);
+  vector_b_.bind(h);
+}
+
+template <typename lhs_t, typename matrix_t, typename vector_t,
+          uint32_t block_size, uint32_t local_range, bool is_upper,
+          bool is_transposed>
+SYCL_BLAS_INLINE void
+TrsvBlock<lhs_t, matrix_t, vector_t, block_size, local_range, is_upper,
+          is_transposed>::adjust_access_displacement() {
+  lhs_.adjust_access_displacement();
+  matrix_a_.adjust_access_displacement();
+  inv_a_.adjust_access_displacement();
+  vector_b_.adjust_access_displacement();
+}
+
+}  // namespace blas
+#endif
@@ -26,7 +26,11 @@
 #ifndef SYCL_BLAS_BLAS2_TREES_HPP
 #define SYCL_BLAS_BLAS2_TREES_HPP
 
+#include "blas2/banded.hpp"
 #include "blas2/gemv.hpp"
 #include "blas2/ger.hpp"
+#include "blas2/packed.hpp"
+#include "blas2/symv.hpp"
+#include "blas2/trsv.hpp"
 
 #endif  // BLAS2_TREES_HPP
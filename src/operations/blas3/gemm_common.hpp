@@ -25,6 +25,7 @@
 #ifndef SYCL_BLAS_BLAS3_GEMM_COMMON_HPP
 #define SYCL_BLAS_BLAS3_GEMM_COMMON_HPP
 
+#include "gemm_epilogue.hpp"
 #include "operations/blas3_trees.h"
 #include "views/view.h"
 #include <CL/sycl.hpp>
@@ -46,6 +47,7 @@ struct type_string {
 
 ENABLE_TYPE_STRING(float)
 ENABLE_TYPE_STRING(double)
+ENABLE_TYPE_STRING(int32_t)
 
 #undef ENABLE_TYPE_STRING
 
@@ -87,6 +89,27 @@ SYCL_BLAS_INLINE bool do_check<false>(bool) {
   return true;
 }
 
+/*!
+ * Multiply-add used by the inner loops of the GEMM kernels.
+ *
+ * @note cl::sycl::mad is only defined for floating point types, integer
+ *       GEMMs (e.g. int8 inputs accumulated in int32) use a plain
+ *       multiply-add instead.
+ */
+template <typename value_t>
+SYCL_BLAS_INLINE
+    typename std::enable_if<!std::is_integral<value_t>::value, value_t>::type
+    gemm_mad(value_t a, value_t b, value_t c) {
+  return cl::sycl::mad(a, b, c);
+}
+
+template <typename value_t>
+SYCL_BLAS_INLINE
+    typename std::enable_if<std::is_integral<value_t>::value, value_t>::type
+    gemm_mad(value_t a, value_t b, value_t c) {
+  return a * b + c;
+}
+
 }  // namespace blas
 
 #endif  // SYCL_BLAS_BLAS3_GEMM_COMMON_HPP
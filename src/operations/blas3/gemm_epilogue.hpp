@@ -0,0 +1,202 @@
+/***************************************************************************
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename gemm_epilogue.hpp
+ *
+ **************************************************************************/
+
+#ifndef SYCL_BLAS_BLAS3_GEMM_EPILOGUE_HPP
+#define SYCL_BLAS_BLAS3_GEMM_EPILOGUE_HPP
+
+#include "operations/blas3_trees.h"
+#include "views/view.h"
+#include <CL/sycl.hpp>
+#include <limits>
+
+namespace blas {
+
+template <typename value_t, typename index_t>
+SYCL_BLAS_INLINE value_t GemmNoEpilogue::apply(value_t value, index_t,
+                                               index_t) {
+  return value;
+}
+
+SYCL_BLAS_INLINE void GemmNoEpilogue::bind(cl::sycl::handler &) {}
+
+SYCL_BLAS_INLINE void GemmNoEpilogue::adjust_access_displacement() {}
+
+template <typename value_t, typename index_t>
+SYCL_BLAS_INLINE value_t GemmSplitK::apply(value_t value, index_t, index_t) {
+  return value;
+}
+
+SYCL_BLAS_INLINE void GemmSplitK::bind(cl::sycl::handler &) {}
+
+SYCL_BLAS_INLINE void GemmSplitK::adjust_access_displacement() {}
+
+/*!
+ * @brief Applies the activation selected by the template parameter.
+ */
+template <int Activation>
+struct GemmActivation {
+  template <typename value_t>
+  static SYCL_BLAS_INLINE value_t eval(value_t value, value_t, value_t) {
+    return value;
+  }
+};
+
+template <>
+struct GemmActivation<static_cast<int>(gemm_activation_t::relu)> {
+  template <typename value_t>
+  static SYCL_BLAS_INLINE value_t eval(value_t value, value_t, value_t) {
+    return cl::sycl::max(value, value_t{0});
+  }
+};
+
+template <>
+struct GemmActivation<static_cast<int>(gemm_activation_t::clamp)> {
+  template <typename value_t>
+  static SYCL_BLAS_INLINE value_t eval(value_t value, value_t lower,
+                                       value_t upper) {
+    return cl::sycl::min(cl::sycl::max(value, lower), upper);
+  }
+};
+
+template <>
+struct GemmActivation<static_cast<int>(gemm_activation_t::gelu)> {
+  // 0.5 * x * (1 + tanh(sqrt(2 / pi) * (x + 0.044715 * x^3)))
+  template <typename value_t>
+  static SYCL_BLAS_INLINE value_t eval(value_t value, value_t, value_t) {
+    const value_t sqrt_2_over_pi = value_t{0.7978845608028654};
+    const value_t inner =
+        sqrt_2_over_pi * (value + value_t{0.044715} * value * value * value);
+    return value_t{0.5} * value * (value_t{1} + cl::sycl::tanh(inner));
+  }
+};
+
+template <int Activation, typename vector_t, typename matrix_t>
+SYCL_BLAS_INLINE GemmEpilogue<Activation, vector_t, matrix_t>::GemmEpilogue(
+    vector_t bias, matrix_t residual, gemm_bias_t bias_type,
+    value_t residual_scale, value_t lower, value_t upper)
+    : bias_(bias),
+      residual_(residual),
+      bias_type_(static_cast<int>(bias_type)),
+      residual_scale_(residual_scale),
+      lower_(lower),
+      upper_(upper) {}
+
+template <int Activation, typename vector_t, typename matrix_t>
+template <typename idx_t>
+SYCL_BLAS_INLINE typename GemmEpilogue<Activation, vector_t, matrix_t>::value_t
+GemmEpilogue<Activation, vector_t, matrix_t>::apply(value_t value, idx_t row,
+                                                    idx_t col) {
+  if (bias_type_ == static_cast<int>(gemm_bias_t::row)) {
+    value += bias_.eval(static_cast<index_t>(row));
+  } else if (bias_type_ == static_cast<int>(gemm_bias_t::column)) {
+    value += bias_.eval(static_cast<index_t>(col));
+  }
+  if (residual_scale_ != value_t{0}) {
+    value += residual_scale_ * residual_.eval(static_cast<index_t>(row),
+                                              static_cast<index_t>(col));
+  }
+  return GemmActivation<Activation>::eval(value, lower_, upper_);
+}
+
+template <int Activation, typename vector_t, typename matrix_t>
+SYCL_BLAS_INLINE void GemmEpilogue<Activation, vector_t, matrix_t>::bind(
+    cl::sycl::handler &h) {
+  bias_.bind(h);
+  residual_.bind(h);
+}
+
+template <int Activation, typename vector_t, typename matrix_t>
+SYCL_BLAS_INLINE void GemmEpilogue<Activation, vector_t,
+                                   matrix_t>::adjust_access_displacement() {
+  bias_.adjust_access_displacement();
+  residual_.adjust_access_displacement();
+}
+
+template <typename out_value_t>
+SYCL_BLAS_INLINE GemmRequantize<out_value_t>::GemmRequantize(float scale,
+                                                             int32_t zero_point)
+    : scale_(scale), zero_point_(zero_point) {}
+
+template <typename out_value_t>
+template <typename value_t, typename index_t>
+SYCL_BLAS_INLINE value_t GemmRequantize<out_value_t>::apply(value_t value,
+                                                            index_t, index_t) {
+  // Saturating in float keeps the addition of the zero point from overflowing.
+  // The upper bound is at most the largest float below 2^31, as the bound of
+  // an int32 output rounds up to 2^31 which does not fit in value_t.
+  const float lowest =
+      static_cast<float>(std::numeric_limits<out_value_t>::min());
+  const float highest = cl::sycl::fmin(
+      static_cast<float>(std::numeric_limits<out_value_t>::max()),
+      2147483520.f);
+  const float requantized =
+      cl::sycl::rint(static_cast<float>(value) * scale_) +
+      static_cast<float>(zero_point_);
+  return static_cast<value_t>(
+      cl::sycl::fmin(cl::sycl::fmax(requantized, lowest), highest));
+}
+
+template <typename out_value_t>
+SYCL_BLAS_INLINE void GemmRequantize<out_value_t>::bind(cl::sycl::handler &) {}
+
+template <typename out_value_t>
+SYCL_BLAS_INLINE void
+GemmRequantize<out_value_t>::adjust_access_displacement() {}
+
+/*!
+ * @brief Scales a packet of consecutive rows of C by alpha, then applies the
+ * epilogue to each of its elements before storing it. The identity epilogue
+ * keeps the vector store.
+ *
+ * @param packet the packet of the result, which is modified in place
+ * @param row the row of C of the first element of the packet
+ * @param col the column of C of the packet
+ */
+template <typename epilogue_t, typename element_t, int packet_size,
+          typename index_t>
+SYCL_BLAS_INLINE typename std::enable_if<epilogue_t::is_identity>::type
+apply_gemm_epilogue(epilogue_t &, cl::sycl::vec<element_t, packet_size> &,
+                    index_t, index_t) {}
+
+template <typename epilogue_t, typename element_t, int packet_size,
+          typename index_t>
+SYCL_BLAS_INLINE typename std::enable_if<!epilogue_t::is_identity>::type
+apply_gemm_epilogue(epilogue_t &epilogue,
+                    cl::sycl::vec<element_t, packet_size> &packet,
+                    index_t row, index_t col) {
+  using address_t = cl::sycl::access::address_space;
+  element_t reg[packet_size];
+  packet.template store<address_t::private_space>(
+      0, cl::sycl::multi_ptr<element_t, address_t::private_space>(reg));
+#pragma unroll
+  for (int l = 0; l < packet_size; ++l) {
+    reg[l] = epilogue.apply(reg[l], row + l, col);
+  }
+  packet.template load<address_t::private_space>(
+      0, cl::sycl::multi_ptr<const element_t, address_t::private_space>(reg));
+}
+
+}  // namespace blas
+
+#endif  // SYCL_BLAS_BLAS3_GEMM_EPILOGUE_HPP
@@ -0,0 +1,227 @@
+/***************************************************************************
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename gemm_grouped.hpp
+ *
+ **************************************************************************/
+
+#ifndef SYCL_BLAS_BLAS3_GROUPED_GEMM_HPP
+#define SYCL_BLAS_BLAS3_GROUPED_GEMM_HPP
+
+#include "gemm_common.hpp"
+
+namespace blas {
+
+template <typename input_t, typename output_t, typename schedule_t,
+          typename tile_type, bool TransA, bool TransB, typename element_t,
+          bool is_beta_zero>
+SYCL_BLAS_INLINE GemmGrouped<input_t, output_t, schedule_t, tile_type, TransA,
+                             TransB, element_t, is_beta_zero>::
+    GemmGrouped(input_t A, input_t B, output_t C, schedule_t schedule,
+                element_t alpha, element_t beta, index_t group_count,
+                index_t num_tiles)
+    : a_(A),
+      b_(B),
+      c_(C),
+      schedule_(schedule),
+      alpha_(alpha),
+      beta_(beta),
+      group_count_(group_count),
+      num_tiles_(num_tiles) {}
+
+template <typename input_t, typename output_t, typename schedule_t,
+          typename tile_type, bool TransA, bool TransB, typename element_t,
+          bool is_beta_zero>
+SYCL_BLAS_INLINE std::string
+GemmGrouped<input_t, output_t, schedule_t, tile_type, TransA, TransB,
+            element_t, is_beta_zero>::get_type_string() noexcept {
+  std::ostringstream str{};
+  str << "GemmGrouped<" << wg_size << ", " << tile_type::get_type_string()
+      << ", " << type_string<value_t>::get_value() << ">";
+  return str.str();
+}
+
+/*!
+ * @brief One work-group per tile of C of all the problems.
+ */
+template <typename input_t, typename output_t, typename schedule_t,
+          typename tile_type, bool TransA, bool TransB, typename element_t,
+          bool is_beta_zero>
+SYCL_BLAS_INLINE cl::sycl::nd_range<1>
+GemmGrouped<input_t, output_t, schedule_t, tile_type, TransA, TransB,
+            element_t, is_beta_zero>::get_nd_range() const noexcept {
+  const cl::sycl::range<1> nwg(num_tiles_);
+  const cl::sycl::range<1> wgs(wg_size);
+  return cl::sycl::nd_range<1>(nwg * wgs, wgs);
+}
+
+template <typename input_t, typename output_t, typename schedule_t,
+          typename tile_type, bool TransA, bool TransB, typename element_t,
+          bool is_beta_zero>
+SYCL_BLAS_INLINE typename GemmGrouped<input_t, output_t, schedule_t, tile_type,
+                                      TransA, TransB, element_t,
+                                      is_beta_zero>::index_t
+GemmGrouped<input_t, output_t, schedule_t, tile_type, TransA, TransB,
+            element_t, is_beta_zero>::get_size() const {
+  return num_tiles_ * wg_size;
+}
+
+template <typename input_t, typename output_t, typename schedule_t,
+          typename tile_type, bool TransA, bool TransB, typename element_t,
+          bool is_beta_zero>
+SYCL_BLAS_INLINE bool
+GemmGrouped<input_t, output_t, schedule_t, tile_type, TransA, TransB,
+            element_t, is_beta_zero>::valid_thread(const cl::sycl::nd_item<1>&
+                                                       ndItem) const {
+  return true;
+}
+
+template <typename input_t, typename output_t, typename schedule_t,
+          typename tile_type, bool TransA, bool TransB, typename element_t,
+          bool is_beta_zero>
+SYCL_BLAS_INLINE typename GemmGrouped<input_t, output_t, schedule_t, tile_type,
+                                      TransA, TransB, element_t,
+                                      is_beta_zero>::index_t
+GemmGrouped<input_t, output_t, schedule_t, tile_type, TransA, TransB,
+            element_t, is_beta_zero>::get_field(index_t problem,
+                                                gemm_grouped_field_t field)
+    const {
+  constexpr index_t num_fields =
+      static_cast<index_t>(gemm_grouped_field_t::count);
+  return schedule_.eval(group_count_ + 1 + problem * num_fields +
+                        static_cast<index_t>(field));
+}
+
+template <typename input_t, typename output_t, typename schedule_t,
+          typename tile_type, bool TransA, bool TransB, typename element_t,
+          bool is_beta_zero>
+SYCL_BLAS_INLINE void
+GemmGrouped<input_t, output_t, schedule_t, tile_type, TransA, TransB,
+            element_t, is_beta_zero>::eval(cl::sycl::nd_item<1> id) noexcept {
+  const index_t tile = id.get_group(0);
+  // The tile belongs to the last problem whose tiles start at or before it.
+  // A problem without tiles starts at the same tile as the next one, so it is
+  // never selected.
+  index_t problem = 0;
+  index_t last = group_count_;
+  while (last - problem > 1) {
+    const index_t middle = (problem + last) / 2;
+    if (schedule_.eval(middle) <= tile) {
+      problem = middle;
+    } else {
+      last = middle;
+    }
+  }
+
+  const index_t m = get_field(problem, gemm_grouped_field_t::m);
+  const index_t n = get_field(problem, gemm_grouped_field_t::n);
+  const index_t k = get_field(problem, gemm_grouped_field_t::k);
+  const index_t lda = get_field(problem, gemm_grouped_field_t::lda);
+  const index_t ldb = get_field(problem, gemm_grouped_field_t::ldb);
+  const index_t ldc = get_field(problem, gemm_grouped_field_t::ldc);
+  auto A =
+      a_.get_pointer() + get_field(problem, gemm_grouped_field_t::offset_a);
+  auto B =
+      b_.get_pointer() + get_field(problem, gemm_grouped_field_t::offset_b);
+  auto C =
+      c_.get_pointer() + get_field(problem, gemm_grouped_field_t::offset_c);
+
+  // Consecutive work items compute consecutive rows of the tile, so that the
+  // loads of A and the stores of C are coalesced
+  const index_t tile_id = tile - schedule_.eval(problem);
+  const index_t tiles_per_col = (m - 1) / block_rows + 1;
+  const index_t item_id = id.get_local_id(0);
+  const index_t row =
+      (tile_id % tiles_per_col) * block_rows + item_id % wg_rows;
+  const index_t col =
+      (tile_id / tiles_per_col) * block_cols + item_id / wg_rows;
+
+  element_t reg_res[item_rows * item_cols];
+#pragma unroll
+  for (index_t i = 0; i < item_rows * item_cols; ++i) {
+    reg_res[i] = element_t{0};
+  }
+
+  for (index_t p = 0; p < k; ++p) {
+    element_t reg_a[item_rows];
+#pragma unroll
+    for (index_t j = 0; j < item_rows; ++j) {
+      const index_t r = row + j * wg_rows;
+      reg_a[j] = r < m ? A[trans_a ? p + r * lda : r + p * lda] : element_t{0};
+    }
+#pragma unroll
+    for (index_t i = 0; i < item_cols; ++i) {
+      const index_t c = col + i * wg_cols;
+      const element_t reg_b =
+          c < n ? B[trans_b ? c + p * ldb : p + c * ldb] : element_t{0};
+#pragma unroll
+      for (index_t j = 0; j < item_rows; ++j) {
+        reg_res[i * item_rows + j] =
+            gemm_mad<element_t>(reg_a[j], reg_b, reg_res[i * item_rows + j]);
+      }
+    }
+  }
+
+#pragma unroll
+  for (index_t i = 0; i < item_cols; ++i) {
+    const index_t c = col + i * wg_cols;
+#pragma unroll
+    for (index_t j = 0; j < item_rows; ++j) {
+      const index_t r = row + j * wg_rows;
+      if (r < m && c < n) {
+        // when C is uninitialized its elements can be NaN, and NaN * 0 is NaN
+        if (is_beta_zero) {
+          C[r + c * ldc] = alpha_ * reg_res[i * item_rows + j];
+        } else {
+          C[r + c * ldc] =
+              alpha_ * reg_res[i * item_rows + j] + beta_ * C[r + c * ldc];
+        }
+      }
+    }
+  }
+}
+
+template <typename input_t, typename output_t, typename schedule_t,
+          typename tile_type, bool TransA, bool TransB, typename element_t,
+          bool is_beta_zero>
+SYCL_BLAS_INLINE void
+GemmGrouped<input_t, output_t, schedule_t, tile_type, TransA, TransB,
+            element_t, is_beta_zero>::bind(cl::sycl::handler& h) {
+  a_.bind(h);
+  b_.bind(h);
+  c_.bind(h);
+  schedule_.bind(h);
+}
+
+template <typename input_t, typename output_t, typename schedule_t,
+          typename tile_type, bool TransA, bool TransB, typename element_t,
+          bool is_beta_zero>
+SYCL_BLAS_INLINE void
+GemmGrouped<input_t, output_t, schedule_t, tile_type, TransA, TransB,
+            element_t, is_beta_zero>::adjust_access_displacement() {
+  a_.adjust_access_displacement();
+  b_.adjust_access_displacement();
+  c_.adjust_access_displacement();
+  schedule_.adjust_access_displacement();
+}
+
+}  // namespace blas
+
+#endif  // SYCL_BLAS_BLAS3_GROUPED_GEMM_HPP
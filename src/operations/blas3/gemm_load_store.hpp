@@ -27,6 +27,99 @@
 
 namespace blas {
 
+/*!
+ * @brief Converts a packet loaded from a matrix to the type the GEMM computes
+ * in, or a packet of results to the type of C. The types only differ for
+ * mixed-precision GEMMs, e.g. int8 matrices accumulated in int32, so a packet
+ * which already has the requested type is returned unchanged.
+ */
+template <typename dest_t, typename src_t, int size>
+SYCL_BLAS_INLINE typename std::enable_if<std::is_same<dest_t, src_t>::value,
+                                         cl::sycl::vec<dest_t, size>>::type
+convert_packet(const cl::sycl::vec<src_t, size> &packet) {
+  return packet;
+}
+
+template <typename dest_t, typename src_t, int size>
+SYCL_BLAS_INLINE typename std::enable_if<!std::is_same<dest_t, src_t>::value,
+                                         cl::sycl::vec<dest_t, size>>::type
+convert_packet(const cl::sycl::vec<src_t, size> &packet) {
+  return packet.template convert<dest_t>();
+}
+
+/*!
+ * @brief Adds value to an element of C in global memory. SYCL 1.2.1 only
+ * provides integer atomics, so the bits of the element are updated with a
+ * compare-and-swap loop.
+ */
+template <typename pointer_t>
+SYCL_BLAS_INLINE void atomic_add_global(pointer_t ptr, float value) {
+  using address_t = cl::sycl::access::address_space;
+  using bits_t = cl::sycl::cl_uint;
+  using float_ptr_t = cl::sycl::multi_ptr<float, address_t::global_space>;
+  using bits_ptr_t = cl::sycl::multi_ptr<bits_t, address_t::global_space>;
+  cl::sycl::atomic<bits_t, address_t::global_space> element(
+      bits_ptr_t(reinterpret_cast<typename bits_ptr_t::pointer_t>(
+          float_ptr_t(ptr).get())));
+  bits_t expected = element.load();
+  bits_t desired;
+  do {
+    const cl::sycl::vec<float, 1> sum =
+        cl::sycl::vec<bits_t, 1>(expected)
+            .template as<cl::sycl::vec<float, 1>>() +
+        cl::sycl::vec<float, 1>(value);
+    desired = static_cast<bits_t>(
+        sum.template as<cl::sycl::vec<bits_t, 1>>());
+  } while (!element.compare_exchange_strong(expected, desired));
+}
+
+/*!
+ * @brief Stores a packet of results to C, converted to the type of its
+ * elements. A split-K GEMM instead adds the packet to C, as the work-groups
+ * computing the slices of K of a tile all contribute to the same elements.
+ */
+template <typename output_value_t, typename epilogue_t, typename element_t,
+          int size, typename pointer_t>
+SYCL_BLAS_INLINE typename std::enable_if<!epilogue_t::is_split_k>::type
+store_output_packet(const cl::sycl::vec<element_t, size> &packet,
+                    pointer_t out_ptr) {
+  convert_packet<output_value_t>(packet)
+      .template store<cl::sycl::access::address_space::global_space>(0,
+                                                                     out_ptr);
+}
+
+template <typename output_value_t, typename epilogue_t, typename element_t,
+          int size, typename pointer_t>
+SYCL_BLAS_INLINE typename std::enable_if<epilogue_t::is_split_k>::type
+store_output_packet(const cl::sycl::vec<element_t, size> &packet,
+                    pointer_t out_ptr) {
+  using address_t = cl::sycl::access::address_space;
+  element_t reg[size];
+  packet.template store<address_t::private_space>(
+      0, cl::sycl::multi_ptr<element_t, address_t::private_space>(reg));
+#pragma unroll
+  for (int l = 0; l < size; ++l) {
+    atomic_add_global(out_ptr + l, reg[l]);
+  }
+}
+
+/*!
+ * @brief Stores a single result to C, see store_output_packet.
+ */
+template <typename output_value_t, typename epilogue_t, typename element_t,
+          typename pointer_t>
+SYCL_BLAS_INLINE typename std::enable_if<!epilogue_t::is_split_k>::type
+store_output_value(element_t value, pointer_t out_ptr) {
+  *out_ptr = static_cast<output_value_t>(value);
+}
+
+template <typename output_value_t, typename epilogue_t, typename element_t,
+          typename pointer_t>
+SYCL_BLAS_INLINE typename std::enable_if<epilogue_t::is_split_k>::type
+store_output_value(element_t value, pointer_t out_ptr) {
+  atomic_add_global(out_ptr, value);
+}
+
 /*! @brief Contains static methods for loading and storing vector packets
 from/to non-vectorized memory as well as some constants for the vector type and
 packet size. SFINAE is used to select the appropriate method when called.
@@ -68,7 +161,7 @@ struct Packetize {
   static SYCL_BLAS_INLINE typename std::enable_if<!internal>::type load(
       const bool in_range, SrcPointerType src, DestPointerType dest,
       EdgePredicate) {
-    *(dest) = in_range ? *(src) : value_t{0};
+    *(dest) = in_range ? static_cast<value_t>(*(src)) : value_t{0};
   }
   /*! @brief Performs a vectorised load using sycl::vec::load when the current
    * block is internal. In the case where k < the
@@ -87,13 +180,18 @@ struct Packetize {
 
     if (in_range) {
       using address_t = cl::sycl::access::address_space;
-      packet.template load<address_t::global_space>(
-          0, cl::sycl::multi_ptr<const value_t, address_t::global_space>(src));
+      using src_value_t = typename std::remove_cv<
+          typename std::remove_reference<decltype(*src)>::type>::type;
+      cl::sycl::vec<src_value_t, packet_size> src_packet{};
+      src_packet.template load<address_t::global_space>(
+          0,
+          cl::sycl::multi_ptr<const src_value_t, address_t::global_space>(src));
+      packet = convert_packet<value_t>(src_packet);
     } else {
 #pragma unroll
       for (index_t i = 0; i < packet_size; i++) {
         reinterpret_cast<value_t *>(&packet)[i] =
-            edge_in_range(i) ? *(src + i) : value_t{0};
+            edge_in_range(i) ? static_cast<value_t>(*(src + i)) : value_t{0};
       }
     }
     store<trans, ld>(packet, dest);
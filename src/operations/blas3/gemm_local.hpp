@@ -63,19 +63,26 @@ namespace blas {
  * @tparam is_beta_zero True if beta == 0.
  * @tparam VectorSize The packet size to be used for vectorization.
  * @tparam batch_type the type of batch strideded /interleaved
+ * @tparam epilogue_t the transformation applied to each element of C before
+ * it is stored
  */
 template <typename input_t, typename output_t, bool DoubleBuffer, bool NbcA,
           bool NbcB, int ClSize, typename TileType, bool TransA, bool TransB,
-          typename element_t, bool is_beta_zero, int VectorSize>
+          typename element_t, bool is_beta_zero, int VectorSize,
+          typename epilogue_t>
 class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, TileType,
            TransA, TransB, element_t, is_beta_zero,
            static_cast<int>(gemm_memory_t::local),
            static_cast<int>(gemm_algorithm_t::standard),
            static_cast<int>(gemm_vectorization_t::full), VectorSize,
-           static_cast<int>(gemm_batch_type_t::strided)> {
+           static_cast<int>(gemm_batch_type_t::strided), epilogue_t> {
  public:
   using tile_type = TileType;
   using value_t = element_t;
+  // the type of the elements of C, which differs from the accumulation type
+  // element_t for mixed-precision GEMMs
+  using output_value_t =
+      typename std::remove_cv<typename output_t::value_t>::type;
   using index_t = typename std::make_signed<typename input_t::index_t>::type;
   using packetize_t = Packetize<VectorSize, value_t, index_t>;
   using vector_t = typename packetize_t::PacketType;
@@ -152,15 +159,18 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, TileType,
   const element_t alpha_;
   const element_t beta_;
   index_t batch_size_;
+  epilogue_t epilogue_;
 
   SYCL_BLAS_INLINE Gemm(input_t A, input_t B, output_t C, element_t alpha,
-                        element_t beta, index_t batch_size)
+                        element_t beta, index_t batch_size,
+                        epilogue_t epilogue = epilogue_t())
       : a_(A),
         b_(B),
         c_(C),
         alpha_(alpha),
         beta_(beta / alpha),
-        batch_size_(batch_size) {}
+        batch_size_(batch_size),
+        epilogue_(epilogue) {}
 
   /*!
    * @brief Get the type of this GemmFactory as a human readable string.
@@ -258,9 +268,11 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, TileType,
     // The number of work-group required to executed each batch efficiently
     const index_t wg_id = id.get_group(0) % get_workgroup_cluster();
 
-    const index_t a_size = trans_a ? m * lda : k * lda;
-    const index_t b_size = trans_b ? ldb * k : n * ldb;
-    const index_t c_size = ldc * n;
+    // The batches of a split-K GEMM are slices of K sharing the same C
+    constexpr bool split_k = epilogue_t::is_split_k;
+    const index_t a_size = trans_a ? (split_k ? k : m * lda) : k * lda;
+    const index_t b_size = trans_b ? ldb * k : (split_k ? k : n * ldb);
+    const index_t c_size = split_k ? 0 : ldc * n;
 
     auto ptr_A = a_.get_data().get_pointer() + a_.get_access_displacement() +
                  (wg_batch_id * a_size);
@@ -336,11 +348,13 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, TileType,
     a_.bind(h);
     b_.bind(h);
     c_.bind(h);
+    epilogue_.bind(h);
   }
   void adjust_access_displacement() {
     a_.adjust_access_displacement();
     b_.adjust_access_displacement();
     c_.adjust_access_displacement();
+    epilogue_.adjust_access_displacement();
   }
   SYCL_BLAS_INLINE bool valid_thread(const cl::sycl::nd_item<1> &ndItem) const {
     return true;
@@ -371,7 +385,8 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, TileType,
 #pragma unroll
           for (index_t l = 0; l < offset; ++l) {
             reg_res[i * item_rows + j * offset + l] =
-                beta_ * *(C + j * (wg_rows * offset) + l);
+                beta_ *
+                static_cast<element_t>(*(C + j * (wg_rows * offset) + l));
           }
         }
       }
@@ -464,21 +479,23 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, TileType,
   template <bool internal, index_t p_size = packetize_t::packet_size,
             typename OutputPointerType>
   SYCL_BLAS_INLINE typename std::enable_if<!internal>::type store_packet(
-      element_t *reg, OutputPointerType out_ptr) {
-    *out_ptr = alpha_ * (*reg);
+      element_t *reg, OutputPointerType out_ptr, index_t row, index_t col) {
+    store_output_value<output_value_t, epilogue_t>(
+        epilogue_.apply(alpha_ * (*reg), row, col), out_ptr);
   }
 
   template <bool internal, index_t p_size = packetize_t::packet_size,
             typename OutputPointerType>
   SYCL_BLAS_INLINE typename std::enable_if<internal>::type store_packet(
-      element_t *reg, OutputPointerType out_ptr) {
+      element_t *reg, OutputPointerType out_ptr, index_t row, index_t col) {
     vector_t out_vec{};
 
     out_vec.template load<address_t::private_space>(
         0, cl::sycl::multi_ptr<const element_t, address_t::private_space>(reg));
     out_vec *= alpha_;
+    apply_gemm_epilogue(epilogue_, out_vec, row, col);
 
-    out_vec.template store<address_t::global_space>(0, out_ptr);
+    store_output_packet<output_value_t, epilogue_t>(out_vec, out_ptr);
   }
   /*!
    * @brief Store the computed gemm result to the C matrix
@@ -508,6 +525,9 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, TileType,
     }
     constexpr index_t offset =
         (!check_m_limit && !check_n_limit) ? packetize_t::packet_size : 1;
+    // The coordinates in C of the first element stored by this item
+    const index_t row = a_.get_size_row() - mc;
+    const index_t col = b_.get_size_col() - nc;
 #pragma unroll
     for (index_t i = 0; i < item_cols; ++i) {
 #pragma unroll
@@ -518,7 +538,8 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, TileType,
 
         if (in_range) {
           store_packet<!check_m_limit && !check_n_limit>(
-              reg_res, C + j * (wg_rows * offset));
+              reg_res, C + j * (wg_rows * offset),
+              row + j * (wg_rows * offset), col + i);
         }
         reg_res += offset;
       }
@@ -685,7 +706,7 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, TileType,
 #pragma unroll
         for (index_t l = 0; l < item_rows; ++l) {
           reg_res[j * item_rows + l] =
-              cl::sycl::mad(reg_a[l], reg_b, reg_res[j * item_rows + l]);
+              gemm_mad<element_t>(reg_a[l], reg_b, reg_res[j * item_rows + l]);
         }
       }
       A = A + ldsa;
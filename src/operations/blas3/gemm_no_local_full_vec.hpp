@@ -51,16 +51,19 @@ namespace blas {
  * @tparam TransA  iff true, matrix A will be transposed on the fly
  * @tparam TransB  iff true, matrix B will be transposed on the fly
  * @tparam element_t  type of matrix elements
+ * @tparam epilogue_t  the transformation applied to each element of C before
+ *                     it is stored
  */
 template <typename input_t, typename output_t, bool DoubleBuffer, bool NbcA,
           bool NbcB, int ClSize, typename tile_type, bool TransA, bool TransB,
-          typename element_t, bool is_beta_zero, int VectorSize>
+          typename element_t, bool is_beta_zero, int VectorSize,
+          typename epilogue_t>
 class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type,
            TransA, TransB, element_t, is_beta_zero,
            static_cast<int>(gemm_memory_t::no_local),
            static_cast<int>(gemm_algorithm_t::standard),
            static_cast<int>(gemm_vectorization_t::full), VectorSize,
-           static_cast<int>(gemm_batch_type_t::strided)> {
+           static_cast<int>(gemm_batch_type_t::strided), epilogue_t> {
  public:
   using value_t = element_t;
   using index_t = typename std::make_signed<typename input_t::index_t>::type;
@@ -106,14 +109,17 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type,
   const element_t alpha_;
   const element_t beta_;
   index_t batch_size_;
+  epilogue_t epilogue_;
   SYCL_BLAS_INLINE Gemm(input_t A, input_t B, output_t C, element_t alpha,
-                        element_t beta, index_t batch_size)
+                        element_t beta, index_t batch_size,
+                        epilogue_t epilogue = epilogue_t())
       : a_(A),
         b_(B),
         c_(C),
         alpha_(alpha),
         beta_(beta / alpha_),
-        batch_size_(batch_size) {}
+        batch_size_(batch_size),
+        epilogue_(epilogue) {}
 
   /*!
    * @brief Get the type of this Gemm as a human readable string.
@@ -189,9 +195,11 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type,
     const index_t batch_stride =
         id.get_group_range(0) / get_workgroup_cluster();
 
-    const index_t a_size = trans_a ? m * lda : k * lda;
-    const index_t b_size = trans_b ? ldb * k : n * ldb;
-    const index_t c_size = ldc * n;
+    // The batches of a split-K GEMM are slices of K sharing the same C
+    constexpr bool split_k = epilogue_t::is_split_k;
+    const index_t a_size = trans_a ? (split_k ? k : m * lda) : k * lda;
+    const index_t b_size = trans_b ? ldb * k : (split_k ? k : n * ldb);
+    const index_t c_size = split_k ? 0 : ldc * n;
 
     auto orig_A = a_.get_pointer() + (wg_batch_id * a_size);
     auto orig_B = b_.get_pointer() + (wg_batch_id * b_size);
@@ -424,12 +432,14 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type,
     a_.bind(h);
     b_.bind(h);
     c_.bind(h);
+    epilogue_.bind(h);
   }
 
   void adjust_access_displacement() {
     a_.adjust_access_displacement();
     b_.adjust_access_displacement();
     c_.adjust_access_displacement();
+    epilogue_.adjust_access_displacement();
   }
 
  private:
@@ -813,7 +823,7 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type,
     for (int k = 0; k < packet_size; k++) {
 #pragma unroll
       for (int j = 0; j < item_rows; j++) {
-        reg_res[j] = cl::sycl::mad(reg_a[j], *reg_b, reg_res[j]);
+        reg_res[j] = gemm_mad<element_t>(reg_a[j], *reg_b, reg_res[j]);
       }
       reg_a += item_rows;
       reg_b += 1;
@@ -842,7 +852,7 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type,
 #pragma unroll
       for (int j = 0; j < item_rows; j++) {
         reg_res[i * item_rows + j] =
-            cl::sycl::mad(reg_a[j], reg_b[i], reg_res[i * item_rows + j]);
+            gemm_mad<element_t>(reg_a[j], reg_b[i], reg_res[i * item_rows + j]);
       }
     }
   }
@@ -865,7 +875,7 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type,
     reg_res += iteration * item_rows;
 #pragma unroll
     for (int j = 0; j < item_rows; j++) {
-      reg_res[j] = cl::sycl::mad(reg_a[j], *reg_b, reg_res[j]);
+      reg_res[j] = gemm_mad<element_t>(reg_a[j], *reg_b, reg_res[j]);
     }
   }
 
@@ -900,6 +910,9 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type,
     if (out_of_range) {
       return;
     }
+    // Columns of C between two consecutive columns stored by this item
+    constexpr index_t col_stride =
+        check_block || !trans_b ? wg_cols : item_cols / packet_size;
 #pragma unroll
     for (int i = 0; i < item_cols; i++) {
 #pragma unroll
@@ -912,12 +925,15 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type,
               0, cl::sycl::multi_ptr<const element_t, address_t::private_space>(
                      reg_res + i * item_rows + j * packet_size));
           out_vec *= alpha_;
+          apply_gemm_epilogue(epilogue_, out_vec,
+                              dim_m_c_start + j * wg_rows * packet_size,
+                              dim_n_c_start + i * col_stride);
 
-          out_vec.template store<address_t::global_space>(
-              0, C + j * wg_rows * packet_size);
+          store_output_packet<element_t, epilogue_t>(
+              out_vec, C + j * wg_rows * packet_size);
         }
       }
-      C += ldc * (check_block || !trans_b ? wg_cols : item_cols / packet_size);
+      C += ldc * col_stride;
     }
   }
 };
@@ -51,18 +51,27 @@ namespace blas {
  * @tparam TransA  if true, matrix A will be transposed on the fly
  * @tparam TransB  if true, matrix B will be transposed on the fly
  * @tparam element_t  type of matrix elements
+ * @tparam epilogue_t  the transformation applied to each element of C before
+ *                     it is stored
  */
 template <typename input_t, typename output_t, bool DoubleBuffer, bool NbcA,
           bool NbcB, int ClSize, typename tile_type, bool TransA, bool TransB,
-          typename element_t, bool is_beta_zero, int VectorSize>
+          typename element_t, bool is_beta_zero, int VectorSize,
+          typename epilogue_t>
 class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type,
            TransA, TransB, element_t, is_beta_zero,
            static_cast<int>(gemm_memory_t::no_local),
            static_cast<int>(gemm_algorithm_t::standard),
            static_cast<int>(gemm_vectorization_t::partial), VectorSize,
-           static_cast<int>(gemm_batch_type_t::strided)> {
+           static_cast<int>(gemm_batch_type_t::strided), epilogue_t> {
  public:
   using value_t = element_t;
+  // the types of the elements of A and B, and of C, which differ from the
+  // accumulation type element_t for mixed-precision GEMMs
+  using input_value_t =
+      typename std::remove_cv<typename input_t::value_t>::type;
+  using output_value_t =
+      typename std::remove_cv<typename output_t::value_t>::type;
   using index_t = typename std::make_signed<typename input_t::index_t>::type;
   using address_t = cl::sycl::access::address_space;
   using packetize_t = Packetize<VectorSize, value_t, index_t>;
@@ -102,14 +111,17 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type,
   const element_t alpha_;
   const element_t beta_;
   index_t batch_size_;
+  epilogue_t epilogue_;
   SYCL_BLAS_INLINE Gemm(input_t A, input_t B, output_t C, element_t alpha,
-                        element_t beta, index_t batch_size)
+                        element_t beta, index_t batch_size,
+                        epilogue_t epilogue = epilogue_t())
       : a_(A),
         b_(B),
         c_(C),
         alpha_(alpha),
         beta_(beta / alpha_),
-        batch_size_(batch_size) {}
+        batch_size_(batch_size),
+        epilogue_(epilogue) {}
 
   /*!
    * @brief Get the type of this NoLocalGemmFactory as a human readable string.
@@ -183,9 +195,11 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type,
     const index_t batch_stride =
         id.get_group_range(0) / get_workgroup_cluster();
 
-    const index_t a_size = trans_a ? m * lda : k * lda;
-    const index_t b_size = trans_b ? ldb * k : n * ldb;
-    const index_t c_size = ldc * n;
+    // The batches of a split-K GEMM are slices of K sharing the same C
+    constexpr bool split_k = epilogue_t::is_split_k;
+    const index_t a_size = trans_a ? (split_k ? k : m * lda) : k * lda;
+    const index_t b_size = trans_b ? ldb * k : (split_k ? k : n * ldb);
+    const index_t c_size = split_k ? 0 : ldc * n;
 
     auto orig_A = a_.get_pointer() + (wg_batch_id * a_size);
     auto orig_B = b_.get_pointer() + (wg_batch_id * b_size);
@@ -313,8 +327,9 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type,
         if (do_check<need_check_boundary>(check_boundary(
                 dim_m_c_start + j * wg_rows, dim_n_c_start + i * wg_cols))) {
           reg_res[i * item_rows + j] =
-              beta_ * C[(j % a_packet_size) +
-                        (j / a_packet_size) * wg_rows * a_packet_size];
+              beta_ * static_cast<element_t>(
+                          C[(j % a_packet_size) +
+                            (j / a_packet_size) * wg_rows * a_packet_size]);
         }
       }
       C += ((i + 1) % b_packet_size == 0
@@ -419,12 +434,14 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type,
     a_.bind(h);
     b_.bind(h);
     c_.bind(h);
+    epilogue_.bind(h);
   }
 
   void adjust_access_displacement() {
     a_.adjust_access_displacement();
     b_.adjust_access_displacement();
     c_.adjust_access_displacement();
+    epilogue_.adjust_access_displacement();
   }
 
  private:
@@ -465,13 +482,14 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type,
       bool in_range =
           do_check<check_block>(chk_boundary(index + (work_per_load - 1)));
 
-      cl::sycl::vec<element_t, work_per_load> in_vec{0};
+      cl::sycl::vec<input_value_t, work_per_load> in_vec{0};
       if (in_range) {
         in_vec.template load<address_t::global_space>(
-            0,
-            cl::sycl::multi_ptr<const element_t, address_t::global_space>(ptr));
+            0, cl::sycl::multi_ptr<const input_value_t,
+                                   address_t::global_space>(ptr));
       }
-      in_vec.template store<address_t::private_space>(0, reg);
+      convert_packet<element_t>(in_vec)
+          .template store<address_t::private_space>(0, reg);
 
       // Move pointers and update index for next load
       ptr += ld;
@@ -494,7 +512,7 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type,
 #pragma unroll
       for (int j = 0; j < item_rows; j++) {
         reg_res[i * item_rows + j] =
-            cl::sycl::mad(reg_a[j], reg_b[i], reg_res[i * item_rows + j]);
+            gemm_mad<element_t>(reg_a[j], reg_b[i], reg_res[i * item_rows + j]);
       }
     }
   }
@@ -556,9 +574,13 @@ class Gemm<input_t, output_t, DoubleBuffer, NbcA, NbcB, ClSize, tile_type,
               0, cl::sycl::multi_ptr<const element_t, address_t::private_space>(
                      reg_res + i * item_rows + j * a_packet_size));
           out_vec *= alpha_;
+          apply_gemm_epilogue(
+              epilogue_, out_vec, dim_m_c_start + j * wg_rows * a_packet_size,
+              dim_n_c_start + (i / b_packet_size) * wg_cols * b_packet_size +
+                  i % b_packet_size);
 
-          out_vec.template store<address_t::global_space>(
-              0, C + j * wg_rows * a_packet_size);
+          store_output_packet<output_value_t, epilogue_t>(
+              out_vec, C + j * wg_rows * a_packet_size);
         }
       }
       C += ((i + 1) % b_packet_size == 0
@@ -87,13 +87,19 @@ DiagonalBlocksInverter<UnitDiag, Upper, BlockSize, matrix_t>::eval(
   const index_t destBlockOffset = offsetPart1 + offsetPart2;
 
   // Loads the source lower triangle into local memory. Any values in the upper
-  // triangle or outside of the matrix are set to zero
+  // triangle or outside of the matrix are set to zero. The diagonal is set to
+  // one when it is not referenced, i.e. for a unit diagonal matrix and outside
+  // of the matrix, so that the padding of the last block inverts to identity
   for (index_t j = 0; j < internalBlockSize; ++j) {
     bool isInRange = false;
     isInRange = (Upper) ? (i <= j) && ((blockIndexPerBlock + j) < N_)
                         : (i >= j) && ((blockIndexPerBlock + i) < N_);
+    const bool isUnitElement =
+        (i == j) && (UnitDiag || ((blockIndexPerBlock + i) >= N_));
     local[j + i * internalBlockSize] =
-        (isInRange) ? A[j * lda_ + i + srcBlockOffset] : value_t{0};
+        isUnitElement ? value_t{1}
+                      : (isInRange) ? A[j * lda_ + i + srcBlockOffset]
+                                    : value_t{0};
   }
   item.barrier(cl::sycl::access::fence_space::local_space);
 
@@ -38,7 +38,11 @@
 #include "operations/blas_operators.h"
 
 namespace blas {
-struct Operators {};
+struct Operators {
+  // Used when the operator reduces a vector, see reduction_algorithm_t
+  static constexpr reduction_algorithm_t reduction_algorithm =
+      reduction_algorithm_t::multi_pass;
+};
 
 /* StripASP.
  * When using ComputeCpp CE, the Device Compiler uses Address Spaces
@@ -150,6 +154,8 @@ NEST_INDEX_VALUE_STRIP_ASP_LOCATION(long long, float)
 NEST_INDEX_VALUE_STRIP_ASP_LOCATION(int, double)
 NEST_INDEX_VALUE_STRIP_ASP_LOCATION(long, double)
 NEST_INDEX_VALUE_STRIP_ASP_LOCATION(long long, double)
+GENERATE_STRIP_ASP_LOCATION(ScaledSquaresTuple<float>)
+GENERATE_STRIP_ASP_LOCATION(ScaledSquaresTuple<double>)
 #endif
 
 /*!
@@ -209,6 +215,9 @@ struct SquareOperator : public Operators {
 */
 
 struct AddOperator : public Operators {
+  static constexpr reduction_algorithm_t reduction_algorithm =
+      reduction_algorithm_t::single_pass;
+
   template <typename lhs_t, typename rhs_t>
   static SYCL_BLAS_INLINE typename StripASP<rhs_t>::type eval(const lhs_t &l,
                                                               const rhs_t &r) {
@@ -234,6 +243,21 @@ struct ProductOperator : public Operators {
   }
 };
 
+/*!
+ * @brief Product of a scalar l and a value r which is zero whenever l is zero,
+ * even if r is NaN or infinite. This is how BLAS applies beta, whose zero
+ * value means that C or y is not read.
+ */
+struct ScalarProductOrZeroOperator : public Operators {
+  template <typename lhs_t, typename rhs_t>
+  static SYCL_BLAS_INLINE typename StripASP<rhs_t>::type eval(const lhs_t &l,
+                                                              const rhs_t &r) {
+    using value_t = typename StripASP<rhs_t>::type;
+    return (l == lhs_t{0}) ? constant<value_t, const_val::zero>::value()
+                           : static_cast<value_t>(l * r);
+  }
+};
+
 struct DivisionOperator : public Operators {
   template <typename lhs_t, typename rhs_t>
   static SYCL_BLAS_INLINE typename StripASP<rhs_t>::type eval(const lhs_t &l,
@@ -274,6 +298,9 @@ struct MinOperator : public Operators {
 };
 
 struct AbsoluteAddOperator : public Operators {
+  static constexpr reduction_algorithm_t reduction_algorithm =
+      reduction_algorithm_t::single_pass;
+
   template <typename lhs_t, typename rhs_t>
   static SYCL_BLAS_INLINE typename StripASP<rhs_t>::type eval(const lhs_t &l,
                                                               const rhs_t &r) {
@@ -357,6 +384,83 @@ struct CollapseIndexTupleOperator : public Operators {
                                        const_val::zero>::value()>::value();
   }
 };
+
+/*!
+ * @brief Maps a value x to the ScaledSquaresTuple [|x|, 1] of its square, to
+ * be reduced with ScaledSquaresAddOperator.
+ */
+struct ScaledSquaresOperator : public Operators {
+  template <typename rhs_t>
+  static SYCL_BLAS_INLINE ScaledSquaresTuple<typename StripASP<rhs_t>::type>
+  eval(const rhs_t r) {
+    using element_t = typename StripASP<rhs_t>::type;
+    const element_t val = AbsoluteValue::eval(r);
+    // A zero element does not contribute to the sum of squares
+    return ScaledSquaresTuple<element_t>(
+        val, (val == constant<element_t, const_val::zero>::value())
+                 ? constant<element_t, const_val::zero>::value()
+                 : constant<element_t, const_val::one>::value());
+  }
+};
+
+/*!
+ * @brief Combines two ScaledSquaresTuple, rescaling both sums of squares to
+ * the larger of the two scales.
+ */
+struct ScaledSquaresAddOperator : public Operators {
+  static constexpr reduction_algorithm_t reduction_algorithm =
+      reduction_algorithm_t::single_pass;
+
+  template <typename lhs_t, typename rhs_t>
+  static SYCL_BLAS_INLINE typename StripASP<rhs_t>::type eval(const lhs_t &l,
+                                                              const rhs_t &r) {
+    using tuple_t = typename StripASP<rhs_t>::type;
+    using value_t = typename tuple_t::value_t;
+    const tuple_t lt = static_cast<typename StripASP<lhs_t>::type>(l);
+    const tuple_t rt = static_cast<tuple_t>(r);
+    const value_t scale = (lt.scale > rt.scale) ? lt.scale : rt.scale;
+    if (scale == constant<value_t, const_val::zero>::value()) {
+      return tuple_t(scale, scale);
+    }
+    const value_t l_ratio = lt.scale / scale;
+    const value_t r_ratio = rt.scale / scale;
+    return tuple_t(scale,
+                   lt.ssq * l_ratio * l_ratio + rt.ssq * r_ratio * r_ratio);
+  }
+
+  template <typename rhs_t>
+  constexpr static SYCL_BLAS_INLINE typename rhs_t::value_t init() {
+    return typename rhs_t::value_t(
+        constant<typename rhs_t::value_t::value_t, const_val::zero>::value(),
+        constant<typename rhs_t::value_t::value_t, const_val::zero>::value());
+  }
+};
+
+/*!
+ * @brief Euclidean norm represented by a ScaledSquaresTuple.
+ */
+struct ScaledSquaresNormOperator : public Operators {
+  template <typename rhs_t>
+  static SYCL_BLAS_INLINE typename StripASP<rhs_t>::type::value_t eval(
+      const rhs_t r) {
+    const typename StripASP<rhs_t>::type rt =
+        static_cast<typename StripASP<rhs_t>::type>(r);
+    return rt.scale * cl::sycl::sqrt(rt.ssq);
+  }
+};
+
+/*!
+ * @brief Applies the unary operator_t to the first of its operands, e.g. to
+ * map x alone in a reduction over both x and y.
+ */
+template <typename operator_t>
+struct FirstOperandOperator : public Operators {
+  template <typename lhs_t, typename... rhs_t>
+  static SYCL_BLAS_INLINE auto eval(const lhs_t &l, const rhs_t &... r)
+      -> decltype(operator_t::eval(l)) {
+    return operator_t::eval(l);
+  }
+};
 }  // namespace blas
 
 #endif  // BLAS_OPERATORS_HPP
@@ -32,6 +32,8 @@
 
 #include "interface/blas1_interface.hpp"
 
+#include "interface/blas1_lazy_interface.hpp"
+
 #include "interface/blas2_interface.hpp"
 
 #include "interface/blas3_interface.hpp"
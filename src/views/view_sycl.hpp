@@ -185,6 +185,30 @@ struct VectorView<
     return *(ptr_ + indx);
   }
 
+  /*!
+   * @brief Loads the packet_size contiguous elements starting at element i.
+   * Only valid for a stride of 1.
+   */
+  template <int packet_size>
+  SYCL_BLAS_INLINE cl::sycl::vec<scalar_t, packet_size> eval_packet(
+      index_t i) const {
+    using address_t = cl::sycl::access::address_space;
+    cl::sycl::vec<scalar_t, packet_size> packet;
+    packet.template load<address_t::global_space>(0, ptr_ + i);
+    return packet;
+  }
+
+  /*!
+   * @brief Stores a packet in the packet_size contiguous elements starting at
+   * element i. Only valid for a stride of 1.
+   */
+  template <int packet_size>
+  SYCL_BLAS_INLINE void store_packet(
+      index_t i, const cl::sycl::vec<scalar_t, packet_size> &packet) {
+    using address_t = cl::sycl::access::address_space;
+    packet.template store<address_t::global_space>(0, ptr_ + i);
+  }
+
   SYCL_BLAS_INLINE void bind(cl::sycl::handler &h) { h.require(data_); }
   SYCL_BLAS_INLINE void adjust_access_displacement() {
     ptr_ = data_.get_pointer() + disp_;
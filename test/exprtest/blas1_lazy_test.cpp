@@ -0,0 +1,108 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename blas1_lazy_test.cpp
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+#include "sycl_blas.hpp"
+
+// inputs combination
+template <typename scalar_t>
+using combination_t = std::tuple<int, scalar_t, scalar_t, int, int>;
+
+template <typename scalar_t>
+void run_test(const combination_t<scalar_t> combi) {
+  int size;
+  scalar_t alpha;
+  scalar_t beta;
+  int incX;
+  int incY;
+  std::tie(size, alpha, beta, incX, incY) = combi;
+
+  using data_t = utils::data_storage_t<scalar_t>;
+
+  // Input vectors x, y and z
+  std::vector<data_t> v_x(size * incX);
+  std::vector<data_t> v_y(size * incY);
+  std::vector<data_t> v_z(size);
+  fill_random(v_x);
+  fill_random(v_y);
+  fill_random(v_z);
+
+  // Reference BLAS implementation of
+  // y = beta * (alpha * x + y); z = y; swap(x, z)
+  std::vector<data_t> v_cpu_x(v_x);
+  std::vector<data_t> v_cpu_y(v_y);
+  std::vector<data_t> v_cpu_z(v_z);
+  reference_blas::axpy(size, static_cast<data_t>(alpha), v_cpu_x.data(), incX,
+                       v_cpu_y.data(), incY);
+  reference_blas::scal(size, static_cast<data_t>(beta), v_cpu_y.data(), incY);
+  reference_blas::copy(size, v_cpu_y.data(), incY, v_cpu_z.data(), 1);
+  reference_blas::swap(size, v_cpu_x.data(), incX, v_cpu_z.data(), 1);
+
+  // SYCL-BLAS implementation
+  auto q = make_queue();
+  test_executor_t ex(q);
+
+  // Iterators
+  auto gpu_x_v = utils::make_quantized_buffer<scalar_t>(ex, v_x);
+  auto gpu_y_v = utils::make_quantized_buffer<scalar_t>(ex, v_y);
+  auto gpu_z_v = utils::make_quantized_buffer<scalar_t>(ex, v_z);
+
+  auto x = make_lazy_vector(ex, gpu_x_v, incX, size);
+  auto y = make_lazy_vector(ex, gpu_y_v, incY, size);
+  auto z = make_lazy_vector(ex, gpu_z_v, 1, size);
+
+  // Nothing is submitted until the vectors are materialized. y and z read
+  // the memory of y, so they are materialized together.
+  auto y1 = _scal(beta, _axpy(alpha, x, y));
+  auto z1 = _copy(y1, z);
+  auto yz_event = materialize(ex, y1, z1);
+  ASSERT_EQ(yz_event.size(), size_t(1));
+
+  // x and z hold their values again once wait materializes the swap
+  wait(ex, _swap(x, z));
+
+  // Materializing a vector without pending expression does nothing
+  ASSERT_TRUE(materialize(ex, x).empty());
+
+  // Copy the results back to host memory
+  auto getResultEv = utils::quantized_copy_to_host<scalar_t>(ex, gpu_x_v, v_x);
+  ex.get_policy_handler().wait(getResultEv);
+  getResultEv = utils::quantized_copy_to_host<scalar_t>(ex, gpu_y_v, v_y);
+  ex.get_policy_handler().wait(getResultEv);
+  getResultEv = utils::quantized_copy_to_host<scalar_t>(ex, gpu_z_v, v_z);
+  ex.get_policy_handler().wait(getResultEv);
+
+  ASSERT_TRUE(utils::compare_vectors(v_cpu_x, v_x));
+  ASSERT_TRUE(utils::compare_vectors(v_cpu_y, v_y));
+  ASSERT_TRUE(utils::compare_vectors(v_cpu_z, v_z));
+}
+
+const auto combi = ::testing::Combine(::testing::Values(16, 1023),   // size
+                                      ::testing::Values(0.0, 1.34),  // alpha
+                                      ::testing::Values(1.0, 0.5),   // beta
+                                      ::testing::Values(1, 4),       // incX
+                                      ::testing::Values(1, 3));      // incY
+
+BLAS_REGISTER_TEST(LazyBlas1, combination_t, combi);
@@ -0,0 +1,241 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename expression_graph_test.cpp
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+#include "sycl_blas.hpp"
+
+// inputs combination
+template <typename scalar_t>
+using combination_t = std::tuple<int, scalar_t, scalar_t>;
+
+template <typename scalar_t>
+void run_test(const combination_t<scalar_t> combi) {
+  int size;
+  scalar_t alpha;
+  scalar_t beta;
+  std::tie(size, alpha, beta) = combi;
+
+  using data_t = utils::data_storage_t<scalar_t>;
+
+  // Input vectors x and y (y is also output of AXPY and SCAL)
+  std::vector<data_t> v_x(size);
+  std::vector<data_t> v_y(size);
+  fill_random(v_x);
+  fill_random(v_y);
+
+  // Output of DOT
+  std::vector<data_t> v_r(1, 10.0);
+
+  // Reference BLAS implementation of y = beta * (alpha * x + y); r = x.y
+  std::vector<data_t> v_cpu_y(v_y);
+  reference_blas::axpy(size, static_cast<data_t>(alpha), v_x.data(), 1,
+                       v_cpu_y.data(), 1);
+  reference_blas::scal(size, static_cast<data_t>(beta), v_cpu_y.data(), 1);
+  data_t cpu_r =
+      reference_blas::dot(size, v_x.data(), 1, v_cpu_y.data(), 1);
+
+  // SYCL-BLAS implementation
+  auto q = make_queue();
+  test_executor_t ex(q);
+
+  // Iterators
+  auto gpu_x_v = utils::make_quantized_buffer<scalar_t>(ex, v_x);
+  auto gpu_y_v = utils::make_quantized_buffer<scalar_t>(ex, v_y);
+  auto gpu_r_v = utils::make_quantized_buffer<scalar_t>(ex, v_r);
+
+  // Views
+  auto view_x = make_vector_view(ex, gpu_x_v, 1, size);
+  auto view_y = make_vector_view(ex, gpu_y_v, 1, size);
+  auto view_r = make_vector_view(ex, gpu_r_v, 1, 1);
+
+  // AXPY expression
+  auto axpy_scal_op = make_op<ScalarOp, ProductOperator>(alpha, view_x);
+  auto axpy_add_op = make_op<BinaryOp, AddOperator>(view_y, axpy_scal_op);
+  auto axpy_op_tree = make_op<Assign>(view_y, axpy_add_op);
+
+  // SCAL expression
+  auto scal_op = make_op<ScalarOp, ProductOperator>(beta, view_y);
+  auto scal_op_tree = make_op<Assign>(view_y, scal_op);
+
+  // DOT expression
+  auto dot_prd_op = make_op<BinaryOp, ProductOperator>(view_x, view_y);
+  auto local_size = ex.get_policy_handler().get_work_group_size();
+  auto dot_op_tree = make_AssignReduction<AddOperator>(
+      view_r, dot_prd_op, local_size, local_size * 2 * local_size);
+
+  // Record the three trees and submit them
+  auto graph = ex.begin_capture()
+                   .record(axpy_op_tree)
+                   .record(scal_op_tree)
+                   .record(dot_op_tree);
+  auto events = ex.end_capture(graph);
+  ex.get_policy_handler().wait(events);
+
+  // AXPY and SCAL are joined, DOT runs in its own single pass kernel
+  ASSERT_EQ(events.size(), size_t(2));
+
+  // Copy the results back to host memory
+  auto getResultEv = utils::quantized_copy_to_host<scalar_t>(ex, gpu_y_v, v_y);
+  ex.get_policy_handler().wait(getResultEv);
+  getResultEv = utils::quantized_copy_to_host<scalar_t>(ex, gpu_r_v, v_r);
+  ex.get_policy_handler().wait(getResultEv);
+
+  ASSERT_TRUE(utils::compare_vectors(v_cpu_y, v_y));
+  const bool isAlmostEqual =
+      utils::almost_equal<data_t, scalar_t>(v_r[0], cpu_r);
+  ASSERT_TRUE(isAlmostEqual);
+}
+
+const auto combi = ::testing::Combine(::testing::Values(16, 1023),   // size
+                                      ::testing::Values(0.0, 1.34),  // alpha
+                                      ::testing::Values(1.0, 0.5));  // beta
+
+BLAS_REGISTER_TEST(ExpressionGraph, combination_t, combi);
+
+template <typename scalar_t>
+void run_barrier_test(const combination_t<scalar_t> combi) {
+  int size;
+  scalar_t alpha;
+  scalar_t beta;
+  std::tie(size, alpha, beta) = combi;
+
+  using data_t = utils::data_storage_t<scalar_t>;
+
+  std::vector<data_t> v_x(size);
+  std::vector<data_t> v_y(size);
+  std::vector<data_t> v_z(size);
+  fill_random(v_x);
+  fill_random(v_y);
+
+  // Reference implementation of y = beta * y; z = y[0] * x
+  std::vector<data_t> v_cpu_y(v_y);
+  reference_blas::scal(size, static_cast<data_t>(beta), v_cpu_y.data(), 1);
+  std::vector<data_t> v_cpu_z(size);
+  std::transform(v_x.begin(), v_x.end(), v_cpu_z.begin(),
+                 [&](data_t x) { return v_cpu_y[0] * x; });
+
+  // SYCL-BLAS implementation
+  auto q = make_queue();
+  test_executor_t ex(q);
+
+  auto gpu_x_v = utils::make_quantized_buffer<scalar_t>(ex, v_x);
+  auto gpu_y_v = utils::make_quantized_buffer<scalar_t>(ex, v_y);
+  auto gpu_z_v = utils::make_quantized_buffer<scalar_t>(ex, v_z);
+
+  auto view_x = make_vector_view(ex, gpu_x_v, 1, size);
+  auto view_y = make_vector_view(ex, gpu_y_v, 1, size);
+  auto view_z = make_vector_view(ex, gpu_z_v, 1, size);
+  auto view_y0 = make_vector_view(ex, gpu_y_v, 1, 1);
+
+  // SCAL expression
+  auto scal_op = make_op<ScalarOp, ProductOperator>(beta, view_y);
+  auto scal_op_tree = make_op<Assign>(view_y, scal_op);
+
+  // Every work item of the second tree reads the first element of y, which is
+  // written by the first tree, so the two must not be joined
+  auto y0 = make_op<DeviceScalar>(view_y0);
+  auto z_op = make_op<ScalarOp, ProductOperator>(y0, view_x);
+  auto z_op_tree = make_op<Assign>(view_z, z_op);
+  static_assert(!is_elementwise<decltype(z_op_tree)>::value,
+                "reading a device scalar is not element-wise");
+
+  auto graph = ex.begin_capture().record(scal_op_tree).record(z_op_tree);
+  auto events = ex.end_capture(graph);
+  ex.get_policy_handler().wait(events);
+
+  ASSERT_EQ(events.size(), size_t(2));
+
+  auto getResultEv = utils::quantized_copy_to_host<scalar_t>(ex, gpu_y_v, v_y);
+  ex.get_policy_handler().wait(getResultEv);
+  getResultEv = utils::quantized_copy_to_host<scalar_t>(ex, gpu_z_v, v_z);
+  ex.get_policy_handler().wait(getResultEv);
+
+  ASSERT_TRUE(utils::compare_vectors(v_cpu_y, v_y));
+  ASSERT_TRUE(utils::compare_vectors(v_cpu_z, v_z));
+}
+
+BLAS_REGISTER_TEST_CUSTOM_NAME(ExpressionGraphBarrier, ExpressionGraphBarrier,
+                               run_barrier_test, combination_t, combi);
+
+template <typename scalar_t>
+void run_shifted_view_test(const combination_t<scalar_t> combi) {
+  int size;
+  scalar_t alpha;
+  scalar_t beta;
+  std::tie(size, alpha, beta) = combi;
+
+  using data_t = utils::data_storage_t<scalar_t>;
+
+  std::vector<data_t> v_y(size + 1);
+  std::vector<data_t> v_z(size);
+  fill_random(v_y);
+
+  // Reference implementation of y[0:size] = beta * y[0:size];
+  // z = alpha * y[1:size + 1]
+  std::vector<data_t> v_cpu_y(v_y);
+  reference_blas::scal(size, static_cast<data_t>(beta), v_cpu_y.data(), 1);
+  std::vector<data_t> v_cpu_z(size);
+  std::transform(v_cpu_y.begin() + 1, v_cpu_y.end(), v_cpu_z.begin(),
+                 [&](data_t y) { return static_cast<data_t>(alpha) * y; });
+
+  // SYCL-BLAS implementation
+  auto q = make_queue();
+  test_executor_t ex(q);
+
+  auto gpu_y_v = utils::make_quantized_buffer<scalar_t>(ex, v_y);
+  auto gpu_z_v = utils::make_quantized_buffer<scalar_t>(ex, v_z);
+
+  auto view_y = make_vector_view(ex, gpu_y_v, 1, size);
+  auto view_y1 = make_vector_view(ex, gpu_y_v + 1, 1, size);
+  auto view_z = make_vector_view(ex, gpu_z_v, 1, size);
+
+  // SCAL expression
+  auto scal_op = make_op<ScalarOp, ProductOperator>(beta, view_y);
+  auto scal_op_tree = make_op<Assign>(view_y, scal_op);
+
+  // Both trees are element-wise and have the same size, but work item i of
+  // the second one reads the element of y written by work item i + 1 of the
+  // first one, so the two must not be joined
+  auto z_op = make_op<ScalarOp, ProductOperator>(alpha, view_y1);
+  auto z_op_tree = make_op<Assign>(view_z, z_op);
+
+  auto graph = ex.begin_capture().record(scal_op_tree).record(z_op_tree);
+  auto events = ex.end_capture(graph);
+  ex.get_policy_handler().wait(events);
+
+  ASSERT_EQ(events.size(), size_t(2));
+
+  auto getResultEv = utils::quantized_copy_to_host<scalar_t>(ex, gpu_y_v, v_y);
+  ex.get_policy_handler().wait(getResultEv);
+  getResultEv = utils::quantized_copy_to_host<scalar_t>(ex, gpu_z_v, v_z);
+  ex.get_policy_handler().wait(getResultEv);
+
+  ASSERT_TRUE(utils::compare_vectors(v_cpu_y, v_y));
+  ASSERT_TRUE(utils::compare_vectors(v_cpu_z, v_z));
+}
+
+BLAS_REGISTER_TEST_CUSTOM_NAME(ExpressionGraphShiftedView,
+                               ExpressionGraphShiftedView,
+                               run_shifted_view_test, combination_t, combi);
@@ -0,0 +1,126 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename blas1_batched_reduction_test.cpp
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+
+template <typename scalar_t>
+using combination_t = std::tuple<int, int, int, int>;
+
+template <typename scalar_t>
+void run_test(const combination_t<scalar_t> combi) {
+  using tuple_t = IndexValueTuple<int, scalar_t>;
+
+  int size;
+  int incX;
+  int padding;
+  int batch_size;
+  std::tie(size, incX, padding, batch_size) = combi;
+
+  using data_t = utils::data_storage_t<scalar_t>;
+
+  // The vectors of the batch are separated by a few unused elements
+  const int stride = size * incX + padding;
+
+  // Input vectors
+  std::vector<data_t> x_v(stride * batch_size);
+  fill_random(x_v);
+  std::vector<data_t> y_v(stride * batch_size);
+  fill_random(y_v);
+
+  // We need to guarantee that cl::sycl::half can hold the sums
+  std::transform(std::begin(x_v), std::end(x_v), std::begin(x_v),
+                 [=](data_t x) { return x / x_v.size(); });
+
+  // Output vectors
+  std::vector<data_t> dot_s(batch_size, 10.0);
+  std::vector<data_t> asum_s(batch_size, 10.0);
+  std::vector<data_t> nrm2_s(batch_size, 10.0);
+  std::vector<tuple_t> iamax_s(batch_size, tuple_t{0, 0.0});
+
+  // SYCL implementation
+  auto q = make_queue();
+  test_executor_t ex(q);
+
+  // Iterators
+  auto gpu_x_v = utils::make_quantized_buffer<scalar_t>(ex, x_v);
+  auto gpu_y_v = utils::make_quantized_buffer<scalar_t>(ex, y_v);
+  auto gpu_dot_s = utils::make_quantized_buffer<scalar_t>(ex, dot_s);
+  auto gpu_asum_s = utils::make_quantized_buffer<scalar_t>(ex, asum_s);
+  auto gpu_nrm2_s = utils::make_quantized_buffer<scalar_t>(ex, nrm2_s);
+  auto gpu_iamax_s = blas::make_sycl_iterator_buffer<tuple_t>(batch_size);
+
+  _dot_batched(ex, size, gpu_x_v, incX, stride, gpu_y_v, incX, stride,
+               gpu_dot_s, batch_size);
+  _asum_batched(ex, size, gpu_x_v, incX, stride, gpu_asum_s, batch_size);
+  _nrm2_batched(ex, size, gpu_x_v, incX, stride, gpu_nrm2_s, batch_size);
+  _iamax_batched(ex, size, gpu_x_v, incX, stride, gpu_iamax_s, batch_size);
+  auto event0 = utils::quantized_copy_to_host<scalar_t>(ex, gpu_dot_s, dot_s);
+  auto event1 =
+      utils::quantized_copy_to_host<scalar_t>(ex, gpu_asum_s, asum_s);
+  auto event2 =
+      utils::quantized_copy_to_host<scalar_t>(ex, gpu_nrm2_s, nrm2_s);
+  auto event3 = ex.get_policy_handler().copy_to_host(
+      gpu_iamax_s, iamax_s.data(), batch_size);
+  ex.get_policy_handler().wait(event0);
+  ex.get_policy_handler().wait(event1);
+  ex.get_policy_handler().wait(event2);
+  ex.get_policy_handler().wait(event3);
+
+  // Validate the results against the reference applied to each vector
+  for (int b = 0; b < batch_size; b++) {
+    const data_t *x_b = x_v.data() + b * stride;
+    const data_t *y_b = y_v.data() + b * stride;
+    auto dot_cpu_s = reference_blas::dot(size, x_b, incX, y_b, incX);
+    auto asum_cpu_s = reference_blas::asum(size, x_b, incX);
+    auto nrm2_cpu_s = reference_blas::nrm2(size, x_b, incX);
+    int iamax_cpu_s = reference_blas::iamax(size, x_b, incX);
+
+    ASSERT_TRUE((utils::almost_equal<data_t, scalar_t>(dot_s[b], dot_cpu_s)));
+    ASSERT_TRUE(
+        (utils::almost_equal<data_t, scalar_t>(asum_s[b], asum_cpu_s)));
+    ASSERT_TRUE(
+        (utils::almost_equal<data_t, scalar_t>(nrm2_s[b], nrm2_cpu_s)));
+    ASSERT_EQ(iamax_cpu_s, iamax_s[b].ind);
+  }
+
+  ex.get_policy_handler().get_queue().wait();
+}
+
+#ifdef STRESS_TESTING
+const auto combi =
+    ::testing::Combine(::testing::Values(11, 65, 1002, 1002400),  // size
+                       ::testing::Values(1, 4),                   // incX
+                       ::testing::Values(0, 3),                   // padding
+                       ::testing::Values(1, 5, 64)                // batch
+    );
+#else
+const auto combi = ::testing::Combine(::testing::Values(11, 1002),  // size
+                                      ::testing::Values(1, 4),      // incX
+                                      ::testing::Values(0, 3),  // padding
+                                      ::testing::Values(1, 5)   // batch
+);
+#endif
+
+BLAS_REGISTER_TEST(BatchedReduction, combination_t, combi);
@@ -0,0 +1,88 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename blas1_device_scalar_test.cpp
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+
+template <typename scalar_t>
+using combination_t = std::tuple<int, int, int>;
+
+template <typename scalar_t>
+void run_test(const combination_t<scalar_t> combi) {
+  int size;
+  int incX;
+  int incY;
+  std::tie(size, incX, incY) = combi;
+
+  using data_t = utils::data_storage_t<scalar_t>;
+
+  std::vector<data_t> x_v(size * incX);
+  fill_random(x_v);
+  std::vector<data_t> y_v(size * incY);
+  fill_random(y_v);
+
+  // Keep the dot product small enough for cl::sycl::half
+  std::transform(std::begin(x_v), std::end(x_v), std::begin(x_v),
+                 [=](data_t x) { return x / x_v.size(); });
+
+  // Reference implementation: y = dot(x, y) * x + y, then x = dot(x, y) * x
+  std::vector<data_t> x_cpu_v = x_v;
+  std::vector<data_t> y_cpu_v = y_v;
+  data_t alpha_cpu =
+      reference_blas::dot(size, x_cpu_v.data(), incX, y_cpu_v.data(), incY);
+  reference_blas::axpy(size, alpha_cpu, x_cpu_v.data(), incX, y_cpu_v.data(),
+                       incY);
+  reference_blas::scal(size, alpha_cpu, x_cpu_v.data(), incX);
+
+  // SYCL implementation
+  auto q = make_queue();
+  test_executor_t ex(q);
+
+  auto gpu_x_v = utils::make_quantized_buffer<scalar_t>(ex, x_v);
+  auto gpu_y_v = utils::make_quantized_buffer<scalar_t>(ex, y_v);
+  auto gpu_alpha = blas::make_sycl_iterator_buffer<scalar_t>(1);
+
+  // The scalar computed by the dot is never copied to the host
+  _dot(ex, size, gpu_x_v, incX, gpu_y_v, incY, gpu_alpha);
+  _axpy(ex, size, gpu_alpha, gpu_x_v, incX, gpu_y_v, incY);
+  _scal(ex, size, gpu_alpha, gpu_x_v, incX);
+
+  auto event_x = utils::quantized_copy_to_host<scalar_t>(ex, gpu_x_v, x_v);
+  auto event_y = utils::quantized_copy_to_host<scalar_t>(ex, gpu_y_v, y_v);
+  ex.get_policy_handler().wait(event_x);
+  ex.get_policy_handler().wait(event_y);
+
+  // Validate the result
+  const bool isAlmostEqual =
+      utils::compare_vectors<data_t, scalar_t>(x_v, x_cpu_v) &&
+      utils::compare_vectors<data_t, scalar_t>(y_v, y_cpu_v);
+  ASSERT_TRUE(isAlmostEqual);
+}
+
+const auto combi = ::testing::Combine(::testing::Values(11, 1002),  // size
+                                      ::testing::Values(1, 4),      // incX
+                                      ::testing::Values(1, 3)       // incY
+);
+
+BLAS_REGISTER_TEST(DeviceScalar, combination_t, combi);
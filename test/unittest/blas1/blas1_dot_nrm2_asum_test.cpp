@@ -0,0 +1,114 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename blas1_dot_nrm2_asum_test.cpp
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+
+template <typename scalar_t>
+using combination_t = std::tuple<int, int, int, char>;
+
+template <typename scalar_t>
+void run_test(const combination_t<scalar_t> combi) {
+  int size;
+  int incX;
+  int incY;
+  char magnitude;
+  std::tie(size, incX, incY, magnitude) = combi;
+
+  using data_t = utils::data_storage_t<scalar_t>;
+
+  // The large and tiny magnitudes are chosen for the storage type
+  if (magnitude != 'n' && !std::is_same<data_t, scalar_t>::value) {
+    return;
+  }
+
+  // Input vectors
+  std::vector<data_t> x_v(size * incX);
+  fill_random(x_v);
+  std::vector<data_t> y_v(size * incY);
+  fill_random(y_v);
+
+  // We need to guarantee that cl::sycl::half can hold the sums
+  std::transform(std::begin(x_v), std::end(x_v), std::begin(x_v),
+                 [=](data_t x) { return x / x_v.size(); });
+
+  // Scale X so that the sum of its squares overflows ('l') or underflows
+  // ('t') while its norm does not
+  if (magnitude != 'n') {
+    const data_t factor =
+        std::sqrt((magnitude == 'l') ? std::numeric_limits<data_t>::max()
+                                     : std::numeric_limits<data_t>::min());
+    std::transform(std::begin(x_v), std::end(x_v), std::begin(x_v),
+                   [=](data_t x) { return x * factor; });
+  }
+
+  // Output vector
+  std::vector<data_t> out_s(3, 10.0);
+
+  // Reference implementation
+  auto dot_cpu_s =
+      reference_blas::dot(size, x_v.data(), incX, y_v.data(), incY);
+  auto nrm2_cpu_s = reference_blas::nrm2(size, x_v.data(), incX);
+  auto asum_cpu_s = reference_blas::asum(size, x_v.data(), incX);
+
+  // SYCL implementation
+  auto q = make_queue();
+  test_executor_t ex(q);
+
+  // Iterators
+  auto gpu_x_v = utils::make_quantized_buffer<scalar_t>(ex, x_v);
+  auto gpu_y_v = utils::make_quantized_buffer<scalar_t>(ex, y_v);
+  auto gpu_out_s = utils::make_quantized_buffer<scalar_t>(ex, out_s);
+
+  _dot_nrm2_asum(ex, size, gpu_x_v, incX, gpu_y_v, incY, gpu_out_s);
+  auto event = utils::quantized_copy_to_host<scalar_t>(ex, gpu_out_s, out_s);
+  ex.get_policy_handler().wait(event);
+
+  // Validate the results
+  const bool isAlmostEqual =
+      utils::almost_equal<data_t, scalar_t>(out_s[0], dot_cpu_s) &&
+      utils::almost_equal<data_t, scalar_t>(out_s[1], nrm2_cpu_s) &&
+      utils::almost_equal<data_t, scalar_t>(out_s[2], asum_cpu_s);
+  ASSERT_TRUE(isAlmostEqual);
+
+  ex.get_policy_handler().get_queue().wait();
+}
+
+#ifdef STRESS_TESTING
+const auto combi =
+    ::testing::Combine(::testing::Values(11, 65, 1002, 1002400),  // size
+                       ::testing::Values(1, 4),                   // incX
+                       ::testing::Values(1, 3),                   // incY
+                       ::testing::Values('n', 'l', 't')           // magnitude
+    );
+#else
+const auto combi =
+    ::testing::Combine(::testing::Values(11, 1002),      // size
+                       ::testing::Values(1, 4),          // incX
+                       ::testing::Values(1, 3),          // incY
+                       ::testing::Values('n', 'l', 't')  // magnitude
+    );
+#endif
+
+BLAS_REGISTER_TEST(DotNrm2Asum, combination_t, combi);
@@ -73,15 +73,19 @@ void run_test(const combination_t<scalar_t> combi) {
 
 #ifdef STRESS_TESTING
 const auto combi =
-    ::testing::Combine(::testing::Values(11, 65, 1002, 1002400),  // size
-                       ::testing::Values(1, 4),                   // incX
-                       ::testing::Values(1, 3)                    // incY
+    ::testing::Combine(::testing::Values(3, 11, 65, 1002, 1024,
+                                         1002400),  // size
+                       ::testing::Values(1, 4),     // incX
+                       ::testing::Values(1, 3)      // incY
     );
 #else
-const auto combi = ::testing::Combine(::testing::Values(11, 1002),  // size
-                                      ::testing::Values(1, 4),      // incX
-                                      ::testing::Values(1, 3)       // incY
-);
+// With unit increments, the sizes cover vectors shorter than a packet, a
+// partial last packet and whole packets only
+const auto combi =
+    ::testing::Combine(::testing::Values(3, 11, 1002, 1024),  // size
+                       ::testing::Values(1, 4),               // incX
+                       ::testing::Values(1, 3)                // incY
+    );
 #endif
 
 BLAS_REGISTER_TEST(Dot, combination_t, combi);
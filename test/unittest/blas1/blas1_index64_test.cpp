@@ -0,0 +1,95 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename blas1_index64_test.cpp
+ *
+ **************************************************************************/
+#include "blas_test.hpp"
+
+template <typename scalar_t>
+using combination_t = std::tuple<int64_t, int64_t>;
+
+// Calls the operations with an int64_t index and increment. These problems
+// fit in an int, so the wrappers dispatch them to the int instantiation.
+template <typename scalar_t>
+void run_test(const combination_t<scalar_t> combi) {
+  int64_t size;
+  int64_t inc;
+  std::tie(size, inc) = combi;
+
+  using data_t = utils::data_storage_t<scalar_t>;
+  const scalar_t alpha = scalar_t{1.5};
+
+  std::vector<data_t> x_v(size * inc);
+  fill_random(x_v);
+  std::vector<data_t> y_v(size * inc);
+  fill_random(y_v);
+  std::vector<data_t> dot_s(1, 10.0);
+
+  // We need to guarantee that cl::sycl::half can hold the sum
+  std::transform(std::begin(x_v), std::end(x_v), std::begin(x_v),
+                 [=](data_t x) { return x / x_v.size(); });
+
+  // Reference implementation
+  std::vector<data_t> y_cpu_v(y_v);
+  reference_blas::axpy(size, static_cast<data_t>(alpha), x_v.data(), inc,
+                       y_cpu_v.data(), inc);
+  auto dot_cpu_s =
+      reference_blas::dot(size, x_v.data(), inc, y_cpu_v.data(), inc);
+
+  // SYCL implementation
+  auto q = make_queue();
+  test_executor_t ex(q);
+
+  auto gpu_x_v = utils::make_quantized_buffer<scalar_t>(ex, x_v);
+  auto gpu_y_v = utils::make_quantized_buffer<scalar_t>(ex, y_v);
+  auto gpu_dot_s = utils::make_quantized_buffer<scalar_t>(ex, dot_s);
+
+  _axpy(ex, size, alpha, gpu_x_v, inc, gpu_y_v, inc);
+  _dot(ex, size, gpu_x_v, inc, gpu_y_v, inc, gpu_dot_s);
+  auto event = utils::quantized_copy_to_host<scalar_t>(ex, gpu_y_v, y_v);
+  ex.get_policy_handler().wait(event);
+  event = utils::quantized_copy_to_host<scalar_t>(ex, gpu_dot_s, dot_s);
+  ex.get_policy_handler().wait(event);
+
+  const bool isAlmostEqual =
+      utils::compare_vectors<data_t, scalar_t>(y_v, y_cpu_v) &&
+      utils::almost_equal<data_t, scalar_t>(dot_s[0], dot_cpu_s);
+  ASSERT_TRUE(isAlmostEqual);
+}
+
+const auto combi =
+    ::testing::Combine(::testing::Values<int64_t>(11, 1002),  // size
+                       ::testing::Values<int64_t>(1, 4)       // inc
+    );
+
+BLAS_REGISTER_TEST(Index64, combination_t, combi);
+
+// The extents checked by the wrappers are computed in 64 bits, so the ones
+// past the range of an int are kept in the int64_t instantiation
+TEST(Index64Extents, ExtentsPastIntRange) {
+  const int64_t size = int64_t{1} << 30;
+  const int64_t inc = 4;
+  ASSERT_FALSE(use_int_index<int64_t>(static_cast<int64_t>(size) * inc));
+  ASSERT_TRUE(use_int_index<int64_t>(static_cast<int64_t>(size) * 1));
+  // An int instantiation never dispatches to itself
+  ASSERT_FALSE(use_int_index<int>(static_cast<int64_t>(size)));
+}
@@ -0,0 +1,129 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename blas1_mixed_precision_test.cpp
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+
+template <typename scalar_t>
+using combination_t = std::tuple<int, int, int>;
+
+template <typename scalar_t>
+void run_test(const combination_t<scalar_t> combi) {
+  using data_t = utils::data_storage_t<scalar_t>;
+  using acc_t = typename blas::AccumulatorType<scalar_t>::type;
+
+  int size;
+  int incX;
+  int incY;
+  std::tie(size, incX, incY) = combi;
+
+  // Input vectors
+  std::vector<data_t> x_v(size * incX);
+  fill_random(x_v);
+  std::vector<data_t> y_v(size * incY);
+  fill_random(y_v);
+
+  // The reference uses the values as stored on the device
+  auto quantize = [](data_t x) {
+    return static_cast<data_t>(static_cast<scalar_t>(x));
+  };
+  std::transform(std::begin(x_v), std::end(x_v), std::begin(x_v), quantize);
+  std::transform(std::begin(y_v), std::end(y_v), std::begin(y_v), quantize);
+
+  // Reference results, computed in double
+  double dot_ref = 0.0;
+  double asum_ref = 0.0;
+  double ssq_ref = 0.0;
+  for (int i = 0; i < size; i++) {
+    const double x = static_cast<double>(x_v[i * incX]);
+    const double y = static_cast<double>(y_v[i * incY]);
+    dot_ref += x * y;
+    asum_ref += std::abs(x);
+    ssq_ref += x * x;
+  }
+  const data_t sb = 0.5;
+
+  // Output scalars
+  std::vector<acc_t> dot_s(1, 10.0);
+  std::vector<acc_t> asum_s(1, 10.0);
+  std::vector<acc_t> nrm2_s(1, 10.0);
+  std::vector<data_t> sdsdot_s(1, 10.0);
+
+  // SYCL implementation
+  auto q = make_queue();
+  test_executor_t ex(q);
+
+  // Iterators
+  auto gpu_x_v = utils::make_quantized_buffer<scalar_t>(ex, x_v);
+  auto gpu_y_v = utils::make_quantized_buffer<scalar_t>(ex, y_v);
+  auto gpu_dot_s = blas::make_sycl_iterator_buffer<acc_t>(dot_s, 1);
+  auto gpu_asum_s = blas::make_sycl_iterator_buffer<acc_t>(asum_s, 1);
+  auto gpu_nrm2_s = blas::make_sycl_iterator_buffer<acc_t>(nrm2_s, 1);
+  auto gpu_sdsdot_s = utils::make_quantized_buffer<scalar_t>(ex, sdsdot_s);
+
+  // The vectors are read in scalar_t and reduced in acc_t
+  _dsdot(ex, size, gpu_x_v, incX, gpu_y_v, incY, gpu_dot_s);
+  _asum(ex, size, gpu_x_v, incX, gpu_asum_s);
+  _nrm2(ex, size, gpu_x_v, incX, gpu_nrm2_s);
+  _sdsdot(ex, size, static_cast<scalar_t>(sb), gpu_x_v, incX, gpu_y_v, incY,
+          gpu_sdsdot_s);
+  auto event0 =
+      ex.get_policy_handler().copy_to_host(gpu_dot_s, dot_s.data(), 1);
+  auto event1 =
+      ex.get_policy_handler().copy_to_host(gpu_asum_s, asum_s.data(), 1);
+  auto event2 =
+      ex.get_policy_handler().copy_to_host(gpu_nrm2_s, nrm2_s.data(), 1);
+  auto event3 =
+      utils::quantized_copy_to_host<scalar_t>(ex, gpu_sdsdot_s, sdsdot_s);
+  ex.get_policy_handler().wait(event0);
+  ex.get_policy_handler().wait(event1);
+  ex.get_policy_handler().wait(event2);
+  ex.get_policy_handler().wait(event3);
+
+  // The accumulated results are checked with the tolerance of acc_t
+  ASSERT_TRUE(utils::almost_equal(dot_s[0], static_cast<acc_t>(dot_ref)));
+  ASSERT_TRUE(utils::almost_equal(asum_s[0], static_cast<acc_t>(asum_ref)));
+  ASSERT_TRUE(
+      utils::almost_equal(nrm2_s[0], static_cast<acc_t>(std::sqrt(ssq_ref))));
+  // _sdsdot only rounds to scalar_t once, after the addition of sb
+  ASSERT_TRUE((utils::almost_equal<data_t, scalar_t>(
+      sdsdot_s[0], static_cast<data_t>(sb + dot_ref))));
+
+  ex.get_policy_handler().get_queue().wait();
+}
+
+#ifdef STRESS_TESTING
+const auto combi =
+    ::testing::Combine(::testing::Values(11, 65, 1002, 1002400),  // size
+                       ::testing::Values(1, 4),                   // incX
+                       ::testing::Values(1, 3)                    // incY
+    );
+#else
+const auto combi = ::testing::Combine(::testing::Values(11, 1002),  // size
+                                      ::testing::Values(1, 4),      // incX
+                                      ::testing::Values(1, 3)       // incY
+);
+#endif
+
+BLAS_REGISTER_TEST(MixedPrecision, combination_t, combi);
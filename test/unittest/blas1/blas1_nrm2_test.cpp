@@ -26,20 +26,36 @@
 #include "blas_test.hpp"
 
 template <typename scalar_t>
-using combination_t = std::tuple<int, int>;
+using combination_t = std::tuple<int, int, char>;
 
 template <typename scalar_t>
 void run_test(const combination_t<scalar_t> combi) {
   int size;
   int incX;
-  std::tie(size, incX) = combi;
+  char magnitude;
+  std::tie(size, incX, magnitude) = combi;
 
   using data_t = utils::data_storage_t<scalar_t>;
 
+  // The large and tiny magnitudes are chosen for the storage type
+  if (magnitude != 'n' && !std::is_same<data_t, scalar_t>::value) {
+    return;
+  }
+
   // Input vectors
   std::vector<data_t> x_v(size * incX);
   fill_random(x_v);
 
+  // Scale the vector so that the sum of its squares overflows ('l') or
+  // underflows ('t') while its norm does not
+  if (magnitude != 'n') {
+    const data_t factor =
+        std::sqrt((magnitude == 'l') ? std::numeric_limits<data_t>::max()
+                                     : std::numeric_limits<data_t>::min());
+    std::transform(std::begin(x_v), std::end(x_v), std::begin(x_v),
+                   [=](data_t x) { return x * factor; });
+  }
+
   // Output vector
   std::vector<data_t> out_s(1, 10.0);
 
@@ -64,8 +80,10 @@ void run_test(const combination_t<scalar_t> combi) {
   ASSERT_TRUE(isAlmostEqual);
 }
 
-const auto combi = ::testing::Combine(::testing::Values(11, 1002),  // size
-                                      ::testing::Values(1, 4)       // incX
-);
+const auto combi =
+    ::testing::Combine(::testing::Values(11, 1002),     // size
+                       ::testing::Values(1, 4),         // incX
+                       ::testing::Values('n', 'l', 't')  // magnitude
+    );
 
 BLAS_REGISTER_TEST(Nrm2, combination_t, combi);
@@ -72,7 +72,7 @@ const auto combi =
 #else
 const auto combi = ::testing::Combine(::testing::Values(11, 1002),  // size
                                       ::testing::Values(0.0, 1.5),  // alpha
-                                      ::testing::Values(4)          // incX
+                                      ::testing::Values(1, 4)       // incX
 );
 #endif
 
@@ -0,0 +1,104 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename blas1_scalar_future_test.cpp
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+
+template <typename scalar_t>
+using combination_t = std::tuple<int, int>;
+
+template <typename scalar_t>
+void run_test(const combination_t<scalar_t> combi) {
+  int size;
+  int incX;
+  std::tie(size, incX) = combi;
+
+  using data_t = utils::data_storage_t<scalar_t>;
+
+  // Input vectors
+  std::vector<data_t> x_v(size * incX);
+  fill_random<data_t>(x_v);
+  std::vector<data_t> y_v(size * incX);
+  fill_random<data_t>(y_v);
+
+  // We need to guarantee that cl::sycl::half can hold the sums
+  std::transform(std::begin(x_v), std::end(x_v), std::begin(x_v),
+                 [=](data_t x) { return x / x_v.size(); });
+
+  // Reference implementation
+  data_t dot_cpu_s =
+      reference_blas::dot(size, x_v.data(), incX, y_v.data(), incX);
+  data_t asum_cpu_s = reference_blas::asum(size, x_v.data(), incX);
+  data_t nrm2_cpu_s = reference_blas::nrm2(size, x_v.data(), incX);
+  int iamax_cpu_s = reference_blas::iamax(size, x_v.data(), incX);
+  int iamin_cpu_s = reference_blas::iamin(size, x_v.data(), incX);
+
+  // SYCL implementation
+  auto q = make_queue();
+  test_executor_t ex(q);
+
+  // Iterators
+  auto gpu_x_v = utils::make_quantized_buffer<scalar_t>(ex, x_v);
+  auto gpu_y_v = utils::make_quantized_buffer<scalar_t>(ex, y_v);
+
+  // Enqueue all the reductions before reading any of the results
+  auto dot_f = _dot_async(ex, size, gpu_x_v, incX, gpu_y_v, incX);
+  auto asum_f = _asum_async(ex, size, gpu_x_v, incX);
+  auto nrm2_f = _nrm2_async(ex, size, gpu_x_v, incX);
+  auto iamax_f = _iamax_async(ex, size, gpu_x_v, incX);
+  auto iamin_f = _iamin_async(ex, size, gpu_x_v, incX);
+
+  // Futures dropped without being read wait for their copy to the host when
+  // they are destroyed, instead of leaving it to write to a freed slot
+  _dot_async(ex, size, gpu_x_v, incX, gpu_y_v, incX);
+  {
+    auto discarded_f = _asum_async(ex, size, gpu_x_v, incX);
+  }
+
+  // A copy keeps the value alive after the original is destroyed
+  auto nrm2_copy_f = [&]() {
+    auto original_f = _nrm2_async(ex, size, gpu_x_v, incX);
+    return original_f;
+  }();
+
+  // Validate the results
+  const bool isAlmostEqual =
+      utils::almost_equal<data_t, scalar_t>(dot_f.get(), dot_cpu_s) &&
+      utils::almost_equal<data_t, scalar_t>(asum_f.get(), asum_cpu_s) &&
+      utils::almost_equal<data_t, scalar_t>(nrm2_f.get(), nrm2_cpu_s) &&
+      utils::almost_equal<data_t, scalar_t>(nrm2_copy_f.get(), nrm2_cpu_s);
+  ASSERT_TRUE(isAlmostEqual);
+  ASSERT_EQ(iamax_f.get(), iamax_cpu_s);
+  ASSERT_EQ(iamin_f.get(), iamin_cpu_s);
+  ASSERT_TRUE(iamin_f.is_ready());
+
+  ex.get_policy_handler().get_queue().wait();
+}
+
+const auto combi =
+    ::testing::Combine(::testing::Values(11, 65, 10000, 1002400),  // size
+                       ::testing::Values(1, 4)                     // incX
+    );
+
+BLAS_REGISTER_TEST(ScalarFuture, combination_t, combi);
@@ -0,0 +1,118 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename blas2_gbmv_test.cpp
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+
+template <typename scalar_t>
+using combination_t =
+    std::tuple<int, int, int, int, scalar_t, scalar_t, char, int, int, int>;
+
+template <typename scalar_t>
+void run_test(const combination_t<scalar_t> combi) {
+  int m;
+  int n;
+  int kl;
+  int ku;
+  scalar_t alpha;
+  scalar_t beta;
+  char trans;
+  int incX;
+  int incY;
+  int lda_mul;
+  std::tie(m, n, kl, ku, alpha, beta, trans, incX, incY, lda_mul) = combi;
+
+  using data_t = utils::data_storage_t<scalar_t>;
+
+  const bool is_transposed = (trans != 'n');
+  const int x_size = is_transposed ? m : n;
+  const int y_size = is_transposed ? n : m;
+  // The band storage of the matrix
+  const int lda = (kl + ku + 1) * lda_mul;
+
+  // Input matrix
+  std::vector<data_t> a_m(lda * n);
+  fill_random(a_m);
+
+  // Input vector
+  std::vector<data_t> x_v(x_size * incX);
+  fill_random(x_v);
+
+  // Output vector
+  std::vector<data_t> y_v(y_size * incY, 1.0);
+  std::vector<data_t> y_cpu_v(y_size * incY, 1.0);
+
+  // SYSTEM GBMV
+  reference_blas::gbmv(&trans, m, n, kl, ku, static_cast<data_t>(alpha),
+                       a_m.data(), lda, x_v.data(), incX,
+                       static_cast<data_t>(beta), y_cpu_v.data(), incY);
+
+  auto q = make_queue();
+  test_executor_t ex(q);
+  auto a_m_gpu = utils::make_quantized_buffer<scalar_t>(ex, a_m);
+  auto x_v_gpu = utils::make_quantized_buffer<scalar_t>(ex, x_v);
+  auto y_v_gpu = utils::make_quantized_buffer<scalar_t>(ex, y_v);
+
+  // SYCLGBMV
+  _gbmv(ex, trans, m, n, kl, ku, alpha, a_m_gpu, lda, x_v_gpu, incX, beta,
+        y_v_gpu, incY);
+
+  auto event = utils::quantized_copy_to_host<scalar_t>(ex, y_v_gpu, y_v);
+  ex.get_policy_handler().wait(event);
+
+  const bool isAlmostEqual =
+      utils::compare_vectors<data_t, scalar_t>(y_v, y_cpu_v);
+  ASSERT_TRUE(isAlmostEqual);
+}
+
+#ifdef STRESS_TESTING
+const auto combi =
+    ::testing::Combine(::testing::Values(11, 65, 255, 1023),  // m
+                       ::testing::Values(14, 63, 257, 1010),  // n
+                       ::testing::Values(0, 1, 7, 40),        // kl
+                       ::testing::Values(0, 2, 33),           // ku
+                       ::testing::Values(0.0, 1.0, 1.5),      // alpha
+                       ::testing::Values(0.0, 1.0, 1.5),      // beta
+                       ::testing::Values('n', 't'),           // trans
+                       ::testing::Values(1, 2),               // incX
+                       ::testing::Values(1, 3),               // incY
+                       ::testing::Values(1, 2)                // lda_mul
+    );
+#else
+// For the purpose of travis and other slower platforms, we need a faster test
+const auto combi =
+    ::testing::Combine(::testing::Values(11, 1023),   // m
+                       ::testing::Values(14, 1010),   // n
+                       ::testing::Values(0, 7),       // kl
+                       ::testing::Values(2, 33),      // ku
+                       ::testing::Values(1.5),        // alpha
+                       ::testing::Values(0.0, 1.5),   // beta
+                       ::testing::Values('n', 't'),   // trans
+                       ::testing::Values(2),          // incX
+                       ::testing::Values(3),          // incY
+                       ::testing::Values(2)           // lda_mul
+    );
+#endif
+
+BLAS_REGISTER_TEST(Gbmv, combination_t, combi);
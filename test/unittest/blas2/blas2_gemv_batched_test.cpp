@@ -0,0 +1,162 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename blas2_gemv_batched_test.cpp
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+
+template <typename T>
+using combination_t =
+    std::tuple<int, int, T, T, bool, int, int, int, int, gemm_batch_type_t>;
+
+// Convert a batch of items of item_size elements stored one after the other to
+// the interleaved layout, in which the batch is the fastest dimension
+template <typename data_t>
+std::vector<data_t> strided_to_interleaved(const std::vector<data_t> &input,
+                                           int item_size, int batch) {
+  std::vector<data_t> output(input.size());
+  for (int b = 0; b < batch; ++b) {
+    for (int k = 0; k < item_size; ++k) {
+      output[k * batch + b] = input[b * item_size + k];
+    }
+  }
+  return output;
+}
+
+template <typename data_t>
+std::vector<data_t> interleaved_to_strided(const std::vector<data_t> &input,
+                                           int item_size, int batch) {
+  std::vector<data_t> output(input.size());
+  for (int b = 0; b < batch; ++b) {
+    for (int k = 0; k < item_size; ++k) {
+      output[b * item_size + k] = input[k * batch + b];
+    }
+  }
+  return output;
+}
+
+template <typename scalar_t>
+void run_test(const combination_t<scalar_t> combi) {
+  int m;
+  int n;
+  bool trans;
+  scalar_t alpha;
+  scalar_t beta;
+  int incX;
+  int incY;
+  int lda_mul;
+  int batch;
+  gemm_batch_type_t batch_type;
+  std::tie(m, n, alpha, beta, trans, incX, incY, lda_mul, batch, batch_type) =
+      combi;
+
+  using data_t = utils::data_storage_t<scalar_t>;
+
+  const char *t_str = trans ? "t" : "n";
+
+  const int lda = lda_mul * m;
+  const int x_len = trans ? m : n;
+  const int y_len = trans ? n : m;
+
+  // Size of each item of the batch in the strided layout
+  const int a_size = lda * n;
+  const int x_size = x_len * std::abs(incX);
+  const int y_size = y_len * std::abs(incY);
+
+  std::vector<data_t> a_m(a_size * batch);
+  std::vector<data_t> x_v(x_size * batch);
+  std::vector<data_t> y_v_gpu_result(y_size * batch, scalar_t(10.0));
+  std::vector<data_t> y_v_cpu(y_size * batch, scalar_t(10.0));
+
+  fill_random(a_m);
+  fill_random(x_v);
+  fill_random(y_v_cpu);
+  y_v_gpu_result = y_v_cpu;
+
+  // SYSTEM GEMV on each item of the batch
+  for (int b = 0; b < batch; b++) {
+    reference_blas::gemv(t_str, m, n, static_cast<data_t>(alpha),
+                         a_m.data() + b * a_size, lda, x_v.data() + b * x_size,
+                         incX, static_cast<data_t>(beta),
+                         y_v_cpu.data() + b * y_size, incY);
+  }
+
+  if (batch_type == gemm_batch_type_t::interleaved) {
+    a_m = strided_to_interleaved(a_m, a_size, batch);
+    x_v = strided_to_interleaved(x_v, x_size, batch);
+    y_v_gpu_result = strided_to_interleaved(y_v_gpu_result, y_size, batch);
+  }
+
+  auto q = make_queue();
+  test_executor_t ex(q);
+  auto m_a_gpu = utils::make_quantized_buffer<scalar_t>(ex, a_m);
+  auto v_x_gpu = utils::make_quantized_buffer<scalar_t>(ex, x_v);
+  auto v_y_gpu = utils::make_quantized_buffer<scalar_t>(ex, y_v_gpu_result);
+
+  // SYCL batched GEMV
+  _gemv_batched(ex, *t_str, m, n, alpha, m_a_gpu, lda, v_x_gpu, incX, beta,
+                v_y_gpu, incY, batch, batch_type);
+  auto event =
+      utils::quantized_copy_to_host<scalar_t>(ex, v_y_gpu, y_v_gpu_result);
+  ex.get_policy_handler().wait(event);
+
+  if (batch_type == gemm_batch_type_t::interleaved) {
+    y_v_gpu_result = interleaved_to_strided(y_v_gpu_result, y_size, batch);
+  }
+
+  const bool isAlmostEqual =
+      utils::compare_vectors<data_t, scalar_t>(y_v_gpu_result, y_v_cpu);
+  ASSERT_TRUE(isAlmostEqual);
+}
+
+#ifdef STRESS_TESTING
+const auto combi = ::testing::Combine(
+    ::testing::Values(11, 65, 255),      // m
+    ::testing::Values(14, 63, 257),      // n
+    ::testing::Values(0.0, 1.0, 1.5),    // alpha
+    ::testing::Values(0.0, 1.0, 1.5),    // beta
+    ::testing::Values(true, false),      // trans
+    ::testing::Values(1, -2),            // incX
+    ::testing::Values(1, 3),             // incY
+    ::testing::Values(1, 2),             // lda_mul
+    ::testing::Values(1, 5, 64),         // batch
+    ::testing::Values(gemm_batch_type_t::strided,
+                      gemm_batch_type_t::interleaved)  // batch_type
+);
+#else
+const auto combi = ::testing::Combine(
+    ::testing::Values(11, 65),           // m
+    ::testing::Values(14, 63),           // n
+    ::testing::Values(1.5),              // alpha
+    ::testing::Values(0.0, 1.5),         // beta
+    ::testing::Values(false, true),      // trans
+    ::testing::Values(1, -2),            // incX
+    ::testing::Values(3),                // incY
+    ::testing::Values(2),                // lda_mul
+    ::testing::Values(5),                // batch
+    ::testing::Values(gemm_batch_type_t::strided,
+                      gemm_batch_type_t::interleaved)  // batch_type
+);
+#endif
+
+BLAS_REGISTER_TEST(GemvBatched, combination_t, combi);
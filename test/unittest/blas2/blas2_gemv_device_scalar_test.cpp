@@ -0,0 +1,94 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename blas2_gemv_device_scalar_test.cpp
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+
+template <typename T>
+using combination_t = std::tuple<int, int, T, T, bool>;
+
+template <typename scalar_t>
+void run_test(const combination_t<scalar_t> combi) {
+  int m;
+  int n;
+  scalar_t alpha;
+  scalar_t beta;
+  bool trans;
+  std::tie(m, n, alpha, beta, trans) = combi;
+
+  using data_t = utils::data_storage_t<scalar_t>;
+
+  const char *t_str = trans ? "t" : "n";
+  const int x_size = trans ? m : n;
+  const int y_size = trans ? n : m;
+
+  std::vector<data_t> a_m(m * n);
+  std::vector<data_t> x_v(x_size);
+  std::vector<data_t> y_v_gpu_result(y_size);
+  fill_random(a_m);
+  fill_random(x_v);
+  fill_random(y_v_gpu_result);
+  std::vector<data_t> y_v_cpu = y_v_gpu_result;
+
+  // SYSTEM GEMV
+  reference_blas::gemv(t_str, m, n, static_cast<data_t>(alpha), a_m.data(), m,
+                       x_v.data(), 1, static_cast<data_t>(beta),
+                       y_v_cpu.data(), 1);
+
+  // A zero beta must ignore the values of y, even NaN
+  if (beta == scalar_t{0}) {
+    std::fill(std::begin(y_v_gpu_result), std::end(y_v_gpu_result),
+              std::numeric_limits<data_t>::quiet_NaN());
+  }
+
+  auto q = make_queue();
+  test_executor_t ex(q);
+  auto m_a_gpu = utils::make_quantized_buffer<scalar_t>(ex, a_m);
+  auto v_x_gpu = utils::make_quantized_buffer<scalar_t>(ex, x_v);
+  auto v_y_gpu = utils::make_quantized_buffer<scalar_t>(ex, y_v_gpu_result);
+  std::vector<data_t> alpha_v(1, static_cast<data_t>(alpha));
+  std::vector<data_t> beta_v(1, static_cast<data_t>(beta));
+  auto alpha_gpu = utils::make_quantized_buffer<scalar_t>(ex, alpha_v);
+  auto beta_gpu = utils::make_quantized_buffer<scalar_t>(ex, beta_v);
+
+  // SYCLGEMV with the scalars in device memory
+  _gemv(ex, *t_str, m, n, alpha_gpu, m_a_gpu, m, v_x_gpu, 1, beta_gpu, v_y_gpu,
+        1);
+  auto event =
+      utils::quantized_copy_to_host<scalar_t>(ex, v_y_gpu, y_v_gpu_result);
+  ex.get_policy_handler().wait(event);
+
+  const bool isAlmostEqual =
+      utils::compare_vectors<data_t, scalar_t>(y_v_gpu_result, y_v_cpu);
+  ASSERT_TRUE(isAlmostEqual);
+}
+
+const auto combi = ::testing::Combine(::testing::Values(11, 1023),     // m
+                                      ::testing::Values(14, 1010),     // n
+                                      ::testing::Values(1.5),          // alpha
+                                      ::testing::Values(0.0, 1.5),     // beta
+                                      ::testing::Values(false, true)  // trans
+);
+
+BLAS_REGISTER_TEST(GemvDeviceScalar, combination_t, combi);
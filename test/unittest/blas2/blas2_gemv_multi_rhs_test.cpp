@@ -0,0 +1,109 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename blas2_gemv_multi_rhs_test.cpp
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+
+template <typename T>
+using combination_t = std::tuple<int, int, T, T, bool, int, int>;
+
+template <typename scalar_t>
+void run_test(const combination_t<scalar_t> combi) {
+  int m;
+  int n;
+  bool trans;
+  scalar_t alpha;
+  scalar_t beta;
+  int n_rhs;
+  int ld_mul;
+  std::tie(m, n, alpha, beta, trans, n_rhs, ld_mul) = combi;
+
+  using data_t = utils::data_storage_t<scalar_t>;
+
+  const char *t_str = trans ? "t" : "n";
+
+  const int lda = ld_mul * m;
+  const int ldx = ld_mul * (trans ? m : n);
+  const int ldy = ld_mul * (trans ? n : m);
+
+  // Input matrix
+  std::vector<data_t> a_m(lda * n);
+  // Input vectors, one per column
+  std::vector<data_t> x_m(ldx * n_rhs);
+  // Output vectors, one per column
+  std::vector<data_t> y_m_gpu_result(ldy * n_rhs);
+
+  fill_random(a_m);
+  fill_random(x_m);
+  fill_random(y_m_gpu_result);
+  std::vector<data_t> y_m_cpu = y_m_gpu_result;
+
+  // SYSTEM GEMV on each vector
+  for (int r = 0; r < n_rhs; r++) {
+    reference_blas::gemv(t_str, m, n, static_cast<data_t>(alpha), a_m.data(),
+                         lda, x_m.data() + r * ldx, 1,
+                         static_cast<data_t>(beta), y_m_cpu.data() + r * ldy,
+                         1);
+  }
+
+  auto q = make_queue();
+  test_executor_t ex(q);
+  auto m_a_gpu = utils::make_quantized_buffer<scalar_t>(ex, a_m);
+  auto m_x_gpu = utils::make_quantized_buffer<scalar_t>(ex, x_m);
+  auto m_y_gpu = utils::make_quantized_buffer<scalar_t>(ex, y_m_gpu_result);
+
+  // SYCL multi vector GEMV
+  _gemv_multi_rhs(ex, *t_str, m, n, alpha, m_a_gpu, lda, m_x_gpu, ldx, beta,
+                  m_y_gpu, ldy, n_rhs);
+  auto event =
+      utils::quantized_copy_to_host<scalar_t>(ex, m_y_gpu, y_m_gpu_result);
+  ex.get_policy_handler().wait(event);
+
+  const bool isAlmostEqual =
+      utils::compare_vectors<data_t, scalar_t>(y_m_gpu_result, y_m_cpu);
+  ASSERT_TRUE(isAlmostEqual);
+}
+
+#ifdef STRESS_TESTING
+const auto combi =
+    ::testing::Combine(::testing::Values(11, 65, 255, 1023),  // m
+                       ::testing::Values(14, 63, 257, 1010),  // n
+                       ::testing::Values(0.0, 1.0, 1.5),      // alpha
+                       ::testing::Values(0.0, 1.0, 1.5),      // beta
+                       ::testing::Values(true, false),        // trans
+                       ::testing::Values(1, 2, 3, 8, 11),     // n_rhs
+                       ::testing::Values(1, 2)                // ld_mul
+    );
+#else
+const auto combi = ::testing::Combine(::testing::Values(11, 1023),     // m
+                                      ::testing::Values(14, 1010),     // n
+                                      ::testing::Values(1.5),          // alpha
+                                      ::testing::Values(0.0, 1.5),     // beta
+                                      ::testing::Values(false, true),  // trans
+                                      ::testing::Values(3, 11),        // n_rhs
+                                      ::testing::Values(2)  // ld_mul
+);
+#endif
+
+BLAS_REGISTER_TEST(GemvMultiRhs, combination_t, combi);
@@ -0,0 +1,108 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename blas2_tbsv_test.cpp
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+
+template <typename scalar_t>
+using combination_t = std::tuple<char, char, char, int, int, int, int>;
+
+template <typename scalar_t>
+void run_test(const combination_t<scalar_t> combi) {
+  char uplo;
+  char trans;
+  char diag;
+  int n;
+  int k;
+  int incX;
+  int lda_mul;
+  std::tie(uplo, trans, diag, n, k, incX, lda_mul) = combi;
+  // The band storage of the matrix
+  int lda = (k + 1) * lda_mul;
+
+  using data_t = utils::data_storage_t<scalar_t>;
+
+  // Input matrix
+  std::vector<data_t> a_m(lda * n);
+  fill_random(a_m);
+
+  // The off-diagonals are scaled down so that the diagonal dominates each row
+  // and the substitution is well conditioned, with or without a unit diagonal
+  const int diag_row = (uplo == 'u') ? k : 0;
+  for (int i = 0; i < n; i++) {
+    for (int r = 0; r <= k; r++) {
+      a_m[r + i * lda] = (r == diag_row)
+                             ? data_t{1}
+                             : a_m[r + i * lda] / static_cast<data_t>(10 * k);
+    }
+  }
+
+  // Right hand side, overwritten by the solution
+  std::vector<data_t> x_v(n * incX);
+  fill_random(x_v);
+  std::vector<data_t> x_cpu_v(x_v);
+
+  // SYSTEM TBSV
+  reference_blas::tbsv(&uplo, &trans, &diag, n, k, a_m.data(), lda,
+                       x_cpu_v.data(), incX);
+
+  auto q = make_queue();
+  test_executor_t ex(q);
+  auto a_m_gpu = utils::make_quantized_buffer<scalar_t>(ex, a_m);
+  auto x_v_gpu = utils::make_quantized_buffer<scalar_t>(ex, x_v);
+
+  // SYCLTBSV
+  _tbsv(ex, uplo, trans, diag, n, k, a_m_gpu, lda, x_v_gpu, incX);
+
+  auto event = utils::quantized_copy_to_host<scalar_t>(ex, x_v_gpu, x_v);
+  ex.get_policy_handler().wait(event);
+
+  const bool isAlmostEqual =
+      utils::compare_vectors<data_t, scalar_t>(x_v, x_cpu_v);
+  ASSERT_TRUE(isAlmostEqual);
+}
+
+#ifdef STRESS_TESTING
+const auto combi =
+    ::testing::Combine(::testing::Values('u', 'l'),                // UPLO
+                       ::testing::Values('n', 't'),                // TRANS
+                       ::testing::Values('u', 'n'),                // DIAG
+                       ::testing::Values(14, 63, 257, 1010, 2025), // n
+                       ::testing::Values(0, 1, 7, 40, 100),        // k
+                       ::testing::Values(1, 2),                    // incX
+                       ::testing::Values(1, 2)                     // lda_mul
+    );
+#else
+// For the purpose of travis and other slower platforms, we need a faster test
+const auto combi = ::testing::Combine(::testing::Values('u', 'l'),  // UPLO
+                                      ::testing::Values('n', 't'),  // TRANS
+                                      ::testing::Values('u', 'n'),  // DIAG
+                                      ::testing::Values(1010),      // n
+                                      ::testing::Values(1, 7, 100), // k
+                                      ::testing::Values(2),         // incX
+                                      ::testing::Values(2)          // lda_mul
+);
+#endif
+
+BLAS_REGISTER_TEST(Tbsv, combination_t, combi);
@@ -0,0 +1,89 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename blas2_tpmv_test.cpp
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+
+template <typename scalar_t>
+using combination_t = std::tuple<char, char, char, int, int>;
+
+template <typename scalar_t>
+void run_test(const combination_t<scalar_t> combi) {
+  char uplo;
+  char trans;
+  char diag;
+  int n;
+  int incX;
+  std::tie(uplo, trans, diag, n, incX) = combi;
+
+  using data_t = utils::data_storage_t<scalar_t>;
+
+  // Input matrix, in packed format
+  std::vector<data_t> a_p((n * (n + 1)) / 2);
+  fill_random(a_p);
+
+  // Output Vector
+  std::vector<data_t> x_v(n * incX);
+  fill_random(x_v);
+  std::vector<data_t> x_cpu_v(x_v);
+
+  // SYSTEM TPMV
+  reference_blas::tpmv(&uplo, &trans, &diag, n, a_p.data(), x_cpu_v.data(),
+                       incX);
+
+  auto q = make_queue();
+  test_executor_t ex(q);
+  auto a_p_gpu = utils::make_quantized_buffer<scalar_t>(ex, a_p);
+  auto x_v_gpu = utils::make_quantized_buffer<scalar_t>(ex, x_v);
+
+  // SYCLTPMV
+  _tpmv(ex, uplo, trans, diag, n, a_p_gpu, x_v_gpu, incX);
+
+  auto event = utils::quantized_copy_to_host<scalar_t>(ex, x_v_gpu, x_v);
+  ex.get_policy_handler().wait(event);
+
+  const bool isAlmostEqual =
+      utils::compare_vectors<data_t, scalar_t>(x_v, x_cpu_v);
+  ASSERT_TRUE(isAlmostEqual);
+}
+
+#ifdef STRESS_TESTING
+const auto combi =
+    ::testing::Combine(::testing::Values('u', 'l'),                // UPLO
+                       ::testing::Values('n', 't'),                // TRANS
+                       ::testing::Values('u', 'n'),                // DIAG
+                       ::testing::Values(14, 63, 257, 1010, 2025), // n
+                       ::testing::Values(1, 2)                     // incX
+    );
+#else
+// For the purpose of travis and other slower platforms, we need a faster test
+const auto combi = ::testing::Combine(::testing::Values('u', 'l'),  // UPLO
+                                      ::testing::Values('n', 't'),  // TRANS
+                                      ::testing::Values('u', 'n'),  // DIAG
+                                      ::testing::Values(2025),      // n
+                                      ::testing::Values(2)          // incX
+);
+#endif
+
+BLAS_REGISTER_TEST(Tpmv, combination_t, combi);
@@ -0,0 +1,104 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename blas2_trsv_test.cpp
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+
+template <typename scalar_t>
+using combination_t = std::tuple<char, char, char, int, int, int, scalar_t>;
+
+template <typename scalar_t>
+void run_test(const combination_t<scalar_t> combi) {
+  char uplo;
+  char trans;
+  char diag;
+  int n;
+  int incX;
+  int lda_mul;
+  scalar_t unused_value;
+  std::tie(uplo, trans, diag, n, incX, lda_mul, unused_value) = combi;
+  int lda = n * lda_mul;
+
+  using data_t = utils::data_storage_t<scalar_t>;
+
+  // Input matrix, well conditioned for the substitution
+  std::vector<data_t> a_m(lda * n);
+  const data_t diag_value =
+      diag == 'u' ? data_t{1} : random_scalar(data_t{1}, data_t{10});
+  fill_trsm_matrix(a_m, n, lda, uplo, diag_value,
+                   static_cast<data_t>(unused_value));
+
+  // Right hand side, overwritten by the solution
+  std::vector<data_t> x_v(n * incX);
+  fill_random(x_v);
+  std::vector<data_t> x_cpu_v(x_v);
+
+  // SYSTEM TRSV
+  reference_blas::trsv(&uplo, &trans, &diag, n, a_m.data(), lda,
+                       x_cpu_v.data(), incX);
+
+  auto q = make_queue();
+  test_executor_t ex(q);
+  auto a_m_gpu = utils::make_quantized_buffer<scalar_t>(ex, a_m);
+  auto x_v_gpu = utils::make_quantized_buffer<scalar_t>(ex, x_v);
+
+  // SYCLTRSV
+  _trsv(ex, uplo, trans, diag, n, a_m_gpu, lda, x_v_gpu, incX);
+
+  auto event = utils::quantized_copy_to_host<scalar_t>(ex, x_v_gpu, x_v);
+  ex.get_policy_handler().wait(event);
+
+  const bool isAlmostEqual =
+      utils::compare_vectors<data_t, scalar_t>(x_v, x_cpu_v);
+  ASSERT_TRUE(isAlmostEqual);
+}
+
+static constexpr double NaN = std::numeric_limits<double>::quiet_NaN();
+
+#ifdef STRESS_TESTING
+const auto combi =
+    ::testing::Combine(::testing::Values('u', 'l'),              // UPLO
+                       ::testing::Values('n', 't'),              // TRANS
+                       ::testing::Values('u', 'n'),              // DIAG
+                       ::testing::Values(1, 14, 63, 257, 2025),  // n
+                       ::testing::Values(1, 2),                  // incX
+                       ::testing::Values(1, 2),                  // lda_mul
+                       ::testing::Values(0.0, NaN)               // unused
+    );
+#else
+// For the purpose of travis and other slower platforms, we need a faster test
+const auto combi = ::testing::Combine(::testing::Values('u', 'l'),  // UPLO
+                                      ::testing::Values('n', 't'),  // TRANS
+                                      ::testing::Values('u', 'n'),  // DIAG
+                                      ::testing::Values(7, 1027),   // n
+                                      ::testing::Values(2),         // incX
+                                      ::testing::Values(2),         // lda_mul
+                                      ::testing::Values(NaN)        // unused
+);
+#endif
+
+// unused is a value that will be placed in the other triangle of the matrix and
+// is not meant to be accessed by the trsv implementation
+
+BLAS_REGISTER_TEST(Trsv, combination_t, combi);
@@ -0,0 +1,104 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename blas3_gemm_device_scalar_test.cpp
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+
+template <typename scalar_t>
+using combination_t = std::tuple<int, int, int, char, char, scalar_t, int>;
+
+template <typename scalar_t>
+void run_test(const combination_t<scalar_t> combi) {
+  int m;
+  int n;
+  int k;
+  char transa;
+  char transb;
+  scalar_t beta;
+  int ldc_mul;
+  std::tie(m, n, k, transa, transb, beta, ldc_mul) = combi;
+
+  using data_t = utils::data_storage_t<scalar_t>;
+
+  const char ta_str[2] = {transa, '\0'};
+  const char tb_str[2] = {transb, '\0'};
+  const scalar_t alpha = scalar_t{1.5};
+  const int lda = (transa != 'n') ? k : m;
+  const int ldb = (transb != 'n') ? n : k;
+  const int ldc = m * ldc_mul;
+
+  std::vector<data_t> a_m(m * k);
+  std::vector<data_t> b_m(k * n);
+  std::vector<data_t> c_m_gpu(ldc * n);
+  fill_random(a_m);
+  fill_random(b_m);
+  fill_random(c_m_gpu);
+  std::vector<data_t> c_m_cpu = c_m_gpu;
+
+  reference_blas::gemm(ta_str, tb_str, m, n, k, static_cast<data_t>(alpha),
+                       a_m.data(), lda, b_m.data(), ldb,
+                       static_cast<data_t>(beta), c_m_cpu.data(), ldc);
+
+  // A zero beta must ignore the values of C, even NaN
+  if (beta == scalar_t{0}) {
+    for (int j = 0; j < n; ++j) {
+      for (int i = 0; i < m; ++i) {
+        c_m_gpu[i + j * ldc] = std::numeric_limits<data_t>::quiet_NaN();
+      }
+    }
+  }
+
+  // SYCL implementation
+  auto q = make_queue();
+  test_executor_t ex(q);
+
+  auto m_a_gpu = utils::make_quantized_buffer<scalar_t>(ex, a_m);
+  auto m_b_gpu = utils::make_quantized_buffer<scalar_t>(ex, b_m);
+  auto m_c_gpu = utils::make_quantized_buffer<scalar_t>(ex, c_m_gpu);
+  std::vector<data_t> alpha_v(1, static_cast<data_t>(alpha));
+  std::vector<data_t> beta_v(1, static_cast<data_t>(beta));
+  auto alpha_gpu = utils::make_quantized_buffer<scalar_t>(ex, alpha_v);
+  auto beta_gpu = utils::make_quantized_buffer<scalar_t>(ex, beta_v);
+
+  _gemm(ex, transa, transb, m, n, k, alpha_gpu, m_a_gpu, lda, m_b_gpu, ldb,
+        beta_gpu, m_c_gpu, ldc);
+
+  auto event = utils::quantized_copy_to_host<scalar_t>(ex, m_c_gpu, c_m_gpu);
+  ex.get_policy_handler().wait(event);
+
+  const bool isAlmostEqual =
+      utils::compare_vectors<data_t, scalar_t>(c_m_gpu, c_m_cpu);
+  ASSERT_TRUE(isAlmostEqual);
+}
+
+const auto combi = ::testing::Combine(::testing::Values(11, 64),    // m
+                                      ::testing::Values(13, 64),    // n
+                                      ::testing::Values(17),        // k
+                                      ::testing::Values('n', 't'),  // transa
+                                      ::testing::Values('n', 't'),  // transb
+                                      ::testing::Values(0.0, 1.5),  // beta
+                                      ::testing::Values(1, 2)       // ldc_mul
+);
+
+BLAS_REGISTER_TEST(GemmDeviceScalar, combination_t, combi);
@@ -0,0 +1,164 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename blas3_gemm_epilogue_test.cpp
+ *
+ **************************************************************************/
+#include "blas_test.hpp"
+
+template <typename scalar_t>
+using combination_t =
+    std::tuple<int, int, int, char, char, scalar_t, scalar_t, gemm_bias_t,
+               gemm_activation_t, scalar_t>;
+
+// Applies the epilogue of _gemm_epilogue to the reference result on the host
+template <typename data_t>
+data_t reference_epilogue(data_t value, data_t bias, data_t residual,
+                          gemm_activation_t activation, data_t lower,
+                          data_t upper) {
+  value += bias + residual;
+  switch (activation) {
+    case gemm_activation_t::relu:
+      return std::max(value, data_t{0});
+    case gemm_activation_t::clamp:
+      return std::min(std::max(value, lower), upper);
+    case gemm_activation_t::gelu:
+      return data_t{0.5} * value *
+             (data_t{1} +
+              std::tanh(data_t{0.7978845608028654} *
+                        (value + data_t{0.044715} * value * value * value)));
+    default:
+      return value;
+  }
+}
+
+template <typename scalar_t>
+void run_test(const combination_t<scalar_t> combi) {
+  int m;
+  int n;
+  int k;
+  char transa;
+  char transb;
+  scalar_t alpha;
+  scalar_t beta;
+  gemm_bias_t bias_type;
+  gemm_activation_t activation;
+  scalar_t residual_scale;
+  std::tie(m, n, k, transa, transb, alpha, beta, bias_type, activation,
+           residual_scale) = combi;
+
+  using data_t = utils::data_storage_t<scalar_t>;
+
+  const char ta_str[2] = {transa, '\0'};
+  const char tb_str[2] = {transb, '\0'};
+  const scalar_t lower = scalar_t{-1};
+  const scalar_t upper = scalar_t{4};
+  const int lda = (transa != 'n') ? k : m;
+  const int ldb = (transb != 'n') ? n : k;
+  const int ldc = m;
+  const int ldr = m + 3;
+
+  std::vector<data_t> a_m(m * k);
+  std::vector<data_t> b_m(k * n);
+  std::vector<data_t> c_m_gpu(ldc * n);
+  std::vector<data_t> bias_m(bias_type == gemm_bias_t::column ? n : m);
+  std::vector<data_t> residual_m(ldr * n);
+  fill_random(a_m);
+  fill_random(b_m);
+  fill_random(c_m_gpu);
+  fill_random(bias_m);
+  fill_random(residual_m);
+  std::vector<data_t> c_m_cpu = c_m_gpu;
+
+  reference_blas::gemm(ta_str, tb_str, m, n, k, static_cast<data_t>(alpha),
+                       a_m.data(), lda, b_m.data(), ldb,
+                       static_cast<data_t>(beta), c_m_cpu.data(), ldc);
+  for (int j = 0; j < n; ++j) {
+    for (int i = 0; i < m; ++i) {
+      const data_t bias = bias_type == gemm_bias_t::row
+                              ? bias_m[i]
+                              : (bias_type == gemm_bias_t::column ? bias_m[j]
+                                                                  : data_t{0});
+      const data_t residual =
+          static_cast<data_t>(residual_scale) * residual_m[i + j * ldr];
+      c_m_cpu[i + j * ldc] = reference_epilogue(
+          c_m_cpu[i + j * ldc], bias, residual, activation,
+          static_cast<data_t>(lower), static_cast<data_t>(upper));
+    }
+  }
+
+  // SYCL implementation
+  auto q = make_queue();
+  test_executor_t ex(q);
+
+  auto m_a_gpu = utils::make_quantized_buffer<scalar_t>(ex, a_m);
+  auto m_b_gpu = utils::make_quantized_buffer<scalar_t>(ex, b_m);
+  auto m_c_gpu = utils::make_quantized_buffer<scalar_t>(ex, c_m_gpu);
+  auto bias_gpu = utils::make_quantized_buffer<scalar_t>(ex, bias_m);
+  auto residual_gpu = utils::make_quantized_buffer<scalar_t>(ex, residual_m);
+
+  _gemm_epilogue(ex, transa, transb, m, n, k, alpha, m_a_gpu, lda, m_b_gpu,
+                 ldb, beta, m_c_gpu, ldc, bias_type, bias_gpu, residual_scale,
+                 residual_gpu, ldr, activation, lower, upper);
+
+  auto event = utils::quantized_copy_to_host<scalar_t>(ex, m_c_gpu, c_m_gpu);
+  ex.get_policy_handler().wait(event);
+
+  const bool isAlmostEqual =
+      utils::compare_vectors<data_t, scalar_t>(c_m_gpu, c_m_cpu);
+  ASSERT_TRUE(isAlmostEqual);
+}
+
+#ifdef STRESS_TESTING
+const auto combi = ::testing::Combine(
+    ::testing::Values(11, 64, 253),  // m
+    ::testing::Values(13, 64, 257),  // n
+    ::testing::Values(17, 63),       // k
+    ::testing::Values('n', 't'),     // transa
+    ::testing::Values('n', 't'),     // transb
+    ::testing::Values(0.0, 1.5),     // alpha
+    ::testing::Values(0.0, 1.5),     // beta
+    ::testing::Values(gemm_bias_t::none, gemm_bias_t::row,
+                      gemm_bias_t::column),  // bias_type
+    ::testing::Values(gemm_activation_t::none, gemm_activation_t::relu,
+                      gemm_activation_t::clamp,
+                      gemm_activation_t::gelu),  // activation
+    ::testing::Values(0.0, 0.5)                  // residual_scale
+);
+#else
+// For the purpose of travis and other slower platforms, we need a faster test
+const auto combi = ::testing::Combine(
+    ::testing::Values(11, 64),     // m
+    ::testing::Values(13),         // n
+    ::testing::Values(17),         // k
+    ::testing::Values('n', 't'),   // transa
+    ::testing::Values('n'),        // transb
+    ::testing::Values(0.0, 1.5),   // alpha
+    ::testing::Values(0.0, 1.5),   // beta
+    ::testing::Values(gemm_bias_t::row,
+                      gemm_bias_t::column),  // bias_type
+    ::testing::Values(gemm_activation_t::relu, gemm_activation_t::clamp,
+                      gemm_activation_t::gelu),  // activation
+    ::testing::Values(0.0, 0.5)                  // residual_scale
+);
+#endif
+
+BLAS_REGISTER_TEST(GemmEpilogue, combination_t, combi);
@@ -0,0 +1,112 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename blas3_gemm_grouped_test.cpp
+ *
+ **************************************************************************/
+#include "blas_test.hpp"
+
+template <typename scalar_t>
+using combination_t = std::tuple<char, char, scalar_t, int>;
+
+template <typename scalar_t>
+void run_test(const combination_t<scalar_t> combi) {
+  char transa;
+  char transb;
+  scalar_t beta;
+  int ld_mul;
+  std::tie(transa, transb, beta, ld_mul) = combi;
+
+  using data_t = utils::data_storage_t<scalar_t>;
+
+  const char ta_str[2] = {transa, '\0'};
+  const char tb_str[2] = {transb, '\0'};
+  const scalar_t alpha = scalar_t{1.5};
+
+  // Problems of different shapes, including an empty one, packed one after
+  // the other in the same buffers
+  const std::vector<int> m = {11, 0, 64, 40, 1};
+  const std::vector<int> n = {13, 5, 64, 3, 70};
+  const std::vector<int> k = {17, 7, 33, 1, 9};
+  const int group_count = static_cast<int>(m.size());
+
+  std::vector<int> lda(group_count), ldb(group_count), ldc(group_count);
+  std::vector<int> offset_a(group_count), offset_b(group_count),
+      offset_c(group_count);
+  int size_a = 0, size_b = 0, size_c = 0;
+  for (int g = 0; g < group_count; ++g) {
+    lda[g] = ((transa != 'n') ? k[g] : m[g]) * ld_mul;
+    ldb[g] = ((transb != 'n') ? n[g] : k[g]) * ld_mul;
+    ldc[g] = m[g] * ld_mul;
+    offset_a[g] = size_a;
+    offset_b[g] = size_b;
+    offset_c[g] = size_c;
+    size_a += lda[g] * ((transa != 'n') ? m[g] : k[g]) + 1;
+    size_b += ldb[g] * ((transb != 'n') ? k[g] : n[g]) + 1;
+    size_c += ldc[g] * n[g] + 1;
+  }
+
+  std::vector<data_t> a_m(size_a);
+  std::vector<data_t> b_m(size_b);
+  std::vector<data_t> c_m_gpu(size_c);
+  fill_random(a_m);
+  fill_random(b_m);
+  fill_random(c_m_gpu);
+  std::vector<data_t> c_m_cpu = c_m_gpu;
+
+  for (int g = 0; g < group_count; ++g) {
+    if (m[g] == 0 || n[g] == 0) {
+      continue;
+    }
+    reference_blas::gemm(
+        ta_str, tb_str, m[g], n[g], k[g], static_cast<data_t>(alpha),
+        a_m.data() + offset_a[g], lda[g], b_m.data() + offset_b[g], ldb[g],
+        static_cast<data_t>(beta), c_m_cpu.data() + offset_c[g], ldc[g]);
+  }
+
+  // SYCL implementation
+  auto q = make_queue();
+  test_executor_t ex(q);
+
+  auto m_a_gpu = utils::make_quantized_buffer<scalar_t>(ex, a_m);
+  auto m_b_gpu = utils::make_quantized_buffer<scalar_t>(ex, b_m);
+  auto m_c_gpu = utils::make_quantized_buffer<scalar_t>(ex, c_m_gpu);
+
+  _gemm_grouped(ex, transa, transb, group_count, m.data(), n.data(), k.data(),
+                alpha, m_a_gpu, lda.data(), offset_a.data(), m_b_gpu,
+                ldb.data(), offset_b.data(), beta, m_c_gpu, ldc.data(),
+                offset_c.data());
+
+  auto event = utils::quantized_copy_to_host<scalar_t>(ex, m_c_gpu, c_m_gpu);
+  ex.get_policy_handler().wait(event);
+
+  const bool isAlmostEqual =
+      utils::compare_vectors<data_t, scalar_t>(c_m_gpu, c_m_cpu);
+  ASSERT_TRUE(isAlmostEqual);
+}
+
+const auto combi = ::testing::Combine(::testing::Values('n', 't'),  // transa
+                                      ::testing::Values('n', 't'),  // transb
+                                      ::testing::Values(0.0, 1.5),  // beta
+                                      ::testing::Values(1, 2)       // ld_mul
+);
+
+BLAS_REGISTER_TEST(GemmGrouped, combination_t, combi);
@@ -0,0 +1,146 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename blas3_gemm_int8_test.cpp
+ *
+ **************************************************************************/
+#include "blas_test.hpp"
+
+// The scale of the requantization is the only floating point parameter, so the
+// test is only registered for float
+template <typename scalar_t>
+using combination_t = std::tuple<int, int, int, char, char, scalar_t, int>;
+
+// Fills an int8 matrix with values spanning the whole int8 range
+static inline void fill_random_int8(std::vector<int8_t>& vec) {
+  for (int8_t& e : vec) {
+    e = static_cast<int8_t>(std::lround(random_scalar(-128.f, 127.f)));
+  }
+}
+
+// Requantizes the int32 reference result on the host, as done by _gemm_int8
+template <typename out_t>
+out_t reference_requantize(int32_t value, float scale, int32_t zero_point) {
+  const float requantized =
+      std::nearbyint(static_cast<float>(value) * scale) +
+      static_cast<float>(zero_point);
+  const float lowest = static_cast<float>(std::numeric_limits<out_t>::min());
+  const float highest =
+      std::min(static_cast<float>(std::numeric_limits<out_t>::max()),
+               2147483520.f);
+  return static_cast<out_t>(std::min(std::max(requantized, lowest), highest));
+}
+
+template <typename out_t>
+void run_int8_test(int m, int n, int k, char transa, char transb, float scale,
+                   int32_t zero_point) {
+  const int lda = (transa != 'n') ? k : m;
+  const int ldb = (transb != 'n') ? n : k;
+  const int ldc = m + 1;
+  const bool trans_a = transa != 'n';
+  const bool trans_b = transb != 'n';
+
+  std::vector<int8_t> a_m(m * k);
+  std::vector<int8_t> b_m(k * n);
+  fill_random_int8(a_m);
+  fill_random_int8(b_m);
+  // The elements of C outside of the matrix must be left untouched
+  std::vector<out_t> c_m_gpu(ldc * n, out_t{7});
+  std::vector<out_t> c_m_cpu = c_m_gpu;
+
+  // The reference accumulates exactly in int32
+  for (int j = 0; j < n; ++j) {
+    for (int i = 0; i < m; ++i) {
+      int32_t acc = 0;
+      for (int l = 0; l < k; ++l) {
+        const int32_t a = a_m[trans_a ? l + i * lda : i + l * lda];
+        const int32_t b = b_m[trans_b ? j + l * ldb : l + j * ldb];
+        acc += a * b;
+      }
+      // An int32 C with a unit scale and no zero point receives acc as is
+      const bool raw = std::is_same<out_t, int32_t>::value && scale == 1.f &&
+                       zero_point == 0;
+      c_m_cpu[i + j * ldc] =
+          raw ? static_cast<out_t>(acc)
+              : reference_requantize<out_t>(acc, scale, zero_point);
+    }
+  }
+
+  // SYCL implementation
+  auto q = make_queue();
+  test_executor_t ex(q);
+
+  auto m_a_gpu = blas::make_sycl_iterator_buffer<int8_t>(a_m, m * k);
+  auto m_b_gpu = blas::make_sycl_iterator_buffer<int8_t>(b_m, k * n);
+  auto m_c_gpu = blas::make_sycl_iterator_buffer<out_t>(c_m_gpu, ldc * n);
+
+  _gemm_int8(ex, transa, transb, m, n, k, m_a_gpu, lda, m_b_gpu, ldb, m_c_gpu,
+             ldc, scale, zero_point);
+
+  auto event = ex.get_policy_handler().copy_to_host(m_c_gpu, c_m_gpu.data(),
+                                                    ldc * n);
+  ex.get_policy_handler().wait(event);
+
+  // The result is exact, as the host and the device round the same way
+  ASSERT_EQ(c_m_gpu, c_m_cpu);
+}
+
+template <typename scalar_t>
+void run_test(const combination_t<scalar_t> combi) {
+  int m;
+  int n;
+  int k;
+  char transa;
+  char transb;
+  scalar_t scale;
+  int zero_point;
+  std::tie(m, n, k, transa, transb, scale, zero_point) = combi;
+
+  run_int8_test<int32_t>(m, n, k, transa, transb, scale, zero_point);
+  run_int8_test<int8_t>(m, n, k, transa, transb, scale, zero_point);
+  run_int8_test<uint8_t>(m, n, k, transa, transb, scale, zero_point);
+}
+
+#ifdef STRESS_TESTING
+const auto combi =
+    ::testing::Combine(::testing::Values(11, 64, 253),     // m
+                       ::testing::Values(13, 64, 257),     // n
+                       ::testing::Values(17, 63, 1024),    // k
+                       ::testing::Values('n', 't'),        // transa
+                       ::testing::Values('n', 't'),        // transb
+                       ::testing::Values(1.0f, 0.00093f),  // scale
+                       ::testing::Values(0, -5, 128)       // zero_point
+    );
+#else
+// For the purpose of travis and other slower platforms, we need a faster test
+const auto combi =
+    ::testing::Combine(::testing::Values(11, 64),          // m
+                       ::testing::Values(13, 64),          // n
+                       ::testing::Values(17),              // k
+                       ::testing::Values('n', 't'),        // transa
+                       ::testing::Values('n', 't'),        // transb
+                       ::testing::Values(1.0f, 0.00093f),  // scale
+                       ::testing::Values(0, 128)           // zero_point
+    );
+#endif
+
+BLAS_REGISTER_TEST_FLOAT(GemmInt8, GemmInt8, run_test, combination_t, combi);
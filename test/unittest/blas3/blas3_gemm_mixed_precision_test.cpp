@@ -0,0 +1,153 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename blas3_gemm_mixed_precision_test.cpp
+ *
+ **************************************************************************/
+#include "blas_test.hpp"
+
+template <typename scalar_t>
+using combination_t = std::tuple<int, int, int, char, char, double, double>;
+
+template <typename scalar_t>
+void run_test(const combination_t<scalar_t> combi) {
+  using data_t = utils::data_storage_t<scalar_t>;
+  using acc_t = typename blas::AccumulatorType<scalar_t>::type;
+
+  int m;
+  int n;
+  int k;
+  char transa;
+  char transb;
+  double alpha;
+  double beta;
+  std::tie(m, n, k, transa, transb, alpha, beta) = combi;
+
+  const int lda = (transa != 'n') ? k : m;
+  const int ldb = (transb != 'n') ? n : k;
+  const int ldc = m + 2;
+  const bool trans_a = transa != 'n';
+  const bool trans_b = transb != 'n';
+
+  std::vector<data_t> a_m(m * k);
+  std::vector<data_t> b_m(k * n);
+  std::vector<data_t> c_m(ldc * n);
+  fill_random(a_m);
+  fill_random(b_m);
+  fill_random(c_m);
+
+  // The reference uses the values as stored on the device
+  auto quantize = [](data_t x) {
+    return static_cast<data_t>(static_cast<scalar_t>(x));
+  };
+  std::transform(std::begin(a_m), std::end(a_m), std::begin(a_m), quantize);
+  std::transform(std::begin(b_m), std::end(b_m), std::begin(b_m), quantize);
+  std::transform(std::begin(c_m), std::end(c_m), std::begin(c_m), quantize);
+
+  // Reference result, computed in double
+  std::vector<double> c_ref(ldc * n);
+  for (int j = 0; j < n; ++j) {
+    for (int i = 0; i < m; ++i) {
+      double acc = 0.0;
+      for (int l = 0; l < k; ++l) {
+        acc += static_cast<double>(a_m[trans_a ? l + i * lda : i + l * lda]) *
+               static_cast<double>(b_m[trans_b ? j + l * ldb : l + j * ldb]);
+      }
+      c_ref[i + j * ldc] =
+          alpha * acc + beta * static_cast<double>(c_m[i + j * ldc]);
+    }
+  }
+
+  // SYCL implementation
+  auto q = make_queue();
+  test_executor_t ex(q);
+
+  auto m_a_gpu = utils::make_quantized_buffer<scalar_t>(ex, a_m);
+  auto m_b_gpu = utils::make_quantized_buffer<scalar_t>(ex, b_m);
+
+  // C stored in the accumulation type
+  {
+    std::vector<acc_t> c_acc(std::begin(c_m), std::end(c_m));
+    auto m_c_gpu = blas::make_sycl_iterator_buffer<acc_t>(c_acc, ldc * n);
+    _gemm(ex, transa, transb, m, n, k, static_cast<acc_t>(alpha), m_a_gpu, lda,
+          m_b_gpu, ldb, static_cast<acc_t>(beta), m_c_gpu, ldc);
+    auto event = ex.get_policy_handler().copy_to_host(m_c_gpu, c_acc.data(),
+                                                      ldc * n);
+    ex.get_policy_handler().wait(event);
+
+    // The accumulated result is checked with the tolerance of acc_t
+    std::vector<acc_t> expected(ldc * n);
+    for (int j = 0; j < n; ++j) {
+      for (int i = 0; i < ldc; ++i) {
+        expected[i + j * ldc] = i < m ? static_cast<acc_t>(c_ref[i + j * ldc])
+                                      : static_cast<acc_t>(c_m[i + j * ldc]);
+      }
+    }
+    ASSERT_TRUE(utils::compare_vectors(c_acc, expected));
+  }
+
+  // C stored in scalar_t, as A and B
+  {
+    std::vector<data_t> c_gpu = c_m;
+    auto m_c_gpu = utils::make_quantized_buffer<scalar_t>(ex, c_gpu);
+    _gemm(ex, transa, transb, m, n, k, static_cast<acc_t>(alpha), m_a_gpu, lda,
+          m_b_gpu, ldb, static_cast<acc_t>(beta), m_c_gpu, ldc);
+    auto event = utils::quantized_copy_to_host<scalar_t>(ex, m_c_gpu, c_gpu);
+    ex.get_policy_handler().wait(event);
+
+    // Only the final result is rounded to scalar_t
+    std::vector<data_t> expected(ldc * n);
+    for (int j = 0; j < n; ++j) {
+      for (int i = 0; i < ldc; ++i) {
+        expected[i + j * ldc] = i < m ? static_cast<data_t>(c_ref[i + j * ldc])
+                                      : c_m[i + j * ldc];
+      }
+    }
+    ASSERT_TRUE((utils::compare_vectors<data_t, scalar_t>(c_gpu, expected)));
+  }
+
+  ex.get_policy_handler().get_queue().wait();
+}
+
+#ifdef STRESS_TESTING
+const auto combi =
+    ::testing::Combine(::testing::Values(11, 64, 253),   // m
+                       ::testing::Values(13, 64, 257),   // n
+                       ::testing::Values(17, 63, 1024),  // k
+                       ::testing::Values('n', 't'),      // transa
+                       ::testing::Values('n', 't'),      // transb
+                       ::testing::Values(0.0, 1.5),      // alpha
+                       ::testing::Values(0.0, 1.5)       // beta
+    );
+#else
+// For the purpose of travis and other slower platforms, we need a faster test
+const auto combi = ::testing::Combine(::testing::Values(11, 64),    // m
+                                      ::testing::Values(13, 64),    // n
+                                      ::testing::Values(17, 257),   // k
+                                      ::testing::Values('n', 't'),  // transa
+                                      ::testing::Values('n', 't'),  // transb
+                                      ::testing::Values(0.0, 1.5),  // alpha
+                                      ::testing::Values(0.0, 1.5)   // beta
+);
+#endif
+
+BLAS_REGISTER_TEST(GemmMixedPrecision, combination_t, combi);
@@ -0,0 +1,86 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename sycl_workspace_pool_test.cpp
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+
+template <typename scalar_t>
+using combination_t = std::tuple<int, int>;
+
+template <typename scalar_t>
+void run_test(const combination_t<scalar_t> combi) {
+  int size;
+  int repetitions;
+  std::tie(size, repetitions) = combi;
+
+  using data_t = utils::data_storage_t<scalar_t>;
+
+  std::vector<data_t> x_v(size);
+  fill_random<data_t>(x_v);
+
+  // We need to guarantee that cl::sycl::half can hold the sum
+  std::transform(std::begin(x_v), std::end(x_v), std::begin(x_v),
+                 [=](data_t x) { return x / x_v.size(); });
+
+  data_t out_s = 0;
+  data_t out_cpu_s = reference_blas::asum(size, x_v.data(), 1);
+
+  auto q = make_queue();
+  test_executor_t ex(q);
+
+  auto gpu_x_v = utils::make_quantized_buffer<scalar_t>(ex, x_v);
+  auto gpu_out_s = utils::make_quantized_buffer<scalar_t>(ex, out_s);
+
+  for (int i = 0; i < repetitions; ++i) {
+    _asum(ex, size, gpu_x_v, 1, gpu_out_s);
+  }
+  auto event = utils::quantized_copy_to_host<scalar_t>(ex, gpu_out_s, out_s);
+  ex.get_policy_handler().wait(event);
+
+  ASSERT_TRUE((utils::almost_equal<data_t, scalar_t>(out_s, out_cpu_s)));
+
+  // Only the first reduction allocates its scratch buffer
+  auto stats = ex.get_policy_handler().get_workspace_stats();
+  ASSERT_EQ(stats.misses, size_t(1));
+  ASSERT_EQ(stats.hits, size_t(repetitions - 1));
+  ASSERT_GE(stats.bytes_held, size_t(blas::WorkspacePool::min_bucket_size));
+
+  // All the reductions share the synchronization counter
+  auto counter = ex.get_policy_handler().get_sync_counter();
+  auto next_counter = ex.get_policy_handler().get_sync_counter();
+  ASSERT_TRUE(counter.get_buffer() == next_counter.get_buffer());
+
+  ex.get_policy_handler().trim_workspace();
+  stats = ex.get_policy_handler().get_workspace_stats();
+  ASSERT_EQ(stats.bytes_held, size_t(0));
+
+  ex.get_policy_handler().get_queue().wait();
+}
+
+const auto combi =
+    ::testing::Combine(::testing::Values(11, 10000),  // size
+                       ::testing::Values(1, 5, 20)    // repetitions
+    );
+
+BLAS_REGISTER_TEST(WorkspacePool, combination_t, combi);
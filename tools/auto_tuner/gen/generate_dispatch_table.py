@@ -0,0 +1,254 @@
+#!/usr/bin/env python
+
+import argparse
+import json
+import sys
+
+from collections import namedtuple
+
+_BLAS_MEM_STRING = {
+    "local": "gemm_memory_t::local",
+    "no_local": "gemm_memory_t::no_local",
+}
+
+_BLAS_ALGO_STRING = {
+    "standard": "gemm_algorithm_t::standard",
+    "naive": "gemm_algorithm_t::naive",
+    "tall_skinny": "gemm_algorithm_t::tall_skinny",
+}
+
+_BLAS_VECTORIZATION_TYPE = {
+    "none": "gemm_vectorization_t::none",
+    "partial": "gemm_vectorization_t::partial",
+    "full": "gemm_vectorization_t::full",
+}
+
+_BLAS_BATCH_TYPE = {
+    "strided": "gemm_batch_type_t::strided",
+    "interleaved": "gemm_batch_type_t::interleaved",
+}
+
+
+def _bool_to_str(val):
+    """ Convert Python bool to the C++ and CMake string 'true' or 'false'. """
+    return 'true' if val else 'false'
+
+
+def _bucket_bounds(size):
+    """
+    Return the bounds (lo, hi] of the power of two bucket holding size.
+
+    Problems are bucketed by the next power of two of each dimension, so the
+    configuration tuned on one shape is used for all the shapes of similar
+    size.
+    """
+    hi = 1
+    while hi < size:
+        hi *= 2
+    return (hi // 2, hi)
+
+
+class Bucket(
+        namedtuple('Bucket', [
+            'trans_a', 'trans_b', 'batched', 'batch', 'm', 'n', 'k'
+        ])):
+    """ The range of problems a tuned configuration is used for. """
+    __slots__ = ()
+
+    def condition(self):
+        """ C++ condition matching the problems of the bucket. """
+        conds = [
+            "{}_t_a".format("" if self.trans_a else "!"),
+            "{}_t_b".format("" if self.trans_b else "!"),
+            "batch_type == {}".format(_BLAS_BATCH_TYPE[self.batch]),
+            "batch_size {} 1".format(">" if self.batched else "=="),
+        ]
+        for name, (lo, hi) in (("_M", self.m), ("_N", self.n), ("_K",
+                                                                  self.k)):
+            conds.append("{0} > {1} && {0} <= {2}".format(name, lo, hi))
+        return " &&\n        ".join(conds)
+
+
+class TunedConfig(
+        namedtuple('TunedConfig', [
+            'cache_size', 'tile', 'double_buffer', 'bank_conf_a',
+            'bank_conf_b', 'mem_type', 'algo_type', 'batch_type', 'vec_type',
+            'vec_size'
+        ])):
+    """ A GEMM configuration picked by the tuner. """
+    __slots__ = ()
+
+    @staticmethod
+    def from_result(result):
+        return TunedConfig(result["cache_size"], tuple(result["tile"]),
+                           result["double_buffer"], result["bank_conf_a"],
+                           result["bank_conf_b"], result["mem_type"],
+                           result["algo_type"], result["batch_type"],
+                           result["vec_type"], result["vec_size"])
+
+    def wg_size(self):
+        # group_rows * group_cols * wg_batchs
+        return self.tile[2] * self.tile[3] * self.tile[9]
+
+    def to_launcher(self):
+        return ("Gemm_Launcher<\n"
+                "          {wg}, {db}, {bca}, {bcb}, {cls}, Tile<{tile}>,\n"
+                "          _t_a, _t_b, static_cast<int>({mem}),\n"
+                "          static_cast<int>({algo}),\n"
+                "          static_cast<int>({vec}), is_beta_zero, {vs},\n"
+                "          static_cast<int>({batch})>").format(
+                    wg=self.wg_size(),
+                    db=_bool_to_str(self.double_buffer),
+                    bca=_bool_to_str(self.bank_conf_a),
+                    bcb=_bool_to_str(self.bank_conf_b),
+                    cls=self.cache_size,
+                    tile=", ".join(map(str, self.tile)),
+                    mem=_BLAS_MEM_STRING[self.mem_type],
+                    algo=_BLAS_ALGO_STRING[self.algo_type],
+                    vec=_BLAS_VECTORIZATION_TYPE[self.vec_type],
+                    vs=self.vec_size,
+                    batch=_BLAS_BATCH_TYPE[self.batch_type])
+
+    def to_cmake(self, data):
+        return ('add_gemm_configuration(\n'
+                '  "{data}" {wg} "{db}" "{bca}" "{bcb}"\n'
+                '  {cls} {tile} "{mem}" "{algo}" "{vec}" {vs} "{batch}")'
+                ).format(data=data,
+                         wg=self.wg_size(),
+                         db=_bool_to_str(self.double_buffer),
+                         bca=_bool_to_str(self.bank_conf_a),
+                         bcb=_bool_to_str(self.bank_conf_b),
+                         cls=self.cache_size,
+                         tile=" ".join(map(str, self.tile)),
+                         mem=self.mem_type,
+                         algo=self.algo_type,
+                         vec=self.vec_type,
+                         vs=self.vec_size,
+                         batch=self.batch_type)
+
+
+def read_results(results_file):
+    """
+    Read the results written by tune_csv and keep the fastest configuration
+    of each bucket.
+    """
+    table = {}
+    for line in results_file:
+        line = line.strip()
+        if not line:
+            continue
+        result = json.loads(line)
+        bucket = Bucket(result["trans_a"], result["trans_b"],
+                        result["batch_size"] > 1, result["batch"],
+                        _bucket_bounds(result["m"]),
+                        _bucket_bounds(result["n"]),
+                        _bucket_bounds(result["k"]))
+        best = table.get(bucket)
+        if best is None or result["gflops"] > best[0]:
+            table[bucket] = (result["gflops"], TunedConfig.from_result(result))
+    return [(bucket, table[bucket][1]) for bucket in sorted(table)]
+
+
+def write_header(table, data, source, output_file):
+    """
+    Write the header defining TunedGemm, which launches the tuned
+    configuration of the bucket a problem falls in.
+    """
+    branches = []
+    for bucket, config in table:
+        branches.append(
+            "    if ({cond}) {{\n"
+            "      return blas::{launcher}::template _select_gemm(\n"
+            "          ex, _M, _N, _K, _alpha, _a, _lda, _b, _ldb, _beta, _c,\n"
+            "          _ldc, batch_size);\n"
+            "    }}".format(cond=bucket.condition(),
+                            launcher=config.to_launcher()))
+    output_file.write(r'''// File generated by gen/generate_dispatch_table.py
+// Results from: {source}
+#ifndef SYCL_BLAS_GEMM_TUNED_TABLE_HPP
+#define SYCL_BLAS_GEMM_TUNED_TABLE_HPP
+#include "interface/gemm_launcher.h"
+
+namespace blas {{
+namespace gemm {{
+namespace backend {{
+
+/*!
+ * @brief Launches the configuration the auto-tuner picked for problems of the
+ * size of the given one. Returns no event when no tuned configuration covers
+ * the problem, in which case the backend default should be used.
+ */
+template <bool _t_a, bool _t_b, bool is_beta_zero, typename element_t>
+struct TunedGemm {{
+  template <typename executor_t, typename container_0_t,
+            typename container_1_t, typename container_2_t, typename index_t>
+  static typename executor_t::policy_t::event_t _gemm(
+      executor_t& ex, index_t _M, index_t _N, index_t _K, element_t _alpha,
+      container_0_t _a, index_t _lda, container_1_t _b, index_t _ldb,
+      element_t _beta, container_2_t _c, index_t _ldc, index_t batch_size,
+      gemm_batch_type_t batch_type) {{
+    return {{}};
+  }}
+}};
+
+template <bool _t_a, bool _t_b, bool is_beta_zero>
+struct TunedGemm<_t_a, _t_b, is_beta_zero, {data}> {{
+  template <typename executor_t, typename container_0_t,
+            typename container_1_t, typename container_2_t, typename index_t>
+  static typename executor_t::policy_t::event_t _gemm(
+      executor_t& ex, index_t _M, index_t _N, index_t _K, {data} _alpha,
+      container_0_t _a, index_t _lda, container_1_t _b, index_t _ldb,
+      {data} _beta, container_2_t _c, index_t _ldc, index_t batch_size,
+      gemm_batch_type_t batch_type) {{
+{branches}
+    return {{}};
+  }}
+}};
+
+}}  // namespace backend
+}}  // namespace gemm
+}}  // namespace blas
+#endif  // SYCL_BLAS_GEMM_TUNED_TABLE_HPP
+'''.format(source=source, data=data, branches="\n".join(branches)))
+
+
+def write_cmake(table, data, source, output_file):
+    """
+    Write the add_gemm_configuration calls instantiating the configurations
+    used by the header.
+    """
+    configs = list(dict.fromkeys(config for _, config in table))
+    output_strings = [
+        "# File generated by gen/generate_dispatch_table.py",
+        "# Results from: {}".format(source),
+    ]
+    output_strings += [config.to_cmake(data) for config in configs]
+    output_file.write("\n".join(output_strings) + "\n")
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Generate the GEMM dispatch table of the library from "
+        "the results of tune_csv.")
+    parser.add_argument('results',
+                        type=argparse.FileType('r'),
+                        help='Results file written by tune_csv')
+    parser.add_argument('header',
+                        type=argparse.FileType('w'),
+                        help='Header to generate')
+    parser.add_argument('cmake',
+                        type=argparse.FileType('w'),
+                        help='CMake file instantiating the configurations')
+    parser.add_argument('--data_type',
+                        default='float',
+                        help='Data type the results were tuned for')
+    args = parser.parse_args()
+
+    table = read_results(args.results)
+    write_header(table, args.data_type, args.results.name, args.header)
+    write_cmake(table, args.data_type, args.results.name, args.cmake)
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -97,9 +97,11 @@ static TestResultEntry tune_syclblas(int r, char transA, char transB,
   return result;
 }
 
+// Runs every configuration on the given problem, prints the results and
+// returns the fastest correct one
 template <bool TransA, bool TransB, typename DataType>
-void run_tune_gemm(int seed, int m, int k, int n, int batch_size, int rep,
-                   ::blas::gemm_batch_type_t batch_type) {
+TestResultEntry run_tune_gemm(int seed, int m, int k, int n, int batch_size,
+                              int rep, ::blas::gemm_batch_type_t batch_type) {
   std::cout << std::scientific;
 
   std::mt19937 rnd(seed);
@@ -176,4 +178,10 @@ void run_tune_gemm(int seed, int m, int k, int n, int batch_size, int rep,
   get_sycl_executor().get_policy_handler().wait();
   std::sort(results.begin(), results.end());
   results.print_all();
+  for (auto it = results.rbegin(); it != results.rend(); ++it) {
+    if (it->has_params && it->error < 0.1) {
+      return *it;
+    }
+  }
+  return TestResultEntry("none");
 }
@@ -42,6 +42,20 @@ TestResultEntry tune(int r, GemmArgs<T> a) {
                    static_cast<int>(Config::VecType), VecSize,
                    static_cast<int>(Config::BatchType)>;
   TestResultEntry result(Gemm::get_type_string());
+  result.has_params = true;
+  result.params = {to_string(Config::MemoryMode),
+                   to_string(Config::ShapeMode),
+                   to_string(Config::BatchType),
+                   to_string(Config::VecType),
+                   VecSize,
+                   Cls,
+                   {Tile::item_rows, Tile::item_cols, Tile::wg_rows,
+                    Tile::wg_cols, Tile::sg_rows, Tile::sg_cols,
+                    Tile::tl_rows, Tile::tl_cols, Tile::item_batchs,
+                    Tile::wg_batchs},
+                   DoubleBuffer,
+                   Nbca,
+                   Nbcb};
   auto ex = get_sycl_executor();
   {
     {
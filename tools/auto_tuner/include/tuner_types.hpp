@@ -27,6 +27,8 @@
 #define SYCLBLAS_TOOLS_AUTO_TUNER_TUNER_TYPES_HPP_
 
 #include <iostream>
+#include <ostream>
+#include <string>
 #include <vector>
 
 #include "sycl_blas.hpp"
@@ -46,19 +48,59 @@ using MatrixContainer =
     typename ::blas::MatrixViewTypeFactory<::blas::codeplay_policy, DataType,
                                            int, ::blas::col_major>::output_t;
 
+// Template parameters of the Gemm kernel a result was measured with. The names
+// of the enumerators match the ones used by add_gemm_configuration.
+struct GemmParamsEntry {
+  std::string mem_type;
+  std::string algo_type;
+  std::string batch_type;
+  std::string vec_type;
+  int vec_size;
+  int cache_size;
+  int tile[10];
+  bool double_buffer;
+  bool bank_conf_a;
+  bool bank_conf_b;
+};
+
 struct TestResultEntry {
   std::string name;
   double sec;
   double gflops;
   double error;
+  bool has_params;
+  GemmParamsEntry params;
 
-  TestResultEntry(std::string name) : name(name) {}
+  TestResultEntry(std::string name)
+      : name(name), sec(0), gflops(0), error(0), has_params(false) {}
 
   void print() const {
     std::cout << gflops << " gflops: " << name << " - Time: " << sec
               << " ms, Error: " << error << "\n";
   }
 
+  // Writes the result as a json object, one per line, read by
+  // gen/generate_dispatch_table.py
+  void write_json(std::ostream &os, bool trans_a, bool trans_b, int m, int k,
+                  int n, int batch_size, const std::string &batch) const {
+    const auto b = [](bool v) { return v ? "true" : "false"; };
+    os << "{\"trans_a\": " << b(trans_a) << ", \"trans_b\": " << b(trans_b)
+       << ", \"m\": " << m << ", \"k\": " << k << ", \"n\": " << n
+       << ", \"batch_size\": " << batch_size << ", \"batch\": \"" << batch
+       << "\", \"gflops\": " << gflops << ", \"mem_type\": \""
+       << params.mem_type << "\", \"algo_type\": \"" << params.algo_type
+       << "\", \"batch_type\": \"" << params.batch_type
+       << "\", \"vec_type\": \"" << params.vec_type
+       << "\", \"vec_size\": " << params.vec_size
+       << ", \"cache_size\": " << params.cache_size << ", \"tile\": [";
+    for (int i = 0; i < 10; ++i) {
+      os << (i ? ", " : "") << params.tile[i];
+    }
+    os << "], \"double_buffer\": " << b(params.double_buffer)
+       << ", \"bank_conf_a\": " << b(params.bank_conf_a)
+       << ", \"bank_conf_b\": " << b(params.bank_conf_b) << "}\n";
+  }
+
   bool operator<(const TestResultEntry &other) const {
     return gflops < other.gflops;
   }
@@ -57,6 +57,37 @@ inline SYCLExecutor &get_sycl_executor() {
   return executor;
 }
 
+inline std::string to_string(::blas::gemm_memory_t mem) {
+  return mem == ::blas::gemm_memory_t::local ? "local" : "no_local";
+}
+
+inline std::string to_string(::blas::gemm_algorithm_t algo) {
+  switch (algo) {
+    case ::blas::gemm_algorithm_t::naive:
+      return "naive";
+    case ::blas::gemm_algorithm_t::tall_skinny:
+      return "tall_skinny";
+    default:
+      return "standard";
+  }
+}
+
+inline std::string to_string(::blas::gemm_batch_type_t batch) {
+  return batch == ::blas::gemm_batch_type_t::interleaved ? "interleaved"
+                                                         : "strided";
+}
+
+inline std::string to_string(::blas::gemm_vectorization_t vec) {
+  switch (vec) {
+    case ::blas::gemm_vectorization_t::none:
+      return "none";
+    case ::blas::gemm_vectorization_t::partial:
+      return "partial";
+    default:
+      return "full";
+  }
+}
+
 template <typename T, typename RndEngine>
 HostContainer<T> get_random_vector(int size, T lo, T hi, RndEngine rnd) {
   std::uniform_real_distribution<T> dst(lo, hi);
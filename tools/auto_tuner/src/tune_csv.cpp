@@ -0,0 +1,123 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename tune_csv.cpp
+ *
+ **************************************************************************/
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "gemm_tuner.hpp"
+
+/* Tunes every GEMM of a benchmark csv file and appends the fastest
+ * configuration of each of them to a results file, from which
+ * gen/generate_dispatch_table.py generates the dispatch table of the
+ * library. */
+
+namespace {
+
+std::vector<std::string> split_line(const std::string &line) {
+  std::vector<std::string> fields;
+  std::stringstream ss(line);
+  std::string field;
+  while (std::getline(ss, field, ',')) {
+    fields.push_back(field);
+  }
+  return fields;
+}
+
+TestResultEntry tune_shape(bool trans_a, bool trans_b, int m, int k, int n,
+                           int batch_size, int rep,
+                           ::blas::gemm_batch_type_t batch_type) {
+  const int seed = 42;
+  if (trans_a && trans_b) {
+    return run_tune_gemm<true, true, float>(seed, m, k, n, batch_size, rep,
+                                            batch_type);
+  } else if (trans_a) {
+    return run_tune_gemm<true, false, float>(seed, m, k, n, batch_size, rep,
+                                             batch_type);
+  } else if (trans_b) {
+    return run_tune_gemm<false, true, float>(seed, m, k, n, batch_size, rep,
+                                             batch_type);
+  }
+  return run_tune_gemm<false, false, float>(seed, m, k, n, batch_size, rep,
+                                            batch_type);
+}
+
+}  // namespace
+
+int main(int argc, char *argv[]) {
+  if (argc < 4) {
+    std::cerr << "Usage: " << argv[0] << " shapes.csv rep results.json"
+              << " [batch_type]" << std::endl;
+    return -1;
+  }
+
+  std::ifstream shapes(argv[1]);
+  if (!shapes) {
+    std::cerr << "Cannot open " << argv[1] << std::endl;
+    return -1;
+  }
+  const int rep = std::atoi(argv[2]);
+  std::ofstream results(argv[3], std::ios::app);
+  ::blas::gemm_batch_type_t batch_type = gemm_batch_type_t::strided;
+  if (argc == 5) {
+    auto b_t = std::string(argv[4]);
+    std::transform(b_t.begin(), b_t.end(), b_t.begin(),
+                   [](unsigned char c) { return std::tolower(c); });
+    if (b_t.compare(std::string("interleaved")) == 0) {
+      batch_type = gemm_batch_type_t::interleaved;
+    } else if (b_t.compare(std::string("strided")) != 0) {
+      std::cerr << "batch type can be either Interleaved or strided \n";
+      return -1;
+    }
+  }
+
+  // Each line is: t_a,t_b,m,k,n[,alpha,beta[,batch_size]] as in the gemm
+  // and gemm_batched benchmark csv files
+  std::string line;
+  while (std::getline(shapes, line)) {
+    const auto fields = split_line(line);
+    if (fields.size() < 5) {
+      continue;
+    }
+    const bool trans_a = fields[0] != "n";
+    const bool trans_b = fields[1] != "n";
+    const int m = std::atoi(fields[2].c_str());
+    const int k = std::atoi(fields[3].c_str());
+    const int n = std::atoi(fields[4].c_str());
+    const int batch_size = fields.size() > 7 ? std::atoi(fields[7].c_str()) : 1;
+    std::cout << "======= tuning " << line << " ======" << std::endl;
+    const auto best = tune_shape(trans_a, trans_b, m, k, n, batch_size, rep,
+                                 batch_type);
+    if (best.has_params) {
+      best.write_json(results, trans_a, trans_b, m, k, n, batch_size,
+                      to_string(batch_type));
+    }
+  }
+
+  return 0;
+}